@@ -0,0 +1,269 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/partitioned_vector/partitioned_vector_checkpoint.hpp
+
+#ifndef HPX_PARTITIONED_VECTOR_CHECKPOINT_HPP
+#define HPX_PARTITIONED_VECTOR_CHECKPOINT_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/checkpoint/checkpoint.hpp>
+#include <hpx/errors.hpp>
+#include <hpx/filesystem.hpp>
+#include <hpx/lcos/dataflow.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/runtime/launch_policy.hpp>
+#include <hpx/util/unwrap.hpp>
+
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_component_decl.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx
+{
+    /// \cond NOINTERNAL
+    namespace detail
+    {
+        // Each partition is written to the file
+        // <directory>/<name>.<checkpoint>.<partition>.chk on the locality
+        // owning it. The manifest <directory>/<name>.<checkpoint>.manifest
+        // is written on the calling locality, it records for each partition
+        // the number of the checkpoint whose file holds its data.
+        inline std::string partition_checkpoint_filename(
+            std::string const& directory, std::string const& name,
+            std::uint64_t checkpoint, std::size_t partition)
+        {
+            filesystem::path p(directory);
+            p /= name + "." + std::to_string(checkpoint) + "." +
+                std::to_string(partition) + ".chk";
+            return p.string();
+        }
+
+        inline std::string checkpoint_manifest_filename(
+            std::string const& directory, std::string const& name,
+            std::uint64_t checkpoint)
+        {
+            filesystem::path p(directory);
+            p /= name + "." + std::to_string(checkpoint) + ".manifest";
+            return p.string();
+        }
+
+        // returns an empty manifest if the file does not exist
+        inline std::vector<std::uint64_t> read_checkpoint_manifest(
+            std::string const& directory, std::string const& name,
+            std::uint64_t checkpoint)
+        {
+            std::vector<std::uint64_t> manifest;
+
+            std::ifstream ifs(
+                checkpoint_manifest_filename(directory, name, checkpoint),
+                std::ios::binary);
+            if (ifs)
+            {
+                util::checkpoint c;
+                ifs >> c;
+                util::restore_checkpoint(c, manifest);
+            }
+            return manifest;
+        }
+
+        inline void write_checkpoint_manifest(std::string const& directory,
+            std::string const& name, std::uint64_t checkpoint,
+            std::vector<std::uint64_t> const& manifest)
+        {
+            std::string const filename =
+                checkpoint_manifest_filename(directory, name, checkpoint);
+
+            std::ofstream ofs(filename, std::ios::binary | std::ios::trunc);
+            if (!ofs)
+            {
+                HPX_THROW_EXCEPTION(filesystem_error,
+                    "hpx::save_incremental_checkpoint",
+                    "could not open the checkpoint manifest: " + filename);
+                return;
+            }
+            ofs << util::save_checkpoint(launch::sync, manifest);
+        }
+
+        template <typename T, typename Data>
+        std::vector<hpx::id_type> get_partition_ids(
+            partitioned_vector<T, Data> const& v)
+        {
+            std::vector<hpx::id_type> ids;
+            for (auto it = v.segment_cbegin(); it != v.segment_cend(); ++it)
+            {
+                ids.push_back(it->get_id());
+            }
+            return ids;
+        }
+    }
+    /// \endcond
+
+    /// Asynchronously save an incremental checkpoint of the given
+    /// partitioned_vector.
+    ///
+    /// Checkpoint number 0 (or any checkpoint for which the manifest of the
+    /// previous one can't be found) is a base checkpoint containing all
+    /// partitions. Every later checkpoint writes only those partitions which
+    /// were modified since they were saved by the previous checkpoint. The
+    /// partitions are written in parallel, each by the locality owning it,
+    /// into \a directory on that locality's file system.
+    ///
+    /// \param v           The partitioned_vector to save
+    /// \param directory   The directory to write the checkpoint files to,
+    ///                    this has to exist on all involved localities
+    /// \param name        The common prefix of all checkpoint files
+    /// \param checkpoint  The sequence number of the checkpoint
+    ///
+    /// \returns A future holding the number of partitions which were written.
+    ///
+    /// \note Modifications are tracked per partition. Accessing a partition
+    ///       through a non-const iterator or through the non-const data
+    ///       accessors is considered to be a modification. Elements may be
+    ///       modified through the partitioned_vector while the checkpoint is
+    ///       taken, these modifications are written by the next checkpoint.
+    ///       Iterators must not be used for modifications at the same time.
+    ///
+    template <typename T, typename Data>
+    hpx::future<std::size_t> save_incremental_checkpoint(
+        partitioned_vector<T, Data> const& v, std::string const& directory,
+        std::string const& name, std::uint64_t checkpoint)
+    {
+        std::vector<hpx::id_type> ids = detail::get_partition_ids(v);
+
+        std::vector<std::uint64_t> base;
+        if (checkpoint != 0)
+        {
+            base = detail::read_checkpoint_manifest(
+                directory, name, checkpoint - 1);
+        }
+        if (base.size() != ids.size())
+        {
+            base.clear();
+        }
+
+        std::vector<hpx::future<bool>> written;
+        written.reserve(ids.size());
+
+        for (std::size_t i = 0; i != ids.size(); ++i)
+        {
+            std::string base_filename;
+            if (!base.empty())
+            {
+                base_filename = detail::partition_checkpoint_filename(
+                    directory, name, base[i], i);
+            }
+
+            written.push_back(partitioned_vector_partition<T, Data>(ids[i])
+                .save_checkpoint(detail::partition_checkpoint_filename(
+                    directory, name, checkpoint, i), base_filename));
+        }
+
+        return hpx::dataflow(
+            util::unwrapping(
+                [directory, name, checkpoint, base = std::move(base)](
+                    std::vector<bool> const& written) -> std::size_t
+                {
+                    std::vector<std::uint64_t> manifest(written.size());
+                    std::size_t count = 0;
+
+                    for (std::size_t i = 0; i != written.size(); ++i)
+                    {
+                        if (written[i])
+                        {
+                            manifest[i] = checkpoint;
+                            ++count;
+                        }
+                        else
+                        {
+                            manifest[i] = base[i];
+                        }
+                    }
+
+                    detail::write_checkpoint_manifest(
+                        directory, name, checkpoint, manifest);
+                    return count;
+                }),
+            std::move(written));
+    }
+
+    /// Save an incremental checkpoint of the given partitioned_vector, see
+    /// above.
+    template <typename T, typename Data>
+    std::size_t save_incremental_checkpoint(launch::sync_policy,
+        partitioned_vector<T, Data> const& v, std::string const& directory,
+        std::string const& name, std::uint64_t checkpoint)
+    {
+        return save_incremental_checkpoint(v, directory, name, checkpoint)
+            .get();
+    }
+
+    /// Asynchronously restore the given partitioned_vector from an
+    /// incremental checkpoint. Each partition is read from the base
+    /// checkpoint or the latest delta checkpoint holding it.
+    ///
+    /// \param v           The partitioned_vector to restore, this has to
+    ///                    have the same number of partitions placed on the
+    ///                    same localities as the one which was saved
+    /// \param directory   The directory the checkpoint files were written to
+    /// \param name        The common prefix of all checkpoint files
+    /// \param checkpoint  The sequence number of the checkpoint to restore
+    ///
+    template <typename T, typename Data>
+    hpx::future<void> restore_incremental_checkpoint(
+        partitioned_vector<T, Data>& v, std::string const& directory,
+        std::string const& name, std::uint64_t checkpoint)
+    {
+        std::vector<hpx::id_type> ids = detail::get_partition_ids(v);
+        std::vector<std::uint64_t> manifest =
+            detail::read_checkpoint_manifest(directory, name, checkpoint);
+
+        if (manifest.size() != ids.size())
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "hpx::restore_incremental_checkpoint",
+                "the checkpoint manifest does not exist or does not match "
+                "the partitions of the given partitioned_vector");
+            return hpx::make_ready_future();
+        }
+
+        std::vector<hpx::future<void>> loaded;
+        loaded.reserve(ids.size());
+
+        for (std::size_t i = 0; i != ids.size(); ++i)
+        {
+            loaded.push_back(partitioned_vector_partition<T, Data>(ids[i])
+                .load_checkpoint(detail::partition_checkpoint_filename(
+                    directory, name, manifest[i], i)));
+        }
+
+        return hpx::dataflow(
+            [](std::vector<hpx::future<void>>&& loaded) {
+                // rethrow the first error, if any
+                for (hpx::future<void>& f : loaded)
+                    f.get();
+            },
+            std::move(loaded));
+    }
+
+    /// Restore the given partitioned_vector from an incremental checkpoint,
+    /// see above.
+    template <typename T, typename Data>
+    void restore_incremental_checkpoint(launch::sync_policy,
+        partitioned_vector<T, Data>& v, std::string const& directory,
+        std::string const& name, std::uint64_t checkpoint)
+    {
+        restore_incremental_checkpoint(v, directory, name, checkpoint).get();
+    }
+}
+
+#endif
@@ -25,10 +25,13 @@
 #include <hpx/runtime/components/server/component_base.hpp>
 #include <hpx/runtime/components/server/locking_hook.hpp>
 #include <hpx/runtime/launch_policy.hpp>
+#include <hpx/synchronization/spinlock.hpp>
 
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_fwd.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -246,6 +249,48 @@ namespace hpx { namespace server
         ///
         void clear();
 
+        ///////////////////////////////////////////////////////////////////////
+        // Checkpointing API's in server class
+        ///////////////////////////////////////////////////////////////////////
+
+        /// Mark the data of the partitioned_vector_partition as modified.
+        ///
+        /// All modifying functions (including the ones giving non-const
+        /// access to the data) do this implicitly. This has to be called only
+        /// if the data is modified through an iterator or a reference
+        /// obtained before the last checkpoint was taken.
+        ///
+        void mark_dirty();
+
+        /// Return whether the data was modified since it was last written to
+        /// or read from a checkpoint file.
+        ///
+        bool is_dirty() const;
+
+        /// Write the data to the file \a filename unless it is unchanged
+        /// since it was written to (or read from) the file \a base_filename.
+        ///
+        /// A snapshot of the data is taken while holding the lock which
+        /// protects the data against the modifying functions of this class.
+        /// Modifications made through references or iterators returned by
+        /// get_data(), begin() or end() are not synchronized, the caller has
+        /// to make sure that these are not used while a checkpoint is taken.
+        ///
+        /// \param filename       The file to write the data to
+        /// \param base_filename  The file which is known to hold the data of
+        ///                       the previous checkpoint
+        ///
+        /// \return Returns whether the data was written.
+        ///
+        bool save_checkpoint(std::string const& filename,
+            std::string const& base_filename);
+
+        /// Replace the data with the one stored in the file \a filename.
+        ///
+        /// \param filename  The file written by \a save_checkpoint
+        ///
+        void load_checkpoint(std::string const& filename);
+
         /// Macros to define HPX component actions for all exported functions.
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, size);
 
@@ -272,6 +317,23 @@ namespace hpx { namespace server
 //         HPX_DEFINE_COMPONENT_ACTION(partitioned_vector_partition, clear);
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, get_copied_data);
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partitioned_vector, set_data);
+
+        HPX_DEFINE_COMPONENT_ACTION(partitioned_vector, save_checkpoint);
+        HPX_DEFINE_COMPONENT_ACTION(partitioned_vector, load_checkpoint);
+
+    private:
+        typedef lcos::local::spinlock mutex_type;
+
+        // mtx_ protects the data (as far as it is accessed through the
+        // functions of this class) and checkpoint_filename_.
+        mutable mutex_type mtx_;
+
+        // The data is considered to be unchanged since the last checkpoint as
+        // long as version_ is equal to checkpoint_version_. The name of the
+        // file holding this data is stored in checkpoint_filename_.
+        std::atomic<std::uint64_t> version_;
+        std::atomic<std::uint64_t> checkpoint_version_;
+        std::string checkpoint_filename_;
     };
 }}
 
@@ -302,6 +364,10 @@ namespace hpx { namespace server
         HPX_PP_CAT(__vector_get_copied_data_action_, name));                  \
     HPX_REGISTER_ACTION_DECLARATION(type::set_data_action,                    \
         HPX_PP_CAT(__vector_set_data_action_, name));                         \
+    HPX_REGISTER_ACTION_DECLARATION(type::save_checkpoint_action,             \
+        HPX_PP_CAT(__vector_save_checkpoint_action_, name));                  \
+    HPX_REGISTER_ACTION_DECLARATION(type::load_checkpoint_action,             \
+        HPX_PP_CAT(__vector_load_checkpoint_action_, name));                  \
 /**/
 
 #define HPX_REGISTER_VECTOR_DECLARATION_1(type)                               \
@@ -574,6 +640,42 @@ namespace hpx
         ///
         hpx::future<void> set_data(
             typename server_type::data_type&& other) const;
+
+        /// Write the data owned by the partition_vector component to the
+        /// file \a filename unless it is unchanged since it was written to
+        /// (or read from) the file \a base_filename. The file is written by
+        /// the locality owning the component.
+        ///
+        /// \return This returns whether the data was written
+        ///
+        bool save_checkpoint(launch::sync_policy, std::string const& filename,
+            std::string const& base_filename = std::string()) const;
+
+        /// Write the data owned by the partition_vector component to the
+        /// file \a filename unless it is unchanged since it was written to
+        /// (or read from) the file \a base_filename. The file is written by
+        /// the locality owning the component.
+        ///
+        /// \return This returns whether the data was written as an
+        ///         hpx::future
+        ///
+        hpx::future<bool> save_checkpoint(std::string const& filename,
+            std::string const& base_filename = std::string()) const;
+
+        /// Replace the data owned by the partition_vector component with the
+        /// data stored in the file \a filename on the locality owning the
+        /// component.
+        ///
+        void load_checkpoint(
+            launch::sync_policy, std::string const& filename) const;
+
+        /// Replace the data owned by the partition_vector component with the
+        /// data stored in the file \a filename on the locality owning the
+        /// component.
+        ///
+        /// \return This returns the hpx::future of type void
+        ///
+        hpx::future<void> load_checkpoint(std::string const& filename) const;
     };
 }
 
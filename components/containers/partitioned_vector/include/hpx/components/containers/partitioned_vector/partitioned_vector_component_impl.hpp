@@ -10,6 +10,8 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assertion.hpp>
+#include <hpx/checkpoint/checkpoint_stream.hpp>
+#include <hpx/errors.hpp>
 #include <hpx/preprocessor/cat.hpp>
 #include <hpx/preprocessor/expand.hpp>
 #include <hpx/preprocessor/nargs.hpp>
@@ -24,8 +26,11 @@
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
 
 #include <cstddef>
+#include <cstdint>
+#include <fstream>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -37,6 +42,8 @@ namespace hpx { namespace server
     template <typename T, typename Data>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
     partitioned_vector<T, Data>::partitioned_vector()
+      : version_(1)
+      , checkpoint_version_(0)
     {
         HPX_ASSERT(false);    // shouldn't ever be called
     }
@@ -45,6 +52,8 @@ namespace hpx { namespace server
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
     partitioned_vector<T, Data>::partitioned_vector(size_type partition_size)
       : partitioned_vector_partition_(partition_size)
+      , version_(1)
+      , checkpoint_version_(0)
     {
     }
 
@@ -53,6 +62,8 @@ namespace hpx { namespace server
     partitioned_vector<T, Data>::partitioned_vector(
         size_type partition_size, T const& val)
       : partitioned_vector_partition_(partition_size, val)
+      , version_(1)
+      , checkpoint_version_(0)
     {
     }
 
@@ -61,6 +72,8 @@ namespace hpx { namespace server
     partitioned_vector<T, Data>::partitioned_vector(
         size_type partition_size, T const& val, allocator_type const& alloc)
       : partitioned_vector_partition_(partition_size, val, alloc)
+      , version_(1)
+      , checkpoint_version_(0)
     {
     }
 
@@ -70,6 +83,8 @@ namespace hpx { namespace server
         partitioned_vector const& rhs)
       : base_type(rhs)
       , partitioned_vector_partition_(rhs.partitioned_vector_partition_)
+      , version_(1)
+      , checkpoint_version_(0)
     {
     }
 
@@ -79,6 +94,8 @@ namespace hpx { namespace server
       : base_type(std::move(rhs))
       , partitioned_vector_partition_(
             std::move(rhs.partitioned_vector_partition_))
+      , version_(1)
+      , checkpoint_version_(0)
     {
     }
 
@@ -88,6 +105,7 @@ namespace hpx { namespace server
         typename partitioned_vector<T, Data>::data_type&
         partitioned_vector<T, Data>::get_data()
     {
+        mark_dirty();
         return partitioned_vector_partition_;
     }
 
@@ -104,12 +122,15 @@ namespace hpx { namespace server
         typename partitioned_vector<T, Data>::data_type
         partitioned_vector<T, Data>::get_copied_data() const
     {
+        std::lock_guard<mutex_type> l(mtx_);
         return partitioned_vector_partition_;
     }
 
     template <typename T, typename Data>
     void partitioned_vector<T, Data>::set_data(data_type&& other)
     {
+        std::lock_guard<mutex_type> l(mtx_);
+        mark_dirty();
         partitioned_vector_partition_ = std::move(other);
     }
 
@@ -119,6 +140,7 @@ namespace hpx { namespace server
         typename partitioned_vector<T, Data>::iterator_type
         partitioned_vector<T, Data>::begin()
     {
+        mark_dirty();
         return partitioned_vector_partition_.begin();
     }
 
@@ -143,6 +165,7 @@ namespace hpx { namespace server
         typename partitioned_vector<T, Data>::iterator_type
         partitioned_vector<T, Data>::end()
     {
+        mark_dirty();
         return partitioned_vector_partition_.end();
     }
 
@@ -168,6 +191,7 @@ namespace hpx { namespace server
         typename partitioned_vector<T, Data>::size_type
         partitioned_vector<T, Data>::size() const
     {
+        std::lock_guard<mutex_type> l(mtx_);
         return partitioned_vector_partition_.size();
     }
 
@@ -184,6 +208,7 @@ namespace hpx { namespace server
         typename partitioned_vector<T, Data>::size_type
         partitioned_vector<T, Data>::capacity() const
     {
+        std::lock_guard<mutex_type> l(mtx_);
         return partitioned_vector_partition_.capacity();
     }
 
@@ -191,6 +216,7 @@ namespace hpx { namespace server
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT bool
     partitioned_vector<T, Data>::empty() const
     {
+        std::lock_guard<mutex_type> l(mtx_);
         return partitioned_vector_partition_.empty();
     }
 
@@ -198,6 +224,8 @@ namespace hpx { namespace server
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
     partitioned_vector<T, Data>::resize(size_type n, T const& val)
     {
+        std::lock_guard<mutex_type> l(mtx_);
+        mark_dirty();
         partitioned_vector_partition_.resize(n, val);
     }
 
@@ -205,6 +233,7 @@ namespace hpx { namespace server
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
     partitioned_vector<T, Data>::reserve(size_type n)
     {
+        std::lock_guard<mutex_type> l(mtx_);
         partitioned_vector_partition_.reserve(n);
     }
 
@@ -212,6 +241,7 @@ namespace hpx { namespace server
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT T
     partitioned_vector<T, Data>::get_value(size_type pos) const
     {
+        std::lock_guard<mutex_type> l(mtx_);
         return partitioned_vector_partition_[pos];
     }
 
@@ -223,6 +253,7 @@ namespace hpx { namespace server
         std::vector<T> result;
         result.reserve(pos.size());
 
+        std::lock_guard<mutex_type> l(mtx_);
         for (std::size_t i = 0; i != pos.size(); ++i)
             result.push_back(partitioned_vector_partition_[pos[i]]);
 
@@ -233,6 +264,7 @@ namespace hpx { namespace server
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT T
     partitioned_vector<T, Data>::front() const
     {
+        std::lock_guard<mutex_type> l(mtx_);
         return partitioned_vector_partition_.front();
     }
 
@@ -240,6 +272,7 @@ namespace hpx { namespace server
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT T
     partitioned_vector<T, Data>::back() const
     {
+        std::lock_guard<mutex_type> l(mtx_);
         return partitioned_vector_partition_.back();
     }
 
@@ -248,6 +281,8 @@ namespace hpx { namespace server
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
     partitioned_vector<T, Data>::assign(size_type n, T const& val)
     {
+        std::lock_guard<mutex_type> l(mtx_);
+        mark_dirty();
         partitioned_vector_partition_.assign(n, val);
     }
 
@@ -255,6 +290,8 @@ namespace hpx { namespace server
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
     partitioned_vector<T, Data>::push_back(T const& val)
     {
+        std::lock_guard<mutex_type> l(mtx_);
+        mark_dirty();
         partitioned_vector_partition_.push_back(val);
     }
 
@@ -262,6 +299,8 @@ namespace hpx { namespace server
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
     partitioned_vector<T, Data>::pop_back()
     {
+        std::lock_guard<mutex_type> l(mtx_);
+        mark_dirty();
         partitioned_vector_partition_.pop_back();
     }
 
@@ -269,6 +308,8 @@ namespace hpx { namespace server
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
     partitioned_vector<T, Data>::set_value(size_type pos, T const& val)
     {
+        std::lock_guard<mutex_type> l(mtx_);
+        mark_dirty();
         partitioned_vector_partition_[pos] = val;
     }
 
@@ -278,6 +319,9 @@ namespace hpx { namespace server
         std::vector<size_type> const& pos, std::vector<T> const& val)
     {
         HPX_ASSERT(pos.size() == val.size());
+
+        std::lock_guard<mutex_type> l(mtx_);
+        mark_dirty();
         HPX_ASSERT(pos.size() <= partitioned_vector_partition_.size());
 
         for (std::size_t i = 0; i != pos.size(); ++i)
@@ -288,8 +332,85 @@ namespace hpx { namespace server
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
     partitioned_vector<T, Data>::clear()
     {
+        std::lock_guard<mutex_type> l(mtx_);
+        mark_dirty();
         partitioned_vector_partition_.clear();
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector<T, Data>::mark_dirty()
+    {
+        ++version_;
+    }
+
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT bool
+    partitioned_vector<T, Data>::is_dirty() const
+    {
+        return version_.load() != checkpoint_version_.load();
+    }
+
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT bool
+    partitioned_vector<T, Data>::save_checkpoint(
+        std::string const& filename, std::string const& base_filename)
+    {
+        // Write a snapshot of the data, the lock is not held while writing
+        // the file. Modifications made in the meantime will be picked up by
+        // the next checkpoint.
+        std::uint64_t version = 0;
+        data_type data;
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            version = version_.load();
+            if (version == checkpoint_version_.load() &&
+                !base_filename.empty() && base_filename == checkpoint_filename_)
+            {
+                return false;
+            }
+            data = partitioned_vector_partition_;
+        }
+
+        std::ofstream ofs(filename, std::ios::binary | std::ios::trunc);
+        if (!ofs)
+        {
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "partitioned_vector::save_checkpoint",
+                "could not open the checkpoint file: " + filename);
+            return false;
+        }
+
+        util::save_checkpoint_stream(launch::sync, ofs, data);
+
+        std::lock_guard<mutex_type> l(mtx_);
+        checkpoint_version_.store(version);
+        checkpoint_filename_ = filename;
+        return true;
+    }
+
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector<T, Data>::load_checkpoint(std::string const& filename)
+    {
+        std::ifstream ifs(filename, std::ios::binary);
+        if (!ifs)
+        {
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "partitioned_vector::load_checkpoint",
+                "could not open the checkpoint file: " + filename);
+            return;
+        }
+
+        data_type data;
+        util::restore_checkpoint_stream(ifs, data);
+
+        std::lock_guard<mutex_type> l(mtx_);
+        partitioned_vector_partition_ = std::move(data);
+        checkpoint_version_.store(version_.load());
+        checkpoint_filename_ = filename;
+    }
 }}
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -318,6 +439,10 @@ namespace hpx { namespace server
         HPX_PP_CAT(__vector_get_copied_data_action_, name));                   \
     HPX_REGISTER_ACTION(                                                       \
         type::set_data_action, HPX_PP_CAT(__vector_set_data_action_, name));   \
+    HPX_REGISTER_ACTION(type::save_checkpoint_action,                          \
+        HPX_PP_CAT(__vector_save_checkpoint_action_, name));                   \
+    HPX_REGISTER_ACTION(type::load_checkpoint_action,                          \
+        HPX_PP_CAT(__vector_load_checkpoint_action_, name));                   \
     typedef ::hpx::components::component<type> HPX_PP_CAT(__vector_, name);    \
     HPX_REGISTER_COMPONENT(HPX_PP_CAT(__vector_, name))    \
 /**/
@@ -519,6 +644,42 @@ namespace hpx
         return hpx::async<typename server_type::set_data_action>(
             this->get_id(), std::move(other));
     }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT bool
+    partitioned_vector_partition<T, Data>::save_checkpoint(launch::sync_policy,
+        std::string const& filename, std::string const& base_filename) const
+    {
+        return save_checkpoint(filename, base_filename).get();
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<bool>
+    partitioned_vector_partition<T, Data>::save_checkpoint(
+        std::string const& filename, std::string const& base_filename) const
+    {
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::save_checkpoint_action>(
+            this->get_id(), filename, base_filename);
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT void
+    partitioned_vector_partition<T, Data>::load_checkpoint(
+        launch::sync_policy, std::string const& filename) const
+    {
+        load_checkpoint(filename).get();
+    }
+
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT hpx::future<void>
+    partitioned_vector_partition<T, Data>::load_checkpoint(
+        std::string const& filename) const
+    {
+        HPX_ASSERT(this->get_id());
+        return hpx::async<typename server_type::load_checkpoint_action>(
+            this->get_id(), filename);
+    }
 }
 
 #endif
@@ -0,0 +1,154 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/filesystem.hpp>
+#include <hpx/include/parallel_fill.hpp>
+#include <hpx/include/partitioned_vector.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_checkpoint.hpp>
+
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// partitioned_vector<double> is predefined in the partitioned_vector module
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<double> get_values(hpx::partitioned_vector<double> const& v)
+{
+    std::vector<double> values;
+    values.reserve(v.size());
+    for (std::size_t i = 0; i != v.size(); ++i)
+        values.push_back(v[i]);
+    return values;
+}
+
+void test_incremental_checkpoint(std::string const& directory)
+{
+    std::size_t const num_partitions = 4;
+    std::size_t const partition_size = 1000;
+
+    hpx::partitioned_vector<double> v(num_partitions * partition_size,
+        hpx::container_layout(num_partitions, hpx::find_all_localities()));
+    hpx::parallel::fill(
+        hpx::parallel::execution::par, v.begin(), v.end(), 42.0);
+
+    // the base checkpoint writes all partitions
+    HPX_TEST_EQ(hpx::save_incremental_checkpoint(
+                    hpx::launch::sync, v, directory, "test", 0),
+        num_partitions);
+    std::vector<double> const values0 = get_values(v);
+
+    // only the modified partitions are written afterwards
+    v.set_value(hpx::launch::sync, partition_size + 1, 1.0);
+    HPX_TEST_EQ(hpx::save_incremental_checkpoint(
+                    hpx::launch::sync, v, directory, "test", 1),
+        std::size_t(1));
+    std::vector<double> const values1 = get_values(v);
+
+    HPX_TEST_EQ(hpx::save_incremental_checkpoint(
+                    hpx::launch::sync, v, directory, "test", 2),
+        std::size_t(0));
+
+    v.set_value(hpx::launch::sync, 3 * partition_size, 3.0);
+    v.set_value(hpx::launch::sync, 3 * partition_size + 1, 3.0);
+    HPX_TEST_EQ(hpx::save_incremental_checkpoint(
+                    hpx::launch::sync, v, directory, "test", 3),
+        std::size_t(1));
+    std::vector<double> const values3 = get_values(v);
+
+    // restore from the base and the deltas
+    hpx::parallel::fill(
+        hpx::parallel::execution::par, v.begin(), v.end(), 0.0);
+
+    hpx::restore_incremental_checkpoint(
+        hpx::launch::sync, v, directory, "test", 3);
+    HPX_TEST(get_values(v) == values3);
+
+    hpx::restore_incremental_checkpoint(
+        hpx::launch::sync, v, directory, "test", 2);
+    HPX_TEST(get_values(v) == values1);
+
+    hpx::restore_incremental_checkpoint(
+        hpx::launch::sync, v, directory, "test", 0);
+    HPX_TEST(get_values(v) == values0);
+
+    // a restored vector is clean with respect to the restored checkpoint
+    HPX_TEST_EQ(hpx::save_incremental_checkpoint(
+                    hpx::launch::sync, v, directory, "test", 1),
+        std::size_t(0));
+
+    // restoring a non-existing checkpoint fails
+    bool caught_exception = false;
+    try
+    {
+        hpx::restore_incremental_checkpoint(
+            hpx::launch::sync, v, directory, "test", 42);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+// Elements modified while a checkpoint is taken are written either by this
+// or by the next checkpoint.
+void test_concurrent_modification(std::string const& directory)
+{
+    std::size_t const num_partitions = 4;
+    std::size_t const partition_size = 1000;
+
+    hpx::partitioned_vector<double> v(num_partitions * partition_size, 0.0,
+        hpx::container_layout(num_partitions, hpx::find_all_localities()));
+
+    HPX_TEST_EQ(hpx::save_incremental_checkpoint(
+                    hpx::launch::sync, v, directory, "concurrent", 0),
+        num_partitions);
+
+    std::vector<hpx::future<void>> modifications;
+    modifications.reserve(num_partitions * partition_size / 10);
+    for (std::size_t i = 0; i < num_partitions * partition_size; i += 10)
+    {
+        modifications.push_back(v.set_value(i, double(i)));
+    }
+
+    hpx::future<std::size_t> checkpoint = hpx::save_incremental_checkpoint(
+        v, directory, "concurrent", 1);
+
+    hpx::wait_all(modifications);
+    HPX_TEST_LTE(checkpoint.get(), num_partitions);
+
+    std::vector<double> const values = get_values(v);
+    hpx::save_incremental_checkpoint(
+        hpx::launch::sync, v, directory, "concurrent", 2);
+
+    v.set_value(hpx::launch::sync, 0, -1.0);
+    v.set_value(hpx::launch::sync, 3 * partition_size, -1.0);
+
+    hpx::restore_incremental_checkpoint(
+        hpx::launch::sync, v, directory, "concurrent", 2);
+    HPX_TEST(get_values(v) == values);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    hpx::filesystem::path const directory =
+        hpx::filesystem::temp_directory_path() /
+        "partitioned_vector_checkpoint_test";
+    hpx::filesystem::create_directories(directory);
+
+    test_incremental_checkpoint(directory.string());
+    test_concurrent_modification(directory.string());
+
+    hpx::filesystem::remove_all(directory);
+
+    return hpx::util::report_errors();
+}
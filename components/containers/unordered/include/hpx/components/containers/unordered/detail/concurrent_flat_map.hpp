@@ -0,0 +1,676 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/unordered/detail/concurrent_flat_map.hpp
+
+#if !defined(HPX_UNORDERED_DETAIL_CONCURRENT_FLAT_MAP_HPP)
+#define HPX_UNORDERED_DETAIL_CONCURRENT_FLAT_MAP_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/iterator_support/iterator_facade.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace detail
+{
+    /// \brief A hash map which can be accessed concurrently by many threads.
+    ///
+    /// The elements are stored in flat arrays using open addressing (linear
+    /// probing), every slot is described by a control byte which holds
+    /// either a marker for empty and deleted slots or the lowest 7 bits of
+    /// the hash value of the stored key. Lookups scan the control bytes and
+    /// touch the slots only if the hash bits match.
+    ///
+    /// The table is split into independently locked shards, the shard of a
+    /// key is selected by the upper bits of its (mixed) hash value. Threads
+    /// accessing different shards never contend.
+    ///
+    /// All member functions are thread-safe except for construction,
+    /// assignment, swap, destruction, and the iterators. The iterators may
+    /// be used only while no other thread modifies the map, use for_each
+    /// otherwise.
+    template <typename Key, typename T, typename Hash = std::hash<Key>,
+        typename KeyEqual = std::equal_to<Key> >
+    class concurrent_flat_map
+    {
+    public:
+        typedef Key key_type;
+        typedef T mapped_type;
+        typedef std::pair<Key const, T> value_type;
+        typedef std::size_t size_type;
+        typedef Hash hasher;
+        typedef KeyEqual key_equal;
+
+    private:
+        // control byte values, full slots store the tag of the key instead
+        static constexpr std::uint8_t ctrl_empty = 0x80;
+        static constexpr std::uint8_t ctrl_deleted = 0xfe;
+
+        static constexpr std::size_t npos = std::size_t(-1);
+        static constexpr std::size_t min_capacity = 8;
+
+        typedef typename std::aligned_storage<
+                sizeof(value_type), alignof(value_type)
+            >::type slot_type;
+
+        typedef lcos::local::spinlock mutex_type;
+
+        struct shard
+        {
+            shard()
+              : capacity_(0), size_(0), deleted_(0)
+            {}
+
+            ~shard()
+            {
+                destroy();
+            }
+
+            value_type& slot(std::size_t i)
+            {
+                return *reinterpret_cast<value_type*>(&slots_[i]);
+            }
+            value_type const& slot(std::size_t i) const
+            {
+                return *reinterpret_cast<value_type const*>(&slots_[i]);
+            }
+
+            bool is_full(std::size_t i) const
+            {
+                return (ctrl_[i] & 0x80) == 0;
+            }
+
+            void destroy()
+            {
+                for (std::size_t i = 0; i != capacity_; ++i)
+                {
+                    if (is_full(i))
+                        slot(i).~value_type();
+                }
+                ctrl_.reset();
+                slots_.reset();
+                capacity_ = 0;
+                size_.store(0, std::memory_order_relaxed);
+                deleted_ = 0;
+            }
+
+            mutable mutex_type mtx_;
+            std::unique_ptr<std::uint8_t[]> ctrl_;
+            std::unique_ptr<slot_type[]> slots_;
+            std::size_t capacity_;          // zero or a power of two
+            std::atomic<std::size_t> size_;
+            std::size_t deleted_;           // number of deleted slots
+        };
+
+        typedef util::cache_line_data<shard> shard_data;
+
+        ///////////////////////////////////////////////////////////////////////
+        static std::size_t default_num_shards()
+        {
+            // enough shards to make contention between the cores unlikely
+            std::size_t num_shards = 1;
+            while (num_shards < 4 * threads::hardware_concurrency() &&
+                num_shards < 1024)
+            {
+                num_shards *= 2;
+            }
+            return num_shards;
+        }
+
+        std::uint64_t hash_value(Key const& key) const
+        {
+            // std::hash is the identity for integral types, mix the bits to
+            // make sure all of them influence the shard, slot, and tag
+            std::uint64_t h = static_cast<std::uint64_t>(hasher_(key));
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            return h;
+        }
+
+        static std::uint8_t tag_of(std::uint64_t h)
+        {
+            return static_cast<std::uint8_t>(h & 0x7f);
+        }
+
+        static std::size_t start_of(std::uint64_t h, std::size_t capacity)
+        {
+            return static_cast<std::size_t>(h >> 7) & (capacity - 1);
+        }
+
+        shard& shard_of(std::uint64_t h) const
+        {
+            return shards_[static_cast<std::size_t>(h >> 40) &
+                (num_shards_ - 1)].data_;
+        }
+
+        // The capacity needed to hold the given number of elements without
+        // exceeding the maximal load factor of 7/8.
+        static std::size_t capacity_for(std::size_t size)
+        {
+            std::size_t capacity = min_capacity;
+            while (capacity * 7 < size * 8)
+                capacity *= 2;
+            return capacity;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The following functions have to be called while holding the lock
+        // of the given shard.
+
+        // Return the index of the slot holding the given key, or npos.
+        std::size_t find_slot(
+            shard const& s, Key const& key, std::uint64_t h) const
+        {
+            if (s.capacity_ == 0)
+                return npos;
+
+            std::size_t const mask = s.capacity_ - 1;
+            std::uint8_t const tag = tag_of(h);
+
+            // there is always at least one empty slot
+            for (std::size_t i = start_of(h, s.capacity_); /**/;
+                 i = (i + 1) & mask)
+            {
+                std::uint8_t const c = s.ctrl_[i];
+                if (c == ctrl_empty)
+                    return npos;
+                if (c == tag && key_equal_(s.slot(i).first, key))
+                    return i;
+            }
+        }
+
+        // Return the index of the first free slot in the probe sequence of
+        // the given hash value.
+        static std::size_t find_free_slot(shard const& s, std::uint64_t h)
+        {
+            std::size_t const mask = s.capacity_ - 1;
+            std::size_t i = start_of(h, s.capacity_);
+            while (s.is_full(i))
+                i = (i + 1) & mask;
+            return i;
+        }
+
+        void rehash(shard& s, std::size_t capacity)
+        {
+            HPX_ASSERT(capacity >= min_capacity &&
+                (capacity & (capacity - 1)) == 0);
+
+            std::unique_ptr<std::uint8_t[]> ctrl(new std::uint8_t[capacity]);
+            std::unique_ptr<slot_type[]> slots(new slot_type[capacity]);
+            std::fill(ctrl.get(), ctrl.get() + capacity, ctrl_empty);
+
+            std::size_t const mask = capacity - 1;
+            for (std::size_t i = 0; i != s.capacity_; ++i)
+            {
+                if (!s.is_full(i))
+                    continue;
+
+                value_type& v = s.slot(i);
+                std::uint64_t const h = hash_value(v.first);
+
+                std::size_t j = start_of(h, capacity);
+                while (ctrl[j] != ctrl_empty)
+                    j = (j + 1) & mask;
+
+                new (&slots[j]) value_type(std::move(v));
+                ctrl[j] = tag_of(h);
+
+                v.~value_type();
+                s.ctrl_[i] = ctrl_empty;
+            }
+
+            s.ctrl_ = std::move(ctrl);
+            s.slots_ = std::move(slots);
+            s.capacity_ = capacity;
+            s.deleted_ = 0;
+        }
+
+        // Make room for one more element and return the index of the slot
+        // to construct it in.
+        std::size_t prepare_insert(shard& s, std::uint64_t h)
+        {
+            std::size_t const size = s.size_.load(std::memory_order_relaxed);
+            if ((size + s.deleted_ + 1) * 8 > s.capacity_ * 7)
+            {
+                // grow only if the deleted slots don't make up for the space
+                // needed, otherwise just get rid of them
+                std::size_t capacity = (std::max)(s.capacity_, min_capacity);
+                if ((size + 1) * 16 > capacity * 7)
+                    capacity *= 2;
+                rehash(s, capacity);
+            }
+
+            std::size_t const i = find_free_slot(s, h);
+            if (s.ctrl_[i] == ctrl_deleted)
+                --s.deleted_;
+            return i;
+        }
+
+        void erase_slot(shard& s, std::size_t i)
+        {
+            s.slot(i).~value_type();
+
+            // no probe sequence passes through this slot if the next one is
+            // empty
+            if (s.ctrl_[(i + 1) & (s.capacity_ - 1)] == ctrl_empty)
+            {
+                s.ctrl_[i] = ctrl_empty;
+            }
+            else
+            {
+                s.ctrl_[i] = ctrl_deleted;
+                ++s.deleted_;
+            }
+            s.size_.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Map, typename Value>
+        class iterator_impl
+          : public hpx::util::iterator_facade<iterator_impl<Map, Value>,
+                Value, std::forward_iterator_tag>
+        {
+        public:
+            iterator_impl()
+              : map_(nullptr), shard_(0), slot_(0)
+            {}
+
+            iterator_impl(Map* map, std::size_t shard, std::size_t slot)
+              : map_(map), shard_(shard), slot_(slot)
+            {
+                satisfy();
+            }
+
+            template <typename OtherMap, typename OtherValue>
+            iterator_impl(iterator_impl<OtherMap, OtherValue> const& rhs)
+              : map_(rhs.map_), shard_(rhs.shard_), slot_(rhs.slot_)
+            {}
+
+        private:
+            template <typename, typename> friend class iterator_impl;
+            friend class hpx::util::iterator_core_access;
+
+            // move forward to the next full slot
+            void satisfy()
+            {
+                while (shard_ != map_->num_shards_)
+                {
+                    shard const& s = map_->shards_[shard_].data_;
+                    for (/**/; slot_ != s.capacity_; ++slot_)
+                    {
+                        if (s.is_full(slot_))
+                            return;
+                    }
+                    ++shard_;
+                    slot_ = 0;
+                }
+            }
+
+            bool equal(iterator_impl const& rhs) const
+            {
+                return shard_ == rhs.shard_ && slot_ == rhs.slot_;
+            }
+
+            void increment()
+            {
+                ++slot_;
+                satisfy();
+            }
+
+            Value& dereference() const
+            {
+                return map_->shards_[shard_].data_.slot(slot_);
+            }
+
+            Map* map_;
+            std::size_t shard_;
+            std::size_t slot_;
+        };
+
+    public:
+        typedef iterator_impl<concurrent_flat_map, value_type> iterator;
+        typedef iterator_impl<concurrent_flat_map const, value_type const>
+            const_iterator;
+
+        ///////////////////////////////////////////////////////////////////////
+        explicit concurrent_flat_map(size_type bucket_count = 0,
+                Hash const& hash = Hash(), KeyEqual const& equal = KeyEqual())
+          : num_shards_(default_num_shards())
+          , shards_(new shard_data[num_shards_])
+          , hasher_(hash)
+          , key_equal_(equal)
+        {
+            if (bucket_count != 0)
+                reserve(bucket_count);
+        }
+
+        concurrent_flat_map(concurrent_flat_map const& rhs)
+          : num_shards_(rhs.num_shards_)
+          , shards_(new shard_data[num_shards_])
+          , hasher_(rhs.hasher_)
+          , key_equal_(rhs.key_equal_)
+        {
+            // the shards of both maps use the same hash bits
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard const& src = rhs.shards_[i].data_;
+                shard& dest = shards_[i].data_;
+
+                std::lock_guard<mutex_type> l(src.mtx_);
+                if (src.size_.load(std::memory_order_relaxed) == 0)
+                    continue;
+
+                rehash(dest, src.capacity_);
+                for (std::size_t j = 0; j != src.capacity_; ++j)
+                {
+                    if (src.is_full(j))
+                    {
+                        new (&dest.slots_[j]) value_type(src.slot(j));
+                        dest.ctrl_[j] = src.ctrl_[j];
+                        dest.size_.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    else if (src.ctrl_[j] == ctrl_deleted)
+                    {
+                        dest.ctrl_[j] = ctrl_deleted;
+                        ++dest.deleted_;
+                    }
+                }
+            }
+        }
+
+        concurrent_flat_map(concurrent_flat_map&& rhs)
+          : num_shards_(rhs.num_shards_)
+          , shards_(std::move(rhs.shards_))
+          , hasher_(std::move(rhs.hasher_))
+          , key_equal_(std::move(rhs.key_equal_))
+        {
+            // leave the source in a valid (empty) state
+            rhs.shards_.reset(new shard_data[rhs.num_shards_]);
+        }
+
+        concurrent_flat_map& operator=(concurrent_flat_map const& rhs)
+        {
+            if (this != &rhs)
+            {
+                concurrent_flat_map tmp(rhs);
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        concurrent_flat_map& operator=(concurrent_flat_map&& rhs)
+        {
+            if (this != &rhs)
+            {
+                concurrent_flat_map tmp(std::move(rhs));
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        void swap(concurrent_flat_map& rhs)
+        {
+            std::swap(num_shards_, rhs.num_shards_);
+            std::swap(shards_, rhs.shards_);
+            std::swap(hasher_, rhs.hasher_);
+            std::swap(key_equal_, rhs.key_equal_);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        iterator begin()
+        {
+            return iterator(this, 0, 0);
+        }
+        const_iterator begin() const
+        {
+            return const_iterator(this, 0, 0);
+        }
+        const_iterator cbegin() const
+        {
+            return const_iterator(this, 0, 0);
+        }
+
+        iterator end()
+        {
+            return iterator(this, num_shards_, 0);
+        }
+        const_iterator end() const
+        {
+            return const_iterator(this, num_shards_, 0);
+        }
+        const_iterator cend() const
+        {
+            return const_iterator(this, num_shards_, 0);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Return the number of elements, the result is exact only if no
+        /// other thread modifies the map concurrently.
+        size_type size() const
+        {
+            std::size_t size = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+                size += shards_[i].data_.size_.load(std::memory_order_relaxed);
+            return size;
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        size_type max_size() const
+        {
+            return (std::numeric_limits<size_type>::max)() /
+                sizeof(slot_type);
+        }
+
+        /// Return the number of slots currently allocated.
+        size_type capacity() const
+        {
+            std::size_t capacity = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard const& s = shards_[i].data_;
+                std::lock_guard<mutex_type> l(s.mtx_);
+                capacity += s.capacity_;
+            }
+            return capacity;
+        }
+
+        /// Make room for (at least) the given number of elements, assuming
+        /// the keys are evenly distributed over the shards.
+        void reserve(size_type count)
+        {
+            std::size_t const capacity =
+                capacity_for((count + num_shards_ - 1) / num_shards_);
+
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i].data_;
+                std::lock_guard<mutex_type> l(s.mtx_);
+                if (s.capacity_ < capacity)
+                    rehash(s, capacity);
+            }
+        }
+
+        void clear()
+        {
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i].data_;
+                std::lock_guard<mutex_type> l(s.mtx_);
+                s.destroy();
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Return a copy of the value stored for the given key (if any).
+        util::optional<T> find(Key const& key) const
+        {
+            std::uint64_t const h = hash_value(key);
+            shard& s = shard_of(h);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            std::size_t const i = find_slot(s, key, h);
+            if (i == npos)
+                return util::optional<T>();
+            return util::optional<T>(s.slot(i).second);
+        }
+
+        bool contains(Key const& key) const
+        {
+            std::uint64_t const h = hash_value(key);
+            shard& s = shard_of(h);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            return find_slot(s, key, h) != npos;
+        }
+
+        /// Call the given function for the value stored for the given key
+        /// (if any) while holding the lock protecting it. The function must
+        /// not suspend the calling thread.
+        template <typename F>
+        bool visit(Key const& key, F&& f)
+        {
+            std::uint64_t const h = hash_value(key);
+            shard& s = shard_of(h);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            std::size_t const i = find_slot(s, key, h);
+            if (i == npos)
+                return false;
+
+            f(s.slot(i).second);
+            return true;
+        }
+
+        /// Remove the value stored for the given key and return it (if any).
+        util::optional<T> extract(Key const& key)
+        {
+            std::uint64_t const h = hash_value(key);
+            shard& s = shard_of(h);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            std::size_t const i = find_slot(s, key, h);
+            if (i == npos)
+                return util::optional<T>();
+
+            util::optional<T> result(std::move(s.slot(i).second));
+            erase_slot(s, i);
+            return result;
+        }
+
+        /// Store the given value for the given key, returns whether a new
+        /// element was inserted.
+        template <typename T_>
+        bool insert_or_assign(Key const& key, T_&& value)
+        {
+            std::uint64_t const h = hash_value(key);
+            shard& s = shard_of(h);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            std::size_t i = find_slot(s, key, h);
+            if (i != npos)
+            {
+                s.slot(i).second = std::forward<T_>(value);
+                return false;
+            }
+
+            i = prepare_insert(s, h);
+            new (&s.slots_[i]) value_type(key, std::forward<T_>(value));
+            s.ctrl_[i] = tag_of(h);
+            s.size_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        size_type erase(Key const& key)
+        {
+            std::uint64_t const h = hash_value(key);
+            shard& s = shard_of(h);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            std::size_t const i = find_slot(s, key, h);
+            if (i == npos)
+                return 0;
+
+            erase_slot(s, i);
+            return 1;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Call the given function for all elements. Each shard is locked
+        /// while its elements are visited, the function must not suspend the
+        /// calling thread.
+        template <typename F>
+        void for_each(F&& f) const
+        {
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard const& s = shards_[i].data_;
+                std::lock_guard<mutex_type> l(s.mtx_);
+                for (std::size_t j = 0; j != s.capacity_; ++j)
+                {
+                    if (s.is_full(j))
+                        f(s.slot(j));
+                }
+            }
+        }
+
+        template <typename F>
+        void for_each(F&& f)
+        {
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i].data_;
+                std::lock_guard<mutex_type> l(s.mtx_);
+                for (std::size_t j = 0; j != s.capacity_; ++j)
+                {
+                    if (s.is_full(j))
+                        f(s.slot(j));
+                }
+            }
+        }
+
+    private:
+        std::size_t num_shards_;
+        std::unique_ptr<shard_data[]> shards_;
+        Hash hasher_;
+        KeyEqual key_equal_;
+    };
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    constexpr std::uint8_t
+        concurrent_flat_map<Key, T, Hash, KeyEqual>::ctrl_empty;
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    constexpr std::uint8_t
+        concurrent_flat_map<Key, T, Hash, KeyEqual>::ctrl_deleted;
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    constexpr std::size_t
+        concurrent_flat_map<Key, T, Hash, KeyEqual>::npos;
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    constexpr std::size_t
+        concurrent_flat_map<Key, T, Hash, KeyEqual>::min_capacity;
+}}
+
+#endif
@@ -13,9 +13,10 @@
 ///
 /// \brief The partition_unordered_map as the hpx component is defined here.
 ///
-/// The partition_unordered_map is the wrapper to the stl unordered_map class
-/// except all API'are defined as component action. All the API's in client
-/// classes are asynchronous API which return the futures.
+/// The partition_unordered_map stores its elements in a concurrent flat hash
+/// table, all API's are defined as component actions which may be executed
+/// concurrently. All the API's in client classes are asynchronous API which
+/// return the futures.
 
 #include <hpx/config.hpp>
 #include <hpx/assertion.hpp>
@@ -28,11 +29,13 @@
 #include <hpx/runtime/actions/plain_action.hpp>
 #include <hpx/runtime/components/client_base.hpp>
 #include <hpx/runtime/components/component_factory.hpp>
-#include <hpx/runtime/components/server/locking_hook.hpp>
 #include <hpx/runtime/components/server/simple_component_base.hpp>
 #include <hpx/runtime/get_ptr.hpp>
 #include <hpx/runtime/launch_policy.hpp>
 #include <hpx/errors.hpp>
+#include <hpx/datastructures/optional.hpp>
+
+#include <hpx/components/containers/unordered/detail/concurrent_flat_map.hpp>
 
 #include <cstddef>
 #include <iostream>
@@ -45,31 +48,36 @@
 
 namespace hpx { namespace server
 {
-    /// \brief This is the basic wrapper class for stl unordered_map.
+    /// \brief This is the basic wrapper class for a concurrent hash map.
     ///
     /// This contain the implementation of the partition_unordered_map's
-    /// component functionality.
+    /// component functionality. The elements are held in a
+    /// detail::concurrent_flat_map, which allows for the actions invoked on
+    /// this partition to run concurrently without serializing them.
     template <typename Key, typename T, typename Hash = std::hash<Key>,
         typename KeyEqual = std::equal_to<Key> >
     class partition_unordered_map
-      : public components::locking_hook<
-            hpx::components::simple_component_base<
-                partition_unordered_map<Key, T, Hash, KeyEqual> > >
+      : public hpx::components::simple_component_base<
+            partition_unordered_map<Key, T, Hash, KeyEqual> >
     {
     public:
+        /// The type used to transfer all of the data of a partition
         typedef std::unordered_map<Key, T, Hash, KeyEqual> data_type;
 
-        typedef typename data_type::size_type size_type;
-        typedef typename data_type::iterator iterator_type;
-        typedef typename data_type::const_iterator const_iterator_type;
+        /// The type used to store the data of a partition
+        typedef hpx::detail::concurrent_flat_map<Key, T, Hash, KeyEqual>
+            storage_type;
+
+        typedef typename storage_type::size_type size_type;
+        typedef typename storage_type::iterator iterator_type;
+        typedef typename storage_type::const_iterator const_iterator_type;
 
-        typedef components::locking_hook<
-                hpx::components::simple_component_base<
-                    partition_unordered_map<Key, T, Hash, KeyEqual> > >
+        typedef hpx::components::simple_component_base<
+                partition_unordered_map<Key, T, Hash, KeyEqual> >
             base_type;
 
     private:
-        data_type partition_unordered_map_;
+        storage_type partition_unordered_map_;
 
     public:
         ///////////////////////////////////////////////////////////////////////
@@ -125,14 +133,27 @@ namespace hpx { namespace server
         /// Duplicate the copy method for action naming
         data_type get_copied_data() const
         {
-            return partition_unordered_map_;
+            data_type data;
+            data.reserve(partition_unordered_map_.size());
+            partition_unordered_map_.for_each(
+                [&](typename storage_type::value_type const& v)
+                {
+                    data.insert(v);
+                });
+            return data;
         }
         void set_copied_data(data_type && d)
         {
-            partition_unordered_map_ = std::move(d);
+            partition_unordered_map_.clear();
+            partition_unordered_map_.reserve(d.size());
+            for (auto& v : d)
+                partition_unordered_map_.insert_or_assign(
+                    v.first, std::move(v.second));
         }
 
         ///////////////////////////////////////////////////////////////////////
+        // The iterators traverse the flat storage, they must not be used
+        // while the partition is being modified concurrently.
         iterator_type begin()
         {
             return partition_unordered_map_.begin();
@@ -176,7 +197,7 @@ namespace hpx { namespace server
         }
 
         /// Returns the number of elements that the container has currently
-        /// allocated space for.
+        /// allocated slots for.
         size_type capacity() const
         {
             return partition_unordered_map_.capacity();
@@ -201,36 +222,20 @@ namespace hpx { namespace server
         /// \return Return the value of the element at position represented
         ///         by \a pos.
         ///
-        struct erase_on_exit
-        {
-            erase_on_exit(data_type& m, typename data_type::iterator& it)
-              : m_(m), it_(it)
-            {}
-            ~erase_on_exit()
-            {
-                m_.erase(it_);
-            }
-
-            data_type& m_;
-            typename data_type::iterator& it_;
-        };
-
         T get_value(Key const& key, bool erase)
         {
-            typename data_type::iterator it = partition_unordered_map_.find(key);
-            if (it == partition_unordered_map_.end())
+            // look up and remove the element atomically
+            util::optional<T> value = erase ?
+                partition_unordered_map_.extract(key) :
+                partition_unordered_map_.find(key);
+            if (!value)
             {
                 HPX_THROW_EXCEPTION(bad_parameter,
                     "partition_unordered_map::get_value",
                     "unable to find requested key in this partition of the "
                     "unordered_map");
             }
-
-            if (!erase)
-                return it->second;
-
-            erase_on_exit t(partition_unordered_map_, it);
-            return it->second;
+            return std::move(*value);
         }
 
         /// Return the element at the position \a pos in the partition_unordered_map
@@ -248,9 +253,8 @@ namespace hpx { namespace server
 
             for (std::size_t i = 0; i != keys.size(); ++i)
             {
-                typename data_type::iterator it =
-                    partition_unordered_map_.find(keys[i]);
-                if (it == partition_unordered_map_.end())
+                util::optional<T> value = partition_unordered_map_.find(keys[i]);
+                if (!value)
                 {
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "partition_unordered_map::get_values",
@@ -258,7 +262,7 @@ namespace hpx { namespace server
                         "unordered_map");
                     break;
                 }
-                result.push_back(it->second);
+                result.push_back(std::move(*value));
             }
             return result;
         }
@@ -276,7 +280,7 @@ namespace hpx { namespace server
         ///
         void set_value(Key const& pos, T const& val)
         {
-            partition_unordered_map_[pos] = val;
+            partition_unordered_map_.insert_or_assign(pos, val);
         }
 
         /// Copy the value of \a val for the elements at positions \a pos in
@@ -290,10 +294,13 @@ namespace hpx { namespace server
             std::vector<T> const& val)
         {
             HPX_ASSERT(keys.size() == val.size());
-            HPX_ASSERT(keys.size() <= partition_unordered_map_.size());
+
+            // avoid rehashing while inserting large batches of new keys
+            partition_unordered_map_.reserve(
+                partition_unordered_map_.size() + keys.size());
 
             for (std::size_t i = 0; i != keys.size(); ++i)
-                partition_unordered_map_[keys[i]] = val[i];
+                partition_unordered_map_.insert_or_assign(keys[i], val[i]);
         }
 
         /// Remove all elements from the vector leaving the
@@ -310,17 +317,29 @@ namespace hpx { namespace server
             return partition_unordered_map_.erase(key);
         }
 
+        /// Erase the elements with the given keys
+        std::size_t erase_values(std::vector<Key> const& keys)
+        {
+            std::size_t count = 0;
+            for (Key const& key : keys)
+                count += partition_unordered_map_.erase(key);
+            return count;
+        }
+
         /// Macros to define HPX component actions for all exported functions.
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, size);
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, get_value);
-        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, get_values);
-
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, set_value);
-        HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, set_values);
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, erase);
 
+        // the batched operations are not direct actions to allow for the
+        // batches sent to the partitions of one locality to run in parallel
+        HPX_DEFINE_COMPONENT_ACTION(partition_unordered_map, get_values);
+        HPX_DEFINE_COMPONENT_ACTION(partition_unordered_map, set_values);
+        HPX_DEFINE_COMPONENT_ACTION(partition_unordered_map, erase_values);
+
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, get_copied_data);
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, set_copied_data);
     };
@@ -369,6 +388,9 @@ namespace hpx { namespace server
     HPX_REGISTER_ACTION_DECLARATION(                                          \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::erase_action,          \
         HPX_PP_CAT(__unordered_map_erase_action_, name));                     \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::erase_values_action,   \
+        HPX_PP_CAT(__unordered_map_erase_values_action_, name));              \
     HPX_REGISTER_ACTION_DECLARATION(                                          \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::get_copied_data_action,\
         HPX_PP_CAT(__unordered_map_get_copied_data_action_, name));           \
@@ -428,6 +450,9 @@ namespace hpx { namespace server
     HPX_REGISTER_ACTION(                                                      \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::erase_action,          \
         HPX_PP_CAT(__unordered_map_erase_action_, name));                     \
+    HPX_REGISTER_ACTION(                                                      \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::erase_values_action,   \
+        HPX_PP_CAT(__unordered_map_erase_values_action_, name));              \
     HPX_REGISTER_ACTION(                                                      \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::get_copied_data_action,\
         HPX_PP_CAT(__unordered_map_get_copied_data_action_, name));           \
@@ -649,6 +674,34 @@ namespace hpx
                 this->get_id(), key);
         }
 
+        /// Erase all values with the given keys from the
+        /// partition_unordered_map container.
+        ///
+        /// \param keys  Keys of the elements in the partition_unordered_map
+        ///
+        /// \return Returns the number of elements erased
+        ///
+        std::size_t erase_values(
+            launch::sync_policy, std::vector<Key> const& keys)
+        {
+            return erase_values(keys).get();
+        }
+
+        /// Erase all values with the given keys from the
+        /// partition_unordered_map container.
+        ///
+        /// \param keys  Keys of the elements in the partition_unordered_map
+        ///
+        /// \return This returns the hpx::future containing the number of
+        ///         elements erased
+        ///
+        future<std::size_t> erase_values(std::vector<Key> const& keys)
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<typename server_type::erase_values_action>(
+                this->get_id(), keys);
+        }
+
         /// Get/set all the data of this partition
         future<typename server_type::data_type> get_data() const
         {
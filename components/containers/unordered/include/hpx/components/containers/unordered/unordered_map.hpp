@@ -11,6 +11,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assertion.hpp>
+#include <hpx/lcos/dataflow.hpp>
 #include <hpx/lcos/wait_all.hpp>
 #include <hpx/runtime/components/client_base.hpp>
 #include <hpx/runtime/components/component_type.hpp>
@@ -336,6 +337,26 @@ namespace hpx
             return this->hasher_(key) % partitions_.size();
         }
 
+        // Sort the given keys by the partitions they belong to, optionally
+        // return the positions of the keys in the original sequence
+        std::vector<std::vector<Key> > bucket_keys(
+            std::vector<Key> const& keys,
+            std::vector<std::vector<std::size_t> >* positions = nullptr) const
+        {
+            std::vector<std::vector<Key> > part_keys(partitions_.size());
+            if (positions != nullptr)
+                positions->resize(partitions_.size());
+
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                std::size_t part = get_partition(keys[i]);
+                part_keys[part].push_back(keys[i]);
+                if (positions != nullptr)
+                    (*positions)[part].push_back(i);
+            }
+            return part_keys;
+        }
+
         std::vector<hpx::id_type> get_partition_ids() const
         {
             std::vector<hpx::id_type> ids;
@@ -834,6 +855,181 @@ namespace hpx
                 part_data.partition_).erase(key);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Batched operations: the keys are sorted by partition locally, each
+        // partition receives a single action for all of its keys.
+
+        /// Returns the elements with the given keys in the unordered_map
+        /// container.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the values of the elements in the order of the
+        ///         given keys.
+        ///
+        std::vector<T> get_values(launch::sync_policy,
+            std::vector<Key> const& keys) const
+        {
+            return get_values(keys).get();
+        }
+
+        /// Returns the elements with the given keys in the unordered_map
+        /// container asynchronously.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the hpx::future to the values of the elements in
+        ///         the order of the given keys.
+        ///
+        future<std::vector<T> > get_values(std::vector<Key> const& keys) const
+        {
+            std::vector<std::vector<std::size_t> > positions;
+            std::vector<std::vector<Key> > part_keys =
+                bucket_keys(keys, &positions);
+
+            std::vector<future<std::vector<T> > > values;
+            values.reserve(part_keys.size());
+            for (std::size_t part = 0; part != part_keys.size(); ++part)
+            {
+                if (part_keys[part].empty())
+                {
+                    values.push_back(make_ready_future(std::vector<T>()));
+                    continue;
+                }
+
+                values.push_back(partition_unordered_map_client(
+                    partitions_[part].partition_).get_values(part_keys[part]));
+            }
+
+            std::size_t const size = keys.size();
+            return hpx::dataflow(
+                [size, positions = std::move(positions)](
+                    std::vector<future<std::vector<T> > >&& values)
+                -> std::vector<T>
+                {
+                    std::vector<T> result(size);
+                    for (std::size_t part = 0; part != values.size(); ++part)
+                    {
+                        std::vector<T> part_values = values[part].get();
+                        std::vector<std::size_t> const& part_positions =
+                            positions[part];
+
+                        HPX_ASSERT(part_values.size() == part_positions.size());
+                        for (std::size_t i = 0; i != part_values.size(); ++i)
+                        {
+                            result[part_positions[i]] =
+                                std::move(part_values[i]);
+                        }
+                    }
+                    return result;
+                },
+                std::move(values));
+        }
+
+        /// Copy the values \a vals to the elements with the given keys in the
+        /// unordered_map container.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        void set_values(launch::sync_policy, std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            set_values(keys, vals).get();
+        }
+
+        /// Asynchronously copy the values \a vals to the elements with the
+        /// given keys in the unordered_map container.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_values(std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            HPX_ASSERT(keys.size() == vals.size());
+
+            std::vector<std::vector<std::size_t> > positions;
+            std::vector<std::vector<Key> > part_keys =
+                bucket_keys(keys, &positions);
+
+            std::vector<future<void> > results;
+            results.reserve(part_keys.size());
+            for (std::size_t part = 0; part != part_keys.size(); ++part)
+            {
+                if (part_keys[part].empty())
+                    continue;
+
+                std::vector<T> part_vals;
+                part_vals.reserve(positions[part].size());
+                for (std::size_t pos : positions[part])
+                    part_vals.push_back(vals[pos]);
+
+                results.push_back(partition_unordered_map_client(
+                    partitions_[part].partition_)
+                        .set_values(part_keys[part], part_vals));
+            }
+
+            return hpx::dataflow(
+                [](std::vector<future<void> >&& results) -> void
+                {
+                    for (future<void>& f : results)
+                        f.get();
+                },
+                std::move(results));
+        }
+
+        /// Erase all values with the given keys from the unordered_map
+        /// container.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the number of elements erased
+        ///
+        std::size_t erase_values(
+            launch::sync_policy, std::vector<Key> const& keys)
+        {
+            return erase_values(keys).get();
+        }
+
+        /// Asynchronously erase all values with the given keys from the
+        /// unordered_map container.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return This returns the hpx::future containing the number of
+        ///         elements erased
+        ///
+        future<std::size_t> erase_values(std::vector<Key> const& keys)
+        {
+            std::vector<std::vector<Key> > part_keys = bucket_keys(keys);
+
+            std::vector<future<std::size_t> > counts;
+            counts.reserve(part_keys.size());
+            for (std::size_t part = 0; part != part_keys.size(); ++part)
+            {
+                if (part_keys[part].empty())
+                    continue;
+
+                counts.push_back(partition_unordered_map_client(
+                    partitions_[part].partition_)
+                        .erase_values(part_keys[part]));
+            }
+
+            return hpx::dataflow(
+                [](std::vector<future<std::size_t> >&& counts) -> std::size_t
+                {
+                    std::size_t count = 0;
+                    for (future<std::size_t>& f : counts)
+                        count += f.get();
+                    return count;
+                },
+                std::move(counts));
+        }
+
         ///////////////////////////////////////////////////////////////////////
         typedef segment_unordered_map_iterator<
                 Key, T, Hash, KeyEqual,
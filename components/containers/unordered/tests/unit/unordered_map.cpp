@@ -5,6 +5,7 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/hpx_main.hpp>
+#include <hpx/include/lcos.hpp>
 #include <hpx/include/traits.hpp>
 #include <hpx/include/unordered_map.hpp>
 #include <hpx/testing.hpp>
@@ -76,6 +77,93 @@ void fill_unordered_map(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m,
     HPX_TEST_EQ(m.size(), count);
 }
 
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void test_bulk_operations(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m)
+{
+    std::size_t const count = 1007;
+
+    std::vector<Key> keys;
+    std::vector<Value> values;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        keys.push_back("bulk" + std::to_string(i));
+        values.push_back(Value(i));
+    }
+
+    std::size_t size = m.size();
+
+    m.set_values(hpx::launch::sync, keys, values);
+    HPX_TEST_EQ(m.size(), size + count);
+
+    // the values are returned in the order of the keys
+    std::vector<Key> reversed_keys(keys.rbegin(), keys.rend());
+    std::vector<Value> reversed_values =
+        m.get_values(reversed_keys).get();
+    HPX_TEST(std::equal(values.rbegin(), values.rend(),
+        reversed_values.begin(), reversed_values.end()));
+
+    for (std::size_t i = 0; i < count; i += 101)
+    {
+        HPX_TEST_EQ(m[keys[i]], values[i]);
+    }
+
+    // erase every other key, erasing missing keys is not an error
+    std::vector<Key> erase_keys;
+    for (std::size_t i = 0; i < count; i += 2)
+        erase_keys.push_back(keys[i]);
+    erase_keys.push_back("not_a_key");
+
+    HPX_TEST_EQ(m.erase_values(hpx::launch::sync, erase_keys),
+        (count + 1) / 2);
+    HPX_TEST_EQ(m.size(), size + count / 2);
+
+    HPX_TEST_EQ(m.erase_values(keys).get(), count / 2);
+    HPX_TEST_EQ(m.size(), size);
+}
+
+// many threads accessing the same partitions at the same time
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void test_concurrent_access(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m)
+{
+    std::size_t const num_tasks = 16;
+    std::size_t const count = 257;
+
+    std::size_t size = m.size();
+
+    std::vector<hpx::future<void> > tasks;
+    for (std::size_t t = 0; t != num_tasks; ++t)
+    {
+        tasks.push_back(hpx::async([&m, t]()
+        {
+            std::string const prefix = "task" + std::to_string(t) + "_";
+
+            for (std::size_t i = 0; i != count; ++i)
+                m.set_value(hpx::launch::sync, prefix + std::to_string(i),
+                    Value(i));
+
+            for (std::size_t i = 0; i != count; ++i)
+                HPX_TEST_EQ(m.get_value(hpx::launch::sync,
+                    prefix + std::to_string(i)), Value(i));
+
+            for (std::size_t i = 0; i < count; i += 2)
+                HPX_TEST_EQ(m.erase(hpx::launch::sync,
+                    prefix + std::to_string(i)), std::size_t(1));
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    HPX_TEST_EQ(m.size(), size + num_tasks * (count / 2));
+
+    for (std::size_t t = 0; t != num_tasks; ++t)
+    {
+        std::string const prefix = "task" + std::to_string(t) + "_";
+        for (std::size_t i = 1; i < count; i += 2)
+            HPX_TEST_EQ(m.erase(hpx::launch::sync,
+                prefix + std::to_string(i)), std::size_t(1));
+    }
+    HPX_TEST_EQ(m.size(), size);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename Key, typename Value, typename DistPolicy>
 void trivial_tests(DistPolicy const& policy)
@@ -87,6 +175,9 @@ void trivial_tests(DistPolicy const& policy)
 
         fill_unordered_map(m, 107, Value(42));
         test_global_iteration(m, Value(42));
+
+        test_bulk_operations(m);
+        test_concurrent_access(m);
     }
 
     // bucket_count, hash
@@ -119,6 +210,9 @@ void trivial_tests()
 
         fill_unordered_map(m, 107, Value(42));
         test_global_iteration(m, Value(42));
+
+        test_bulk_operations(m);
+        test_concurrent_access(m);
     }
 
     // bucket_count
@@ -197,12 +197,18 @@ namespace hpx { namespace lcos { namespace detail {
     {
         future_data_base()
           : state_(empty)
+          , on_completed_(nullptr)
+          , inline_on_completed_used_(false)
+          , waiting_(0)
         {
         }
 
         future_data_base(init_no_addref no_addref)
           : future_data_refcnt_base(no_addref)
           , state_(empty)
+          , on_completed_(nullptr)
+          , inline_on_completed_used_(false)
+          , waiting_(0)
         {
         }
 
@@ -285,6 +291,28 @@ namespace hpx { namespace lcos { namespace detail {
 
         virtual std::exception_ptr get_exception_ptr() const = 0;
 
+    protected:
+        // Continuations are kept in an intrusive list which is updated using
+        // CAS only. The first continuation uses a node embedded into the
+        // shared state. Once the shared state is ready, the list head is
+        // replaced by a marker node, after which continuations are invoked
+        // right away instead of being attached.
+        struct completed_callback_node
+        {
+            completed_callback_type f_;
+            completed_callback_node* next_ = nullptr;
+        };
+
+        static completed_callback_node* on_completed_marker();
+
+        // Wake up waiting threads and invoke all continuations, this has to
+        // be called once after the state was changed to ready.
+        void handle_ready();
+
+        // release all continuations without invoking them
+        void reset_on_completed();
+
+    public:
         virtual std::string const& get_registered_name() const
         {
             HPX_THROW_EXCEPTION(invalid_status,
@@ -302,7 +330,10 @@ namespace hpx { namespace lcos { namespace detail {
     protected:
         mutable mutex_type mtx_;
         std::atomic<state> state_;    // current state
-        completed_callback_vector_type on_completed_;
+        std::atomic<completed_callback_node*> on_completed_;
+        completed_callback_node inline_on_completed_;
+        std::atomic<bool> inline_on_completed_used_;
+        std::atomic<std::size_t> waiting_;    // number of threads in wait
         local::detail::condition_variable cond_;    // threads waiting in read
     };
 
@@ -419,48 +450,23 @@ namespace hpx { namespace lcos { namespace detail {
             result_type* value_ptr = reinterpret_cast<result_type*>(&storage_);
             construct(value_ptr, std::forward<Ts>(ts)...);
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = std::move(on_completed_);
-            on_completed_.clear();
-
             // The value has been set, changing the state to 'value' at this
             // point signals to all other threads that this future is ready.
             state expected = empty;
             if (!state_.compare_exchange_strong(
-                    expected, value, std::memory_order_release))
+                    expected, value, std::memory_order_seq_cst))
             {
                 // this future should be 'empty' still (it can't be made ready
                 // more than once).
-                l.unlock();
                 HPX_THROW_EXCEPTION(promise_already_satisfied,
                     "future_data_base::set_value",
                     "data has already been set for this future");
                 return;
             }
 
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (
-                cond_.notify_one(std::move(l), threads::thread_priority_boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-
-            // invoke the callback (continuation) function
-            if (!on_completed.empty())
-                handle_on_completed(std::move(on_completed));
+            // handle all threads waiting for the future to become ready and
+            // invoke the callback (continuation) functions
+            handle_ready();
         }
 
         void set_exception(std::exception_ptr data) override
@@ -476,48 +482,23 @@ namespace hpx { namespace lcos { namespace detail {
                 reinterpret_cast<std::exception_ptr*>(&storage_);
             ::new ((void*) exception_ptr) std::exception_ptr(std::move(data));
 
-            // At this point the lock needs to be acquired to safely access the
-            // registered continuations
-            std::unique_lock<mutex_type> l(mtx_);
-
-            // handle all threads waiting for the future to become ready
-            auto on_completed = std::move(on_completed_);
-            on_completed_.clear();
-
             // The value has been set, changing the state to 'exception' at this
             // point signals to all other threads that this future is ready.
             state expected = empty;
             if (!state_.compare_exchange_strong(
-                    expected, exception, std::memory_order_release))
+                    expected, exception, std::memory_order_seq_cst))
             {
                 // this future should be 'empty' still (it can't be made ready
                 // more than once).
-                l.unlock();
                 HPX_THROW_EXCEPTION(promise_already_satisfied,
                     "future_data_base::set_exception",
                     "data has already been set for this future");
                 return;
             }
 
-            // Note: we use notify_one repeatedly instead of notify_all as we
-            //       know: a) that most of the time we have at most one thread
-            //       waiting on the future (most futures are not shared), and
-            //       b) our implementation of condition_variable::notify_one
-            //       relinquishes the lock before resuming the waiting thread
-            //       which avoids suspension of this thread when it tries to
-            //       re-lock the mutex while exiting from condition_variable::wait
-            while (
-                cond_.notify_one(std::move(l), threads::thread_priority_boost))
-            {
-                l = std::unique_lock<mutex_type>(mtx_);
-            }
-
-            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
-            //       it unlocked when returning.
-
-            // invoke the callback (continuation) function
-            if (!on_completed.empty())
-                handle_on_completed(std::move(on_completed));
+            // handle all threads waiting for the future to become ready and
+            // invoke the callback (continuation) functions
+            handle_ready();
         }
 
         // helper functions for setting data (if successful) or the error (if
@@ -604,7 +585,7 @@ namespace hpx { namespace lcos { namespace detail {
                 break;
             }
 
-            on_completed_.clear();
+            reset_on_completed();
         }
 
         std::exception_ptr get_exception_ptr() const override
@@ -615,7 +596,6 @@ namespace hpx { namespace lcos { namespace detail {
 
     protected:
         using base_type::mtx_;
-        using base_type::on_completed_;
         using base_type::state_;
 
     private:
@@ -86,6 +86,11 @@ namespace lcos {
               : alloc_(alloc)
             {}
 
+            promise_data_allocator(init_no_addref no_addref,
+                    other_allocator const& alloc)
+              : promise_data<Result>(no_addref), alloc_(alloc)
+            {}
+
             promise_data_allocator(init_no_addref no_addref, in_place in_place,
                     other_allocator const& alloc)
               : promise_data<Result>(no_addref), alloc_(alloc)
@@ -0,0 +1,252 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Helpers shared by the binary filters which write self-describing frames:
+// every flushed block starts with a small header recording whether the data
+// was compressed and how large it is when uncompressed. This allows to store
+// small or incompressible data as is and to decompress the data without
+// knowing its original size beforehand (as needed for checkpoints). Frames
+// compressed using a dictionary additionally record a hash of the
+// dictionary, which allows to detect a receiver using a different one.
+
+#if !defined(HPX_PLUGINS_BINARY_FILTER_COMPRESSION_FRAME_HPP)
+#define HPX_PLUGINS_BINARY_FILTER_COMPRESSION_FRAME_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/errors.hpp>
+#include <hpx/runtime/config_entry.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace hpx { namespace plugins { namespace compression
+{
+    ///////////////////////////////////////////////////////////////////////////
+    enum class frame_method : std::uint8_t
+    {
+        stored = 0,                        // data was stored uncompressed
+        compressed = 1,                    // data was compressed
+        compressed_with_dictionary = 2     // compressed using a dictionary
+    };
+
+    struct frame_header
+    {
+        frame_method method_;
+        std::uint64_t size_;                // size of the uncompressed data
+        std::uint64_t compressed_size_;     // size of the data in the frame
+        std::uint64_t dictionary_hash_;     // for dictionary frames only
+    };
+
+    // the header is written byte-wise (little endian) to stay independent
+    // of the endianness of the involved localities
+    constexpr std::size_t frame_header_size = 1 + 2 * sizeof(std::uint64_t);
+    constexpr std::size_t dictionary_frame_header_size =
+        frame_header_size + sizeof(std::uint64_t);
+
+    inline std::size_t get_frame_header_size(frame_method method)
+    {
+        return method == frame_method::compressed_with_dictionary ?
+            dictionary_frame_header_size :
+            frame_header_size;
+    }
+
+    // The hash identifying a dictionary (64 bit FNV-1a), this is computed
+    // byte-wise to give the same value on all localities.
+    inline std::uint64_t get_dictionary_hash(std::vector<char> const& dict)
+    {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (char c : dict)
+        {
+            hash ^= static_cast<std::uint8_t>(c);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    namespace detail
+    {
+        inline void write_uint64(char* dst, std::uint64_t value)
+        {
+            for (std::size_t i = 0; i != sizeof(std::uint64_t); ++i)
+            {
+                dst[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+            }
+        }
+
+        inline std::uint64_t read_uint64(char const* src)
+        {
+            std::uint64_t value = 0;
+            for (std::size_t i = 0; i != sizeof(std::uint64_t); ++i)
+            {
+                value |= std::uint64_t(static_cast<std::uint8_t>(src[i]))
+                    << (8 * i);
+            }
+            return value;
+        }
+    }
+
+    // Write the frame header, the frame data has to be placed right after
+    // the get_frame_header_size(method) bytes written by this function.
+    inline void write_frame_header(char* dst, frame_method method,
+        std::uint64_t size, std::uint64_t compressed_size,
+        std::uint64_t dictionary_hash = 0)
+    {
+        dst[0] = static_cast<char>(method);
+        detail::write_uint64(dst + 1, size);
+        detail::write_uint64(dst + 1 + sizeof(std::uint64_t), compressed_size);
+        if (method == frame_method::compressed_with_dictionary)
+        {
+            detail::write_uint64(dst + frame_header_size, dictionary_hash);
+        }
+    }
+
+    // Read the frame header from the given buffer, verifies that the frame
+    // data is contained in the buffer as well. Stored frames are verified to
+    // hold exactly the uncompressed data, the uncompressed size of all other
+    // frames has to be checked by the filter before relying on it.
+    inline frame_header read_frame_header(char const* src, std::size_t size)
+    {
+        frame_header header{frame_method::stored, 0, 0, 0};
+        if (size >= frame_header_size &&
+            static_cast<std::uint8_t>(src[0]) <=
+                static_cast<std::uint8_t>(
+                    frame_method::compressed_with_dictionary))
+        {
+            header.method_ = static_cast<frame_method>(src[0]);
+            header.size_ = detail::read_uint64(src + 1);
+            header.compressed_size_ =
+                detail::read_uint64(src + 1 + sizeof(std::uint64_t));
+
+            std::size_t const header_size =
+                get_frame_header_size(header.method_);
+            if (size >= header_size &&
+                header.compressed_size_ <= size - header_size &&
+                (header.method_ != frame_method::stored ||
+                    header.compressed_size_ == header.size_))
+            {
+                if (header.method_ == frame_method::compressed_with_dictionary)
+                {
+                    header.dictionary_hash_ =
+                        detail::read_uint64(src + frame_header_size);
+                }
+                return header;
+            }
+        }
+
+        HPX_THROW_EXCEPTION(serialization_error,
+            "compression::read_frame_header",
+            "archive data bstream is corrupted");
+        return header;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Estimate the Shannon entropy (in bits per byte) of the given data.
+    // Large buffers are sampled at evenly spaced positions only, which is
+    // sufficient to detect already compressed or random data.
+    inline double estimate_entropy(char const* data, std::size_t size,
+        std::size_t sample_size = 4096)
+    {
+        if (size == 0)
+            return 0.0;
+
+        std::array<std::size_t, 256> histogram = {};
+        std::size_t count = 0;
+
+        if (size <= sample_size)
+        {
+            for (std::size_t i = 0; i != size; ++i)
+                ++histogram[static_cast<std::uint8_t>(data[i])];
+            count = size;
+        }
+        else
+        {
+            // use contiguous blocks to see the local structure of the data
+            std::size_t const num_blocks = 16;
+            std::size_t const block_size = sample_size / num_blocks;
+            std::size_t const stride = (size - block_size) / (num_blocks - 1);
+
+            for (std::size_t b = 0; b != num_blocks; ++b)
+            {
+                char const* block = data + b * stride;
+                for (std::size_t i = 0; i != block_size; ++i)
+                    ++histogram[static_cast<std::uint8_t>(block[i])];
+            }
+            count = num_blocks * block_size;
+        }
+
+        double entropy = 0.0;
+        for (std::size_t n : histogram)
+        {
+            if (n != 0)
+            {
+                double const p = double(n) / double(count);
+                entropy -= p * std::log2(p);
+            }
+        }
+        return entropy;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Decides whether a block of data is worth compressing. This is driven
+    // by the configuration entries hpx.plugins.<filter>.min_size (blocks
+    // smaller than this are stored as is) and
+    // hpx.plugins.<filter>.max_entropy (blocks with a higher estimated
+    // entropy in bits per byte are considered to be incompressible).
+    struct compression_threshold
+    {
+        explicit compression_threshold(std::string const& filter_name)
+          : min_size_(std::stoull(get_config_entry(
+                "hpx.plugins." + filter_name + ".min_size", "256")))
+          , max_entropy_(std::stod(get_config_entry(
+                "hpx.plugins." + filter_name + ".max_entropy", "7.5")))
+        {
+        }
+
+        bool should_compress(char const* data, std::size_t size) const
+        {
+            if (size < min_size_)
+                return false;
+
+            return max_entropy_ >= 8.0 ||
+                estimate_entropy(data, size) <= max_entropy_;
+        }
+
+        std::size_t min_size_;
+        double max_entropy_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Load the dictionary referred to by the configuration entry
+    // hpx.plugins.<filter>.dictionary, returns an empty buffer if no
+    // dictionary was specified.
+    inline std::vector<char> load_dictionary(std::string const& filter_name)
+    {
+        std::string const path = get_config_entry(
+            "hpx.plugins." + filter_name + ".dictionary", "");
+        if (path.empty())
+            return std::vector<char>();
+
+        std::ifstream in(path, std::ios::binary);
+        if (!in)
+        {
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "compression::load_dictionary",
+                "could not open the compression dictionary: " + path);
+            return std::vector<char>();
+        }
+
+        return std::vector<char>(std::istreambuf_iterator<char>(in),
+            std::istreambuf_iterator<char>());
+    }
+}}}
+
+#endif
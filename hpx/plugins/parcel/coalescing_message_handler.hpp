@@ -61,6 +61,9 @@ namespace hpx { namespace plugins { namespace parcel
         std::int64_t get_messages_count(bool reset);
         std::int64_t get_parcels_per_message_count(bool reset);
         std::int64_t get_average_time_between_parcels(bool reset);
+        std::int64_t get_batch_size(bool reset);
+        std::int64_t get_flush_interval(bool reset);
+        std::int64_t get_send_latency(bool reset);
         std::vector<std::int64_t>
             get_time_between_parcels_histogram(bool reset);
         void get_time_between_parcels_histogram_creator(
@@ -79,6 +82,12 @@ namespace hpx { namespace plugins { namespace parcel
 
         void update_num_messages();
         void update_interval();
+        void update_adaptive();
+
+        // adaptive coalescing
+        void update_adaptive_parameters(std::int64_t time_since_last_parcel);
+        write_handler_type measure_send_latency(write_handler_type&& f);
+        void record_send_latency(std::int64_t send_latency);
 
     private:
         mutable mutex_type mtx_;
@@ -91,6 +100,16 @@ namespace hpx { namespace plugins { namespace parcel
         bool allow_background_flush_;
         std::string action_name_;
 
+        // In adaptive mode the number of parcels per message and the flush
+        // interval are derived from the observed time between parcels and
+        // the time it takes to send a message. The configured values act as
+        // upper bounds.
+        bool adaptive_;
+        double average_arrival_time_;       // [ns]
+        double average_send_latency_;       // [ns]
+        std::size_t batch_size_;
+        std::int64_t flush_interval_;       // [ns]
+
         // performance counter data
         std::int64_t num_parcels_;
         std::int64_t reset_num_parcels_;
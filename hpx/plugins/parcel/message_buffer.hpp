@@ -154,6 +154,15 @@ namespace hpx { namespace plugins { namespace parcel { namespace detail
 
         std::size_t capacity() const { return max_messages_; }
 
+        // Replace the handler of the first message in this buffer by the
+        // result of calling f with the original handler.
+        template <typename F>
+        void wrap_first_handler(F&& f)
+        {
+            HPX_ASSERT(!handlers_.empty());
+            handlers_[0] = f(std::move(handlers_[0]));
+        }
+
     private:
         parcelset::locality dest_;
         std::vector<parcelset::parcel> messages_;
@@ -27,7 +27,8 @@
 #include <hpx/runtime/naming/name.hpp>
 #include <hpx/runtime/parcelset_fwd.hpp>
 #include <hpx/state.hpp>
-#include <hpx/cache/lru_cache.hpp>
+#include <hpx/cache/clock_cache.hpp>
+#include <hpx/cache/sharded_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/util_fwd.hpp>
 #include <hpx/functional/function.hpp>
@@ -74,18 +75,22 @@ public:
 
     // {{{ gva cache
     struct gva_cache_key;
-
-    typedef hpx::util::cache::lru_cache<
-        gva_cache_key
-      , gva
-      , hpx::util::cache::statistics::local_full_statistics
+    struct gva_cache_shard_selector;
+
+    typedef hpx::util::cache::sharded_cache<
+        hpx::util::cache::clock_cache<
+            gva_cache_key
+          , gva
+          , hpx::util::cache::statistics::local_full_statistics
+        >
+      , mutex_type
+      , gva_cache_shard_selector
     > gva_cache_type;
     // }}}
 
     typedef std::set<naming::gid_type> migrated_objects_table_type;
     typedef std::map<naming::gid_type, std::int64_t> refcnt_requests_type;
 
-    mutable mutex_type gva_cache_mtx_;
     std::shared_ptr<gva_cache_type> gva_cache_;
 
     mutable mutex_type migrated_objects_mtx_;
@@ -0,0 +1,153 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_RUNTIME_AGAS_DETAIL_SHARDED_TABLE_HPP)
+#define HPX_RUNTIME_AGAS_DETAIL_SHARDED_TABLE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace agas { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Contention statistics of a lock protecting (part of) a table
+    struct table_lock_statistics
+    {
+        table_lock_statistics()
+          : acquisitions_(0)
+          , contentions_(0)
+          , wait_time_(0)
+        {}
+
+        // Acquire the given lock, recording whether it had to wait for
+        // another thread releasing it first.
+        template <typename Mutex>
+        std::unique_lock<Mutex> lock(Mutex& mtx)
+        {
+            std::unique_lock<Mutex> l(mtx, std::try_to_lock);
+            if (!l.owns_lock())
+            {
+                std::uint64_t start = util::high_resolution_clock::now();
+                l.lock();
+
+                contentions_.fetch_add(1, std::memory_order_relaxed);
+                wait_time_.fetch_add(
+                    std::int64_t(util::high_resolution_clock::now() - start),
+                    std::memory_order_relaxed);
+            }
+            acquisitions_.fetch_add(1, std::memory_order_relaxed);
+            return l;
+        }
+
+        static std::int64_t get_value(
+            std::atomic<std::int64_t>& value, bool reset)
+        {
+            return reset ? value.exchange(0, std::memory_order_relaxed) :
+                           value.load(std::memory_order_relaxed);
+        }
+
+        std::atomic<std::int64_t> acquisitions_;
+        std::atomic<std::int64_t> contentions_;
+        std::atomic<std::int64_t> wait_time_;     // [ns]
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A hash table split into a fixed number of independently locked shards.
+    // All operations on a key are performed on the shard the key hashes to
+    // while holding the lock of that shard only.
+    template <typename Key, typename T, typename Mutex,
+        typename Hash = std::hash<Key>>
+    class sharded_table
+    {
+    public:
+        typedef Mutex mutex_type;
+        typedef std::unordered_map<Key, T, Hash> map_type;
+
+        struct shard
+        {
+            mutex_type mtx_;
+            map_type map_;
+            table_lock_statistics statistics_;
+        };
+
+        explicit sharded_table(std::size_t num_shards = 64)
+        {
+            if (num_shards == 0)
+                num_shards = 1;
+
+            // each shard is allocated separately to avoid false sharing
+            // between the locks of neighboring shards
+            shards_.reserve(num_shards);
+            for (std::size_t i = 0; i != num_shards; ++i)
+            {
+                shards_.emplace_back(new shard);
+            }
+        }
+
+        sharded_table(sharded_table const&) = delete;
+        sharded_table& operator=(sharded_table const&) = delete;
+
+        shard& get_shard(Key const& key)
+        {
+            return *shards_[Hash()(key) % shards_.size()];
+        }
+
+        // lock the shard responsible for the given key
+        std::unique_lock<mutex_type> lock(shard& s)
+        {
+            return s.statistics_.lock(s.mtx_);
+        }
+
+        std::size_t num_shards() const
+        {
+            return shards_.size();
+        }
+
+        // accumulated lock statistics of all shards
+        std::int64_t get_acquisitions(bool reset)
+        {
+            return accumulate(&table_lock_statistics::acquisitions_, reset);
+        }
+
+        std::int64_t get_contentions(bool reset)
+        {
+            return accumulate(&table_lock_statistics::contentions_, reset);
+        }
+
+        std::int64_t get_wait_time(bool reset)
+        {
+            return accumulate(&table_lock_statistics::wait_time_, reset);
+        }
+
+    private:
+        std::int64_t accumulate(
+            std::atomic<std::int64_t> table_lock_statistics::*value,
+            bool reset)
+        {
+            std::int64_t result = 0;
+            for (auto& s : shards_)
+            {
+                result += table_lock_statistics::get_value(
+                    s->statistics_.*value, reset);
+            }
+            return result;
+        }
+
+        std::vector<std::unique_ptr<shard>> shards_;
+    };
+}}}
+
+#endif
@@ -15,6 +15,7 @@
 #include <hpx/lcos/base_lco_with_value.hpp>
 #include <hpx/synchronization/condition_variable.hpp>
 #include <hpx/runtime/agas_fwd.hpp>
+#include <hpx/runtime/agas/detail/sharded_table.hpp>
 #include <hpx/runtime/agas/gva.hpp>
 #include <hpx/runtime/actions/component_action.hpp>
 #include <hpx/runtime/components/server/fixed_component_base.hpp>
@@ -121,19 +122,35 @@ struct HPX_EXPORT primary_namespace
     typedef std::int32_t component_type;
 
     typedef std::pair<gva, naming::gid_type> gva_table_data_type;
-    typedef std::map<naming::gid_type, gva_table_data_type> gva_table_type;
-    typedef std::map<naming::gid_type, std::int64_t> refcnt_table_type;
+
+    // bindings of single objects (count <= 1)
+    typedef detail::sharded_table<naming::gid_type, gva_table_data_type,
+        mutex_type> gva_table_type;
+
+    // bindings of ranges of objects (count > 1), these have to be ordered
+    // to be able to find the range an id belongs to
+    typedef std::map<naming::gid_type, gva_table_data_type>
+        gva_range_table_type;
+
+    typedef detail::sharded_table<naming::gid_type, std::int64_t, mutex_type>
+        refcnt_table_type;
 
     typedef hpx::util::tuple<naming::gid_type, gva, naming::gid_type>
         resolved_type;
     // }}}
 
   private:
-    // REVIEW: Separate mutexes might reduce contention here. This has to be
-    // investigated carefully.
+    // protects the migration table only, the GVA and the reference count
+    // tables are protected by their own locks
     mutex_type mutex_;
 
     gva_table_type gvas_;
+
+    mutex_type gva_ranges_mtx_;
+    detail::table_lock_statistics gva_ranges_statistics_;
+    gva_range_table_type gva_ranges_;
+    std::atomic<std::size_t> num_gva_ranges_;
+
     refcnt_table_type refcnts_;
     typedef std::map<
             naming::gid_type,
@@ -222,14 +239,10 @@ struct HPX_EXPORT primary_namespace
     counter_data counter_data_;
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-    /// Dump the credit counts of all matching ranges. Expects that \p l
-    /// is locked.
+    /// Dump the credit counts of all ids in the given range.
     void dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it
-      , refcnt_table_type::iterator upper_it
-      , naming::gid_type const& lower
+        naming::gid_type const& lower
       , naming::gid_type const& upper
-      , std::unique_lock<mutex_type>& l
       , const char* func_name
         );
 #endif
@@ -242,6 +255,7 @@ public:
     primary_namespace()
       : base_type(HPX_AGAS_PRIMARY_NS_MSB, HPX_AGAS_PRIMARY_NS_LSB)
       , mutex_()
+      , num_gva_ranges_(0)
       , instance_name_()
       , next_id_(naming::invalid_gid)
       , locality_(naming::invalid_gid)
@@ -263,6 +277,12 @@ public:
         error_code& ec = throws
         );
 
+    /// Register the performance counters exposing the lock contention of the
+    /// GVA and reference count tables of this instance.
+    void register_table_counter_types(
+        error_code& ec = throws
+        );
+
     void register_server_instance(
         char const* servicename
       , std::uint32_t locality_id = naming::invalid_locality_id
@@ -304,7 +324,17 @@ public:
 
     naming::gid_type statistics_counter(std::string const& name);
 
+    // access lock statistics of the GVA and reference count tables
+    std::int64_t get_gva_table_acquisitions(bool reset);
+    std::int64_t get_gva_table_contentions(bool reset);
+    std::int64_t get_gva_table_wait_time(bool reset);
+    std::int64_t get_refcnt_table_acquisitions(bool reset);
+    std::int64_t get_refcnt_table_contentions(bool reset);
+    std::int64_t get_refcnt_table_wait_time(bool reset);
+
   private:
+    // The lock l protects the migration table, it is unlocked before an
+    // error is reported (if it is owned).
     resolved_type resolve_gid_locked(
         std::unique_lock<mutex_type>& l
       , naming::gid_type const& gid
@@ -336,8 +366,7 @@ public:
         std::list<free_entry, free_entry_allocator_type>;
 
     void resolve_free_list(
-        std::unique_lock<mutex_type>& l
-      , std::list<refcnt_table_type::iterator> const& free_list
+        std::vector<naming::gid_type> const& free_list
       , free_entry_list_type& free_entry_list
       , naming::gid_type const& lower
       , naming::gid_type const& upper
@@ -93,6 +93,7 @@ namespace hpx { namespace components { namespace detail
 
         std::size_t size() const override;
         std::size_t free_size() const override;
+        void const* pool_address() const override;
 
         bool is_empty() const;
         bool has_allocatable_slots() const;
@@ -11,9 +11,9 @@
 #include <hpx/runtime/naming/name.hpp>
 #include <hpx/util/generate_unique_ids.hpp>
 #include <hpx/util/one_size_heap_list.hpp>
-#include <hpx/thread_support/unlock_guard.hpp>
 
 #include <iostream>
+#include <memory>
 #include <type_traits>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -53,18 +53,10 @@ namespace hpx { namespace components { namespace detail
         ///
         naming::gid_type get_gid(void* p)
         {
-            typename base_type::unique_lock_type guard(this->mtx_);
-
-            typedef typename base_type::const_iterator iterator;
-            iterator end = this->heap_list_.end();
-            for (iterator it = this->heap_list_.begin(); it != end; ++it)
-            {
-                if ((*it)->did_alloc(p))
-                {
-                    util::unlock_guard<typename base_type::unique_lock_type> ul(guard);
-                    return (*it)->get_gid(id_range_, p, type_);
-                }
-            }
+            std::shared_ptr<util::wrapper_heap_base> heap =
+                this->find_heap(p);
+            if (heap)
+                return heap->get_gid(id_range_, p, type_);
             return naming::invalid_gid;
         }
 
@@ -32,6 +32,7 @@
 #include <cstdint>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <sstream>
 #include <utility>
 #include <vector>
@@ -106,6 +107,46 @@ namespace hpx { namespace parcelset
         return chunks;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Take over the ownership of the received zero-copy chunks. This allows
+    // for the de-serialized data (e.g. serialize_buffer) to alias the chunk
+    // memory instead of copying it. Moving the chunk buffers does not change
+    // the location of their data, the pointer chunks created by
+    // decode_chunks stay valid.
+    template <typename Buffer>
+    std::vector<std::shared_ptr<void>> take_chunks(Buffer& buffer,
+        std::vector<serialization::serialization_chunk> const& chunks)
+    {
+        typedef typename Buffer::transmission_chunk_type transmission_chunk_type;
+        typedef typename decltype(buffer.chunks_)::value_type chunk_type;
+
+        std::vector<std::shared_ptr<void>> owners;
+
+        std::size_t num_zero_copy_chunks =
+            static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer.num_chunks_.first));
+
+        if (num_zero_copy_chunks != 0)
+        {
+            owners.resize(chunks.size());
+            for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+            {
+                transmission_chunk_type& c = buffer.transmission_chunks_[i];
+                std::size_t first = static_cast<std::size_t>(
+                    static_cast<std::uint64_t>(c.first));
+
+                auto owner =
+                    std::make_shared<chunk_type>(std::move(buffer.chunks_[i]));
+
+                HPX_ASSERT(chunks[first].data_.cpos_ == owner->data());
+                owners[first] = std::move(owner);
+            }
+            buffer.chunks_.clear();
+        }
+
+        return owners;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Parcelport, typename Buffer>
     void decode_message_with_chunks(
@@ -114,6 +155,7 @@ namespace hpx { namespace parcelset
       , std::size_t parcel_count
       , std::vector<serialization::serialization_chunk> &chunks
       , std::size_t num_thread = -1
+      , std::vector<std::shared_ptr<void>> const* chunk_owners = nullptr
     )
     {
         std::size_t inbound_data_size = static_cast<std::size_t>(
@@ -130,9 +172,10 @@ namespace hpx { namespace parcelset
 
                 {
                     std::vector<parcel> deferred_parcels;
-                    // De-serialize the parcel data
+                    // De-serialize the parcel data, the archive reads from
+                    // std::vector<char> buffers without virtual dispatch
                     serialization::input_archive archive(buffer.data_,
-                        inbound_data_size, &chunks);
+                        inbound_data_size, &chunks, chunk_owners);
 
                     if(parcel_count == 0)
                     {
@@ -285,8 +328,10 @@ namespace hpx { namespace parcelset
     {
         std::vector<serialization::serialization_chunk>
             chunks(decode_chunks(buffer));
+        std::vector<std::shared_ptr<void>>
+            chunk_owners(take_chunks(buffer, chunks));
         decode_message_with_chunks(pp, std::move(buffer),
-            parcel_count, chunks, num_thread);
+            parcel_count, chunks, num_thread, &chunk_owners);
     }
 
     template <typename Parcelport, typename Buffer>
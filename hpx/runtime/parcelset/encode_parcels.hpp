@@ -158,10 +158,6 @@ namespace hpx
                     std::unique_ptr<serialization::binary_filter> filter(
                         ps[0].get_serialization_filter());
 
-                    int archive_flags = archive_flags_;
-                    if (filter.get() != nullptr)
-                        archive_flags |= serialization::enable_compression;
-
                     // preallocate data
                     for (/**/; parcels_sent != parcels_size; ++parcels_sent)
                     {
@@ -171,6 +167,15 @@ namespace hpx
                         num_chunks += ps[parcels_sent].num_chunks();
                     }
 
+                    // compressing small messages does not pay off, send
+                    // those as they are
+                    if (arg_size < pp.get_compression_threshold())
+                        filter.reset();
+
+                    int archive_flags = archive_flags_;
+                    if (filter.get() != nullptr)
+                        archive_flags |= serialization::enable_compression;
+
                     buffer.data_.reserve(arg_size);
 
                     buffer.chunks_.reserve(num_chunks);
@@ -183,6 +188,9 @@ namespace hpx
                         if (filter.get() != nullptr)
                             filter->set_max_length(buffer.data_.capacity());
 
+                        // without a filter the archive writes directly into
+                        // std::vector<char> buffers, bypassing the virtual
+                        // container interface
                         serialization::output_archive archive(
                             buffer.data_, archive_flags, &buffer.chunks_,
                             filter.get());
@@ -14,6 +14,8 @@
 #include <hpx/config.hpp>
 
 #if defined(HPX_HAVE_NETWORKING)
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/concurrentqueue.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/synchronization/spinlock.hpp>
@@ -33,7 +35,6 @@
 #include <map>
 #include <memory>
 #include <mutex>
-#include <set>
 #include <string>
 #include <vector>
 
@@ -325,6 +326,13 @@ namespace hpx { namespace parcelset
             return async_serialization_;
         }
 
+        /// Return the minimal size of messages the serialization filters
+        /// (compression) should be applied to
+        std::size_t get_compression_threshold() const
+        {
+            return compression_threshold_;
+        }
+
         // callback while bootstrap the parcel layer
         void early_pending_parcel_handler(boost::system::error_code const& ec,
             parcel const & p);
@@ -335,16 +343,65 @@ namespace hpx { namespace parcelset
 
         hpx::applier::applier *applier_;
 
-        /// The cache for pending parcels
-        typedef util::tuple<
-            std::vector<parcel>
-          , std::vector<write_handler_type>
-        > map_second_type;
-        typedef std::map<locality, map_second_type> pending_parcels_map;
+        /// The parcels waiting to be sent to one destination. Any number of
+        /// threads may enqueue parcels concurrently, the parcels are dequeued
+        /// only by the thread which managed to set the busy flag. That thread
+        /// hands everything it collected over to one connection.
+        struct pending_parcels_queue
+        {
+            struct value_type
+            {
+                parcel p_;
+                write_handler_type f_;
+            };
+
+            explicit pending_parcels_queue(locality const& dest)
+              : destination_(dest)
+              , size_(0)
+              , busy_(false)
+              , next_(nullptr)
+            {
+            }
+
+            locality const destination_;
+            moodycamel::ConcurrentQueue<value_type> parcels_;
+
+            // The number of parcels in the queue. The counter is adjusted
+            // after enqueuing and after dequeuing, it may become negative
+            // for a short while.
+            std::atomic<std::int64_t> size_;
+            std::atomic<bool> busy_;
+
+            // link to the next queue in the list of all queues
+            pending_parcels_queue* next_;
+        };
+
+        /// Return the queue for the given destination, creating it if needed
+        pending_parcels_queue& get_pending_parcels_queue(locality const& dest);
+
+        /// The queues of all destinations parcels have been sent to. Queues
+        /// are created while holding mtx_ and are never removed.
+        typedef std::map<locality, std::unique_ptr<pending_parcels_queue>>
+            pending_parcels_map;
         pending_parcels_map pending_parcels_;
 
-        typedef std::set<locality> pending_parcels_destinations;
-        pending_parcels_destinations parcel_destinations_;
+        /// All queues linked together, this allows to traverse the queues
+        /// without holding mtx_
+        std::atomic<pending_parcels_queue*> pending_parcels_head_;
+
+        /// Per worker thread lookup caches for the queues
+        typedef std::map<locality, pending_parcels_queue*>
+            pending_parcels_cache;
+        std::unique_ptr<util::cache_line_data<pending_parcels_cache>[]>
+            pending_parcels_caches_;
+        std::atomic<std::size_t> num_pending_parcels_caches_;
+
+        /// Return the cache of the calling worker thread (if any). The cache
+        /// may be used only until the calling HPX thread suspends the next
+        /// time, it might be resumed on a different worker thread.
+        pending_parcels_cache* get_pending_parcels_cache();
+
+        /// The number of destinations with pending parcels
         std::atomic<std::uint32_t> num_parcel_destinations_;
 
         /// The local locality
@@ -371,6 +428,10 @@ namespace hpx { namespace parcelset
         /// async serialization of parcels
         bool async_serialization_;
 
+        /// messages smaller than this are sent without applying the
+        /// serialization filters
+        std::size_t compression_threshold_;
+
         /// priority of the parcelport
         int priority_;
         std::string type_;
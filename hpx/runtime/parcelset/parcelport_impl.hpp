@@ -616,132 +616,154 @@ namespace hpx { namespace parcelset
         void enqueue_parcel(locality const& locality_id,
             parcel&& p, write_handler_type&& f)
         {
-            using mapped_type = pending_parcels_map::mapped_type;
+            using value_type = pending_parcels_queue::value_type;
 
-            std::unique_lock<lcos::local::spinlock> l(mtx_);
-            // We ignore the lock here. It might happen that while enqueuing,
-            // we need to acquire a lock. This should not cause any problems
-            // (famous last words)
-            util::ignore_while_checking<
-                std::unique_lock<lcos::local::spinlock>
-            > il(&l);
+            pending_parcels_queue& q = get_pending_parcels_queue(locality_id);
+            q.parcels_.enqueue(value_type{std::move(p), std::move(f)});
 
-            mapped_type& e = pending_parcels_[locality_id];
-            util::get<0>(e).push_back(std::move(p));
-            util::get<1>(e).push_back(std::move(f));
-
-            parcel_destinations_.insert(locality_id);
-            ++num_parcel_destinations_;
+            parcels_enqueued(q, 1);
         }
 
         void enqueue_parcels(locality const& locality_id,
             std::vector<parcel>&& parcels,
             std::vector<write_handler_type>&& handlers)
         {
-            using mapped_type = pending_parcels_map::mapped_type;
-
-            std::unique_lock<lcos::local::spinlock> l(mtx_);
-            // We ignore the lock here. It might happen that while enqueuing,
-            // we need to acquire a lock. This should not cause any problems
-            // (famous last words)
-            util::ignore_while_checking<
-                std::unique_lock<lcos::local::spinlock>
-            > il(&l);
+            using value_type = pending_parcels_queue::value_type;
 
             HPX_ASSERT(parcels.size() == handlers.size());
 
-            mapped_type& e = pending_parcels_[locality_id];
-            if (util::get<0>(e).empty())
+            // The parcels are enqueued one by one as the bulk enqueue
+            // operation requires the elements to be nothrow move
+            // constructible (it copies them otherwise).
+            pending_parcels_queue& q = get_pending_parcels_queue(locality_id);
+            for (std::size_t i = 0; i != parcels.size(); ++i)
             {
-                HPX_ASSERT(util::get<1>(e).empty());
-                std::swap(util::get<0>(e), parcels);
-                std::swap(util::get<1>(e), handlers);
+                q.parcels_.enqueue(
+                    value_type{std::move(parcels[i]), std::move(handlers[i])});
             }
-            else
+
+            parcels_enqueued(q, std::int64_t(parcels.size()));
+        }
+
+        // The size of a queue is adjusted only after the parcels have been
+        // enqueued, so every parcel accounted for can be dequeued.
+        void parcels_enqueued(pending_parcels_queue& q, std::int64_t count)
+        {
+            std::int64_t const size = q.size_.fetch_add(count) + count;
+            if (size > 0 && size <= count)
             {
-                HPX_ASSERT(util::get<0>(e).size() == util::get<1>(e).size());
-                std::size_t new_size = util::get<0>(e).size() + parcels.size();
-                util::get<0>(e).reserve(new_size);
-
-                std::move(parcels.begin(), parcels.end(),
-                    std::back_inserter(util::get<0>(e)));
-                util::get<1>(e).reserve(new_size);
-                std::move(handlers.begin(), handlers.end(),
-                    std::back_inserter(util::get<1>(e)));
+                // this queue was empty before
+                ++num_parcel_destinations_;
             }
+        }
 
-            parcel_destinations_.insert(locality_id);
-            ++num_parcel_destinations_;
+        // Dequeue the parcels accounted for in the size of the queue. This
+        // must be called only while owning the busy flag of the queue.
+        void parcels_dequeued(pending_parcels_queue& q, std::int64_t count)
+        {
+            std::int64_t const size = q.size_.fetch_sub(count);
+            if (size > 0 && size <= count)
+            {
+                // this queue is empty now
+                HPX_ASSERT(0 != num_parcel_destinations_.load());
+                --num_parcel_destinations_;
+            }
         }
 
-        bool dequeue_parcels(locality const& locality_id,
+        std::size_t dequeue_pending_parcels(pending_parcels_queue& q,
             std::vector<parcel>& parcels,
             std::vector<write_handler_type>& handlers)
         {
-            using iterator = pending_parcels_map::iterator;
+            using value_type = pending_parcels_queue::value_type;
 
-            {
-                std::unique_lock<lcos::local::spinlock> l(mtx_, std::try_to_lock);
+            std::int64_t const size = q.size_.load(std::memory_order_acquire);
+            if (size <= 0)
+                return 0;
 
-                if (!l) return false;
+            std::vector<value_type> values(static_cast<std::size_t>(size));
+            std::size_t const count =
+                q.parcels_.try_dequeue_bulk(values.begin(), values.size());
+            if (count == 0)
+                return 0;
 
-                iterator it = pending_parcels_.find(locality_id);
+            parcels.reserve(parcels.size() + count);
+            handlers.reserve(handlers.size() + count);
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                parcels.push_back(std::move(values[i].p_));
+                handlers.push_back(std::move(values[i].f_));
+            }
 
-                // do nothing if parcels have already been picked up by
-                // another thread
-                if (it != pending_parcels_.end() && !util::get<0>(it->second).empty())
-                {
-                    HPX_ASSERT(it->first == locality_id);
-                    HPX_ASSERT(handlers.size() == 0);
-                    HPX_ASSERT(handlers.size() == parcels.size());
-                    std::swap(parcels, util::get<0>(it->second));
-                    HPX_ASSERT(util::get<0>(it->second).size() == 0);
-                    std::swap(handlers, util::get<1>(it->second));
-                    HPX_ASSERT(handlers.size() == parcels.size());
-
-                    HPX_ASSERT(!handlers.empty());
-                }
-                else
-                {
-                    HPX_ASSERT(util::get<1>(it->second).empty());
-                    return false;
-                }
+            parcels_dequeued(q, std::int64_t(count));
+            return count;
+        }
 
-                parcel_destinations_.erase(locality_id);
+        bool dequeue_parcels(pending_parcels_queue& q,
+            std::vector<parcel>& parcels,
+            std::vector<write_handler_type>& handlers)
+        {
+            HPX_ASSERT(parcels.empty() && handlers.empty());
 
-                HPX_ASSERT(0 != num_parcel_destinations_.load());
-                --num_parcel_destinations_;
+            // A thread finding the queue busy leaves its parcels to the
+            // current owner of the queue. The owner has to look for more
+            // parcels after having released the queue, otherwise parcels
+            // enqueued in the meantime would be left behind.
+            while (!q.busy_.exchange(true))
+            {
+                dequeue_pending_parcels(q, parcels, handlers);
 
-                return true;
+                q.busy_.store(false);
+                if (q.size_.load() <= 0)
+                    break;
             }
+
+            HPX_ASSERT(handlers.size() == parcels.size());
+            return !parcels.empty();
+        }
+
+        bool dequeue_parcels(locality const& locality_id,
+            std::vector<parcel>& parcels,
+            std::vector<write_handler_type>& handlers)
+        {
+            return dequeue_parcels(
+                get_pending_parcels_queue(locality_id), parcels, handlers);
         }
 
     protected:
         bool dequeue_parcel(locality& dest, parcel& p, write_handler_type& handler)
         {
+            using value_type = pending_parcels_queue::value_type;
+
+            for (pending_parcels_queue* q =
+                     pending_parcels_head_.load(std::memory_order_acquire);
+                 q != nullptr; q = q->next_)
             {
-                std::unique_lock<lcos::local::spinlock> l(mtx_, std::try_to_lock);
+                if (q->size_.load(std::memory_order_relaxed) <= 0 ||
+                    q->busy_.exchange(true))
+                {
+                    continue;
+                }
+
+                value_type value;
+                bool const dequeued = q->size_.load() > 0 &&
+                    q->parcels_.try_dequeue(value);
+                if (dequeued)
+                    parcels_dequeued(*q, 1);
 
-                if (!l) return false;
+                q->busy_.store(false);
 
-                for (auto &pending: pending_parcels_)
+                // A sender which found the queue busy has left its parcels
+                // to us. Make sure they are sent instead of waiting for
+                // trigger_pending_work.
+                if (q->size_.load() > 0)
+                    get_connection_and_send_parcels(q->destination_);
+
+                if (dequeued)
                 {
-                    auto &parcels = util::get<0>(pending.second);
-                    if (!parcels.empty())
-                    {
-                        auto& handlers = util::get<1>(pending.second);
-                        dest = pending.first;
-                        p = std::move(parcels.back());
-                        parcels.pop_back();
-                        handler = std::move(handlers.back());
-                        handlers.pop_back();
-
-                        if (parcels.empty())
-                        {
-                            pending_parcels_.erase(dest);
-                        }
-                        return true;
-                    }
+                    dest = q->destination_;
+                    p = std::move(value.p_);
+                    handler = std::move(value.f_);
+                    return true;
                 }
             }
             return false;
@@ -752,28 +774,14 @@ namespace hpx { namespace parcelset
             if (0 == num_parcel_destinations_.load(std::memory_order_relaxed))
                 return true;
 
-            std::vector<locality> destinations;
-
-            {
-                std::unique_lock<lcos::local::spinlock> l(mtx_, std::try_to_lock);
-                if(l.owns_lock())
-                {
-                    if (parcel_destinations_.empty())
-                        return true;
-
-                    destinations.reserve(parcel_destinations_.size());
-                    for (locality const& loc : parcel_destinations_)
-                    {
-                        destinations.push_back(loc);
-                    }
-                }
-            }
-
             // Create new HPX threads which send the parcels that are still
             // pending.
-            for (locality const& loc : destinations)
+            for (pending_parcels_queue* q =
+                     pending_parcels_head_.load(std::memory_order_acquire);
+                 q != nullptr; q = q->next_)
             {
-                get_connection_and_send_parcels(loc);
+                if (q->size_.load(std::memory_order_relaxed) > 0)
+                    get_connection_and_send_parcels(q->destination_);
             }
 
             return true;
@@ -793,6 +801,13 @@ namespace hpx { namespace parcelset
                 return;
             }
 
+            // There is no need to acquire a connection if another thread is
+            // currently collecting the parcels for this destination, that
+            // thread will pick up our parcels as well.
+            pending_parcels_queue& q = get_pending_parcels_queue(locality_id);
+            if (q.busy_.load())
+                return;
+
             // If one of the sending threads are in suspended state, we
             // need to force a new connection to avoid deadlocks.
             bool force_connection = true;
@@ -814,7 +829,7 @@ namespace hpx { namespace parcelset
             std::vector<parcel> parcels;
             std::vector<write_handler_type> handlers;
 
-            if(!dequeue_parcels(locality_id, parcels, handlers))
+            if(!dequeue_parcels(q, parcels, handlers))
             {
                 // Give this connection back to the cache as we couldn't dequeue
                 // parcels.
@@ -825,9 +840,7 @@ namespace hpx { namespace parcelset
 
             // send parcels if they didn't get sent by another connection
             send_pending_parcels(
-                locality_id,
-                sender_connection, std::move(parcels),
-                std::move(handlers));
+                q, sender_connection, std::move(parcels), std::move(handlers));
 
             // We yield here for a short amount of time to give another
             // HPX thread the chance to put a subsequent parcel which
@@ -836,7 +849,7 @@ namespace hpx { namespace parcelset
         }
 
 
-        void send_pending_parcels_trampoline(
+        void send_pending_parcels_trampoline(pending_parcels_queue* q,
             boost::system::error_code const& ec,
             locality const& locality_id,
             std::shared_ptr<connection> sender_connection)
@@ -858,22 +871,17 @@ namespace hpx { namespace parcelset
                 // remove this connection from cache
                 connection_cache_.clear(locality_id, sender_connection);
             }
-            {
-                std::lock_guard<lcos::local::spinlock> l(mtx_);
 
-//                HPX_ASSERT(locality_id == sender_connection->destination());
-                pending_parcels_map::iterator it = pending_parcels_.find(locality_id);
-                if (it == pending_parcels_.end() || util::get<0>(it->second).empty())
-                    return;
-            }
+//            HPX_ASSERT(locality_id == sender_connection->destination());
+            if (q->size_.load(std::memory_order_relaxed) <= 0)
+                return;
 
             // Create a new HPX thread which sends parcels that are still
             // pending.
             get_connection_and_send_parcels(locality_id);
         }
 
-        void send_pending_parcels(
-            parcelset::locality const & parcel_locality_id,
+        void send_pending_parcels(pending_parcels_queue& q,
             std::shared_ptr<connection> sender_connection,
             std::vector<parcel>&& parcels,
             std::vector<write_handler_type>&& handlers)
@@ -885,7 +893,7 @@ namespace hpx { namespace parcelset
 #if defined(HPX_DEBUG)
             // verify the connection points to the right destination
 //            HPX_ASSERT(parcel_locality_id == sender_connection->destination());
-            sender_connection->verify_(parcel_locality_id);
+            sender_connection->verify_(q.destination_);
 #endif
             // encode the parcels
             std::size_t num_parcels = encode_parcels(*this, &parcels[0],
@@ -900,8 +908,9 @@ namespace hpx { namespace parcelset
                 // send all of the parcels
                 sender_connection->async_write(
                     call_for_each(std::move(handlers), std::move(parcels)),
-                    util::bind_front(&parcelport_impl::send_pending_parcels_trampoline,
-                        this));
+                    util::bind_front(
+                        &parcelport_impl::send_pending_parcels_trampoline,
+                        this, &q));
             }
             else
             {
@@ -925,14 +934,15 @@ namespace hpx { namespace parcelset
                 sender_connection->async_write(
                     call_for_each(
                         std::move(handled_handlers), std::move(handled_parcels)),
-                    util::bind_front(&parcelport_impl::send_pending_parcels_trampoline,
-                        this));
+                    util::bind_front(
+                        &parcelport_impl::send_pending_parcels_trampoline,
+                        this, &q));
 
                 // give back unhandled parcels
                 parcels.erase(parcels.begin(), parcels.begin()+num_parcels);
                 handlers.erase(handlers.begin(), handlers.begin()+num_parcels);
 
-                enqueue_parcels(parcel_locality_id, std::move(parcels),
+                enqueue_parcels(q.destination_, std::move(parcels),
                     std::move(handlers));
             }
 
@@ -10,14 +10,18 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assertion.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/util/wrapper_heap_base.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -61,6 +65,9 @@ namespace hpx { namespace util
 #endif
             , create_heap_(nullptr)
             , parameters_({0, 0, 0})
+            , index_shift_(0)
+            , magazine_size_(0)
+            , num_magazines_(0)
         {
             HPX_ASSERT(false); // shouldn't ever be called
         }
@@ -77,6 +84,9 @@ namespace hpx { namespace util
 #endif
             , create_heap_(&one_size_heap_list::create_heap<Heap>)
             , parameters_(parameters)
+            , index_shift_(get_index_shift(parameters))
+            , magazine_size_(get_magazine_size(parameters))
+            , num_magazines_(0)
         {}
 
         template <typename Heap>
@@ -91,6 +101,9 @@ namespace hpx { namespace util
 #endif
             , create_heap_(&one_size_heap_list::create_heap<Heap>)
             , parameters_(parameters)
+            , index_shift_(get_index_shift(parameters))
+            , magazine_size_(get_magazine_size(parameters))
+            , num_magazines_(0)
         {}
 
         ~one_size_heap_list() noexcept;
@@ -108,23 +121,77 @@ namespace hpx { namespace util
         std::string name() const;
 
     protected:
+        // Find the heap which allocated the given pointer, returns an empty
+        // pointer if none does. This doesn't acquire mtx_.
+        std::shared_ptr<util::wrapper_heap_base> find_heap(void* p) const;
+
+        // protects heap_list_, no heap is called into while holding it
         mutable mutex_type mtx_;
         list_type heap_list_;
 
     private:
+        // A worker thread's cache of slots which were reserved from a heap
+        // in one go but which were not handed out yet. Freed slots are never
+        // reused as the position of a slot determines the global id of the
+        // object allocated from it.
+        struct magazine
+        {
+            std::shared_ptr<util::wrapper_heap_base> heap_;
+            char* next_;
+            std::size_t count_;
+        };
+
+        static std::size_t get_index_shift(heap_parameters const& parameters);
+        static std::size_t get_magazine_size(
+            heap_parameters const& parameters);
+
+        magazine* get_magazine();
+        bool alloc_from_magazine(void** result);
+        bool refill_magazine();
+
+        void* alloc_shared(std::size_t count);
+
+        void add_heap(std::shared_ptr<util::wrapper_heap_base> const& heap,
+            void const* pool);
+        void remove_heap(
+            util::wrapper_heap_base const* heap, void const* pool);
+
         std::string const class_name_;
 
     public:
 #if defined(HPX_DEBUG)
-        std::size_t alloc_count_;
-        std::size_t free_count_;
-        std::size_t heap_count_;
-        std::size_t max_alloc_count_;
+        std::atomic<std::size_t> alloc_count_;
+        std::atomic<std::size_t> free_count_;
+        std::atomic<std::size_t> heap_count_;
+        std::atomic<std::size_t> max_alloc_count_;
 #endif
         std::shared_ptr<util::wrapper_heap_base> (*create_heap_)(
             char const*, std::size_t, heap_parameters);
 
         heap_parameters const parameters_;
+
+    private:
+        // The memory range of a heap, as registered with the index.
+        struct heap_index_entry
+        {
+            std::uintptr_t first_;
+            std::uintptr_t last_;
+            std::shared_ptr<util::wrapper_heap_base> heap_;
+        };
+
+        // The heaps are indexed by the blocks of 2^index_shift_ bytes they
+        // overlap with. Blocks are at least as large as the memory of a
+        // heap, each heap is registered with at most two blocks and each
+        // block refers to at most three heaps. The index has its own lock,
+        // it is never held together with mtx_.
+        std::size_t const index_shift_;
+        mutable mutex_type index_mtx_;
+        std::unordered_multimap<std::uintptr_t, heap_index_entry> heap_index_;
+
+        // per worker thread caches of reserved slots, allocated on first use
+        std::size_t const magazine_size_;
+        std::atomic<std::size_t> num_magazines_;
+        std::unique_ptr<util::cache_line_data<magazine>[]> magazines_;
     };
 }}
 
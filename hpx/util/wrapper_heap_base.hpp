@@ -36,6 +36,9 @@ namespace hpx { namespace util
         virtual std::size_t heap_count() const = 0;
         virtual std::size_t size() const = 0;
         virtual std::size_t free_size() const = 0;
+
+        // the memory managed by this heap, nullptr if it was released
+        virtual void const* pool_address() const = 0;
     };
 }}
 
@@ -0,0 +1,517 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_DETAIL_RADIX_SORT_HPP)
+#define HPX_PARALLEL_ALGORITHMS_DETAIL_RADIX_SORT_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/result_of.hpp>
+#include <hpx/iterator_support/zip_iterator.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/type_support/pack.hpp>
+
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/scan_partitioner.hpp>
+
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+    /// \cond NOINTERNAL
+
+    // The parallel sorting algorithms switch to a least significant digit
+    // radix sort whenever the (projected) keys are arithmetic and the
+    // comparison is the natural ascending or descending order of the keys.
+    // Each pass distributes the elements by one byte of the key.
+    static const std::size_t radix_sort_bits = 8;
+    static const std::size_t radix_sort_buckets = std::size_t(1)
+        << radix_sort_bits;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Map a key onto an unsigned integer with the same ordering
+    template <typename Key, typename Enable = void>
+    struct radix_key_traits
+    {
+        static constexpr bool is_valid = false;
+    };
+
+    template <typename Key>
+    struct radix_key_traits<Key,
+        typename std::enable_if<std::is_integral<Key>::value &&
+            !std::is_same<Key, bool>::value>::type>
+    {
+        static constexpr bool is_valid = true;
+
+        using unsigned_type = typename std::make_unsigned<Key>::type;
+
+        static unsigned_type call(Key key)
+        {
+            // flip the sign bit to order negative values first
+            unsigned_type const sign_bit = std::is_signed<Key>::value ?
+                unsigned_type(unsigned_type(1)
+                    << (CHAR_BIT * sizeof(Key) - 1)) :
+                unsigned_type(0);
+            return unsigned_type(unsigned_type(key) ^ sign_bit);
+        }
+    };
+
+    template <typename Key>
+    struct radix_key_traits<Key,
+        typename std::enable_if<std::is_floating_point<Key>::value &&
+            std::numeric_limits<Key>::is_iec559 &&
+            (sizeof(Key) == sizeof(std::uint32_t) ||
+                sizeof(Key) == sizeof(std::uint64_t))>::type>
+    {
+        static constexpr bool is_valid = true;
+
+        using unsigned_type =
+            typename std::conditional<sizeof(Key) == sizeof(std::uint32_t),
+                std::uint32_t, std::uint64_t>::type;
+
+        static unsigned_type call(Key key)
+        {
+            unsigned_type const sign_bit = unsigned_type(1)
+                << (CHAR_BIT * sizeof(Key) - 1);
+
+            // negative values are ordered by their inverted magnitude, all
+            // positive values are placed after them
+            unsigned_type bits;
+            std::memcpy(&bits, &key, sizeof(Key));
+            return (bits & sign_bit) ? unsigned_type(~bits) :
+                                       unsigned_type(bits | sign_bit);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Only comparison objects which are known to compare the keys using their
+    // natural order allow for the radix sort to be used.
+    template <typename Compare, typename Key>
+    struct radix_compare_traits
+    {
+        static constexpr bool is_valid = false;
+        static constexpr bool descending = false;
+    };
+
+    template <typename Key>
+    struct radix_compare_traits<detail::less, Key>
+    {
+        static constexpr bool is_valid = true;
+        static constexpr bool descending = false;
+    };
+
+    template <typename Key>
+    struct radix_compare_traits<std::less<>, Key>
+    {
+        static constexpr bool is_valid = true;
+        static constexpr bool descending = false;
+    };
+
+    template <typename Key>
+    struct radix_compare_traits<std::less<Key>, Key>
+    {
+        static constexpr bool is_valid = true;
+        static constexpr bool descending = false;
+    };
+
+    template <typename Key>
+    struct radix_compare_traits<std::greater<>, Key>
+    {
+        static constexpr bool is_valid = true;
+        static constexpr bool descending = true;
+    };
+
+    template <typename Key>
+    struct radix_compare_traits<std::greater<Key>, Key>
+    {
+        static constexpr bool is_valid = true;
+        static constexpr bool descending = true;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Temporary storage the elements are moved to during every other pass.
+    // The elements of zipped sequences are stored in separate arrays, which
+    // allows to move keys and values independently.
+    template <typename Iter>
+    struct radix_sort_buffer
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using iterator = value_type*;
+
+        static constexpr bool is_valid =
+            std::is_default_constructible<value_type>::value &&
+            std::is_move_assignable<value_type>::value;
+
+        explicit radix_sort_buffer(std::size_t size)
+          : data_(new value_type[size])
+        {
+        }
+
+        iterator begin() const
+        {
+            return data_.get();
+        }
+
+        std::unique_ptr<value_type[]> data_;
+    };
+
+    template <typename... Iters>
+    struct radix_sort_buffer<hpx::util::zip_iterator<Iters...>>
+    {
+        using iterator = hpx::util::zip_iterator<
+            typename std::iterator_traits<Iters>::value_type*...>;
+
+        static constexpr bool is_valid = hpx::util::all_of<
+            std::is_default_constructible<
+                typename std::iterator_traits<Iters>::value_type>...,
+            std::is_move_assignable<
+                typename std::iterator_traits<Iters>::value_type>...>::value;
+
+        explicit radix_sort_buffer(std::size_t size)
+          : data_(std::unique_ptr<
+                typename std::iterator_traits<Iters>::value_type[]>(
+                new typename std::iterator_traits<Iters>::value_type[size])...)
+        {
+        }
+
+        iterator begin() const
+        {
+            return begin(
+                typename hpx::util::make_index_pack<sizeof...(Iters)>::type());
+        }
+
+        template <std::size_t... Is>
+        iterator begin(hpx::util::index_pack<Is...>) const
+        {
+            return iterator(hpx::util::get<Is>(data_).get()...);
+        }
+
+        hpx::util::tuple<std::unique_ptr<
+            typename std::iterator_traits<Iters>::value_type[]>...>
+            data_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iter1, typename Iter2>
+    HPX_FORCEINLINE void radix_sort_move(Iter1 src, Iter2 dest)
+    {
+        *dest = std::move(*src);
+    }
+
+    template <typename IterTuple1, typename IterTuple2, std::size_t... Is>
+    HPX_FORCEINLINE void radix_sort_move(IterTuple1 const& src,
+        IterTuple2 const& dest, hpx::util::index_pack<Is...>)
+    {
+        int const sequencer[] = {0,
+            (*hpx::util::get<Is>(dest) = std::move(*hpx::util::get<Is>(src)),
+                0)...};
+        (void) sequencer;
+    }
+
+    // Zipped elements are moved member by member, moving the tuple of
+    // references returned from dereferencing a zip_iterator would copy them.
+    template <typename... Iters1, typename... Iters2>
+    HPX_FORCEINLINE void radix_sort_move(
+        hpx::util::zip_iterator<Iters1...> src,
+        hpx::util::zip_iterator<Iters2...> dest)
+    {
+        radix_sort_move(src.get_iterator_tuple(), dest.get_iterator_tuple(),
+            typename hpx::util::make_index_pack<sizeof...(Iters1)>::type());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Decide whether a parallel sort of the given sequence can use the radix
+    // sort, i.e. whether the projected keys are arithmetic and are compared
+    // using their natural order.
+    template <typename Iter, typename Compare, typename Proj>
+    struct is_radix_sortable
+    {
+        using key_type = typename std::decay<typename hpx::util::invoke_result<
+            Proj, typename std::iterator_traits<Iter>::reference>::type>::type;
+
+        using key_traits = radix_key_traits<key_type>;
+        using compare_traits =
+            radix_compare_traits<typename std::decay<Compare>::type, key_type>;
+
+        static constexpr bool value = key_traits::is_valid &&
+            compare_traits::is_valid && radix_sort_buffer<Iter>::is_valid;
+    };
+
+    // Extracts the unsigned integer a given element is sorted by
+    template <typename Key, typename Proj, bool Descending>
+    struct radix_sort_key
+    {
+        using unsigned_type = typename radix_key_traits<Key>::unsigned_type;
+
+        template <typename T>
+        HPX_FORCEINLINE unsigned_type operator()(T&& t) const
+        {
+            unsigned_type key = radix_key_traits<Key>::call(
+                hpx::util::invoke(proj_, std::forward<T>(t)));
+            return Descending ? unsigned_type(~key) : key;
+        }
+
+        Proj proj_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The number of elements in each of the buckets (for one chunk of the
+    // sequence, or for all chunks to the left of a particular chunk).
+    template <typename Unsigned>
+    struct radix_histogram
+    {
+        radix_histogram()
+          : counts_()
+          , diff_(0)
+        {
+        }
+
+        std::array<std::size_t, radix_sort_buckets> counts_;
+
+        // the bits in which any of the keys differs from the first key of
+        // the sequence
+        Unsigned diff_;
+    };
+
+    template <typename Iter, typename Unsigned>
+    struct radix_chunk
+    {
+        Iter first_;
+        std::size_t size_;
+
+        // the number of elements with the same digit in all chunks before
+        // this one
+        radix_histogram<Unsigned> offsets_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Move the elements from [src, src + count) to [dest, dest + count),
+    // ordering them by the digit starting at the given bit of their keys.
+    // The order of elements with equal digits is preserved. Returns false if
+    // all elements share the same digit, in which case nothing is moved.
+    //
+    // The per-chunk histograms and their exclusive prefix sums are computed
+    // using the scan_partitioner, the elements of all chunks are then
+    // scattered concurrently.
+    template <typename ExPolicy, typename SrcIter, typename DestIter,
+        typename KeyF, typename Unsigned = typename KeyF::unsigned_type>
+    bool radix_sort_pass(ExPolicy& policy, SrcIter src, DestIter dest,
+        std::size_t count, KeyF const& key, std::size_t shift,
+        Unsigned& diff)
+    {
+        using histogram = radix_histogram<Unsigned>;
+        using chunk = radix_chunk<SrcIter, Unsigned>;
+        using result_type = std::pair<histogram, std::vector<chunk>>;
+
+        using policy_type = typename std::decay<ExPolicy>::type;
+        using partitioner_type =
+            util::detail::scan_static_partitioner<policy_type,
+                util::scan_partitioner_normal_tag, result_type, histogram,
+                chunk>;
+
+        Unsigned const reference = key(*src);
+
+        auto f1 = [&key, reference, shift](
+                      SrcIter it, std::size_t size) -> histogram {
+            histogram h;
+            for (/**/; size != 0; (void) ++it, --size)
+            {
+                Unsigned const k = key(*it);
+                h.diff_ |= Unsigned(k ^ reference);
+                ++h.counts_[(k >> shift) & (radix_sort_buckets - 1)];
+            }
+            return h;
+        };
+
+        auto f2 = [](hpx::shared_future<histogram> const& prev,
+                      hpx::shared_future<histogram> const& curr) -> histogram {
+            histogram h = prev.get();
+            histogram const& c = curr.get();
+            for (std::size_t i = 0; i != radix_sort_buckets; ++i)
+                h.counts_[i] += c.counts_[i];
+            h.diff_ |= c.diff_;
+            return h;
+        };
+
+        auto f3 = [](SrcIter it, std::size_t size,
+                      hpx::shared_future<histogram> prev,
+                      hpx::shared_future<histogram> curr) -> chunk {
+            curr.get();    // rethrow exceptions
+            return chunk{it, size, prev.get()};
+        };
+
+        auto f4 = [](std::vector<hpx::shared_future<histogram>>&& workitems,
+                      std::vector<hpx::future<chunk>>&& finalitems)
+            -> result_type {
+            std::vector<chunk> chunks;
+            chunks.reserve(finalitems.size());
+            for (auto&& f : finalitems)
+                chunks.push_back(f.get());
+            return result_type(workitems.back().get(), std::move(chunks));
+        };
+
+        result_type result = partitioner_type::call(
+            util::scan_partitioner_normal_tag{}, policy, src, count,
+            histogram(), std::move(f1), std::move(f2), std::move(f3),
+            std::move(f4));
+
+        histogram const& totals = result.first;
+        diff = totals.diff_;
+
+        // nothing to do if all elements share the same digit
+        std::size_t base[radix_sort_buckets];
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i != radix_sort_buckets; ++i)
+        {
+            if (totals.counts_[i] == count)
+                return false;
+
+            base[i] = sum;
+            sum += totals.counts_[i];
+        }
+        HPX_ASSERT(sum == count);
+
+        for (chunk& c : result.second)
+        {
+            for (std::size_t i = 0; i != radix_sort_buckets; ++i)
+                c.offsets_.counts_[i] += base[i];
+        }
+
+        std::vector<hpx::future<void>> workitems =
+            execution::bulk_async_execute(
+                policy.executor(),
+                [&key, dest, shift](chunk const& c) {
+                    std::array<std::size_t, radix_sort_buckets> offsets =
+                        c.offsets_.counts_;
+
+                    SrcIter it = c.first_;
+                    for (std::size_t size = c.size_; size != 0;
+                         (void) ++it, --size)
+                    {
+                        std::size_t const d = std::size_t(
+                            (key(*it) >> shift) & (radix_sort_buckets - 1));
+                        radix_sort_move(
+                            it, dest + std::ptrdiff_t(offsets[d]++));
+                    }
+                },
+                result.second);
+
+        hpx::wait_all(workitems);
+
+        std::list<std::exception_ptr> errors;
+        util::detail::handle_local_exceptions<policy_type>::call(
+            workitems, errors);
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Move the elements of [src, src + count) to dest in chunks of the given
+    // size concurrently.
+    template <typename ExPolicy, typename SrcIter, typename DestIter>
+    void radix_sort_move_back(ExPolicy& policy, SrcIter src, DestIter dest,
+        std::size_t count, std::size_t chunk_size)
+    {
+        std::vector<std::size_t> shape;
+        shape.reserve(count / chunk_size + 1);
+        for (std::size_t base = 0; base < count; base += chunk_size)
+            shape.push_back(base);
+
+        std::vector<hpx::future<void>> workitems =
+            execution::bulk_async_execute(
+                policy.executor(),
+                [=](std::size_t base) {
+                    std::size_t const size =
+                        (std::min)(chunk_size, count - base);
+                    SrcIter it = src + std::ptrdiff_t(base);
+                    DestIter dst = dest + std::ptrdiff_t(base);
+                    for (std::size_t i = 0; i != size; ++i)
+                        radix_sort_move(it++, dst++);
+                },
+                shape);
+
+        hpx::wait_all(workitems);
+
+        std::list<std::exception_ptr> errors;
+        util::detail::handle_local_exceptions<
+            typename std::decay<ExPolicy>::type>::call(workitems, errors);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sort [first, first + count) by the keys extracted from the elements
+    // using a least significant digit radix sort. The first pass determines
+    // the bits the keys differ in, all passes for digits which are equal for
+    // all keys are skipped.
+    template <typename ExPolicy, typename RandomIt, typename Compare,
+        typename Proj>
+    void parallel_radix_sort_helper(ExPolicy& policy, RandomIt first,
+        std::size_t count, std::size_t chunk_size, Proj const& proj)
+    {
+        using sortable = is_radix_sortable<RandomIt, Compare, Proj>;
+        using key_type = typename sortable::key_type;
+        using key_extractor = radix_sort_key<key_type, Proj,
+            sortable::compare_traits::descending>;
+        using unsigned_type = typename key_extractor::unsigned_type;
+        using buffer_type = radix_sort_buffer<RandomIt>;
+        using buffer_iterator = typename buffer_type::iterator;
+
+        HPX_ASSERT(count != 0);
+
+        key_extractor const key{proj};
+        buffer_type buffer(count);
+
+        bool in_buffer = false;
+        unsigned_type diff = unsigned_type(~unsigned_type(0));
+
+        for (std::size_t shift = 0; shift < CHAR_BIT * sizeof(unsigned_type);
+             shift += radix_sort_bits)
+        {
+            // skip the digits all keys agree on
+            if (((diff >> shift) & (radix_sort_buckets - 1)) == 0)
+                continue;
+
+            bool moved = false;
+            if (in_buffer)
+            {
+                moved = radix_sort_pass(
+                    policy, buffer.begin(), first, count, key, shift, diff);
+            }
+            else
+            {
+                moved = radix_sort_pass(
+                    policy, first, buffer.begin(), count, key, shift, diff);
+            }
+
+            if (moved)
+                in_buffer = !in_buffer;
+        }
+
+        if (in_buffer)
+        {
+            radix_sort_move_back<ExPolicy, buffer_iterator, RandomIt>(
+                policy, buffer.begin(), first, count, chunk_size);
+        }
+    }
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
+
+#endif
@@ -0,0 +1,250 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/partial_sort.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHM_PARTIAL_SORT_HPP)
+#define HPX_PARALLEL_ALGORITHM_PARTIAL_SORT_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/execution_policy.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/nth_element.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // partial_sort
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        // Select the smallest elements using the parallel nth_element and
+        // sort those using the parallel sort.
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        void parallel_partial_sort_helper(ExPolicy& policy, RandomIt first,
+            RandomIt middle, RandomIt last, Compare& comp,
+            std::size_t chunk_size)
+        {
+            if (middle == first)
+                return;
+
+            if (middle != last)
+            {
+                parallel_nth_element_helper(
+                    policy, first, middle - 1, last, comp, chunk_size);
+            }
+
+            std::size_t const count = middle - first;
+            if (count <= chunk_size)
+            {
+                std::sort(first, middle, comp);
+                return;
+            }
+
+            sort_thread(policy, first, middle, comp, chunk_size).get();
+        }
+
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<RandomIt> parallel_partial_sort_async(ExPolicy&& policy,
+            RandomIt first, RandomIt middle, RandomIt last, Compare comp)
+        {
+            std::ptrdiff_t N = last - first;
+            HPX_ASSERT(N >= 0);
+
+            std::size_t const chunk_size =
+                get_sort_chunk_size(policy, std::size_t(N));
+
+            if (std::size_t(N) <= chunk_size)
+            {
+                std::partial_sort(first, middle, last, comp);
+                return hpx::make_ready_future(last);
+            }
+
+            using policy_type = typename std::decay<ExPolicy>::type;
+
+            return execution::async_execute(policy.executor(),
+                [policy = std::forward<ExPolicy>(policy), first, middle, last,
+                    comp = std::move(comp),
+                    chunk_size]() mutable -> RandomIt {
+                    try
+                    {
+                        parallel_partial_sort_helper(
+                            policy, first, middle, last, comp, chunk_size);
+                        return last;
+                    }
+                    catch (...)
+                    {
+                        util::detail::handle_local_exceptions<
+                            policy_type>::call(std::current_exception());
+                    }
+
+                    // Not reachable.
+                    HPX_ASSERT(false);
+                    return last;
+                });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // partial_sort
+        template <typename RandomIt>
+        struct partial_sort
+          : public detail::algorithm<partial_sort<RandomIt>, RandomIt>
+        {
+            partial_sort()
+              : partial_sort::algorithm("partial_sort")
+            {
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static RandomIt sequential(ExPolicy, RandomIt first,
+                RandomIt middle, RandomIt last, Compare&& comp, Proj&& proj)
+            {
+                std::partial_sort(first, middle, last,
+                    util::compare_projected<Compare, Proj>(
+                        std::forward<Compare>(comp), std::forward<Proj>(proj)));
+                return last;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            parallel(ExPolicy&& policy, RandomIt first, RandomIt middle,
+                RandomIt last, Compare&& comp, Proj&& proj)
+            {
+                typedef util::detail::algorithm_result<ExPolicy, RandomIt>
+                    algorithm_result;
+
+                try
+                {
+                    return algorithm_result::get(parallel_partial_sort_async(
+                        std::forward<ExPolicy>(policy), first, middle, last,
+                        util::compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj))));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+
+    //-----------------------------------------------------------------------------
+    /// Rearranges the elements such that the range [first, middle) contains
+    /// the sorted middle - first smallest elements in the range
+    /// [first, last). The order of equal elements is not guaranteed to be
+    /// preserved. The order of the remaining elements in the range
+    /// [middle, last) is unspecified.
+    ///
+    /// \note   Complexity: Approximately (last-first) + M log(M) applications
+    ///                     of the predicate on average, where
+    ///                     M = std::distance(first, middle).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param middle       Refers to the end of the sub-range of elements
+    ///                     which will be sorted.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The parallel version of this algorithm selects the smallest elements
+    /// using the same algorithm as \a nth_element, the value type of the
+    /// sequence has to be copy constructible.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a partial_sort algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandomIt
+    ///           otherwise.
+    ///           The algorithm returns an iterator pointing to the first
+    ///           element after the last element in the input sequence.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RandomIt,
+        typename Proj = util::projection_identity,
+        typename Compare = detail::less,
+        HPX_CONCEPT_REQUIRES_(execution::is_execution_policy<ExPolicy>::value&&
+                hpx::traits::is_iterator<RandomIt>::value&&
+                    traits::is_projected<Proj, RandomIt>::value&&
+                        traits::is_indirect_callable<ExPolicy, Compare,
+                            traits::projected<Proj, RandomIt>,
+                            traits::projected<Proj, RandomIt>>::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    partial_sort(ExPolicy&& policy, RandomIt first, RandomIt middle,
+        RandomIt last, Compare&& comp = Compare(), Proj&& proj = Proj())
+    {
+        static_assert((hpx::traits::is_random_access_iterator<RandomIt>::value),
+            "Requires a random access iterator.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::partial_sort<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, middle, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+}}}    // namespace hpx::parallel::v1
+
+#endif
@@ -0,0 +1,335 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/partial_sort_copy.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHM_PARTIAL_SORT_COPY_HPP)
+#define HPX_PARALLEL_ALGORITHM_PARTIAL_SORT_COPY_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/wait_all.hpp>
+
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/execution_policy.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/partial_sort.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // partial_sort_copy
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        // Collect the (at most) n smallest elements of [first, last) into
+        // candidates using a bounded max-heap.
+        template <typename FwdIter, typename T, typename Compare>
+        void select_smallest(FwdIter first, FwdIter last, std::size_t n,
+            std::vector<T>& candidates, Compare& comp)
+        {
+            candidates.reserve(n);
+            for (/**/; first != last && candidates.size() != n; ++first)
+            {
+                candidates.push_back(*first);
+            }
+
+            std::make_heap(candidates.begin(), candidates.end(), comp);
+            for (/**/; first != last; ++first)
+            {
+                if (comp(*first, candidates.front()))
+                {
+                    std::pop_heap(candidates.begin(), candidates.end(), comp);
+                    candidates.back() = *first;
+                    std::push_heap(candidates.begin(), candidates.end(), comp);
+                }
+            }
+        }
+
+        // If only few elements are requested, each chunk of the input
+        // sequence concurrently selects its n smallest elements and the
+        // final result is selected from those candidates only. Otherwise the
+        // whole input sequence is copied and partially sorted in parallel.
+        template <typename ExPolicy, typename FwdIter, typename RandomIt,
+            typename Compare>
+        RandomIt parallel_partial_sort_copy_helper(ExPolicy& policy,
+            FwdIter first, FwdIter last, RandomIt d_first, RandomIt d_last,
+            Compare& comp, std::size_t chunk_size)
+        {
+            using value_type =
+                typename std::iterator_traits<FwdIter>::value_type;
+
+            std::size_t const count = std::distance(first, last);
+            std::size_t const n =
+                (std::min)(count, std::size_t(d_last - d_first));
+            if (n == 0)
+                return d_first;
+
+            std::vector<value_type> candidates;
+
+            std::size_t const num_chunks = (count + chunk_size - 1) / chunk_size;
+            if (num_chunks > 1 && n < chunk_size)
+            {
+                std::vector<std::vector<value_type>> chunk_candidates(
+                    num_chunks);
+                std::vector<hpx::future<void>> futures;
+                futures.reserve(num_chunks);
+
+                FwdIter chunk_first = first;
+                for (std::size_t i = 0; i != num_chunks; ++i)
+                {
+                    std::size_t const size =
+                        (std::min)(chunk_size, count - i * chunk_size);
+                    FwdIter chunk_last = std::next(chunk_first, size);
+
+                    futures.push_back(execution::async_execute(
+                        policy.executor(),
+                        [&comp, &candidates = chunk_candidates[i],
+                            chunk_first, chunk_last, n]() {
+                            select_smallest(
+                                chunk_first, chunk_last, n, candidates, comp);
+                        }));
+
+                    chunk_first = chunk_last;
+                }
+
+                hpx::wait_all(futures);
+
+                std::list<std::exception_ptr> errors;
+                util::detail::handle_local_exceptions<ExPolicy>::call(
+                    futures, errors);
+
+                candidates.reserve(num_chunks * n);
+                for (auto& c : chunk_candidates)
+                {
+                    std::move(c.begin(), c.end(),
+                        std::back_inserter(candidates));
+                }
+            }
+            else
+            {
+                candidates.assign(first, last);
+            }
+
+            parallel_partial_sort_helper(policy, candidates.begin(),
+                candidates.begin() + n, candidates.end(), comp, chunk_size);
+
+            return std::move(
+                candidates.begin(), candidates.begin() + n, d_first);
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename RandomIt,
+            typename Compare>
+        hpx::future<RandomIt> parallel_partial_sort_copy_async(
+            ExPolicy&& policy, FwdIter first, FwdIter last, RandomIt d_first,
+            RandomIt d_last, Compare comp)
+        {
+            std::size_t const count = std::distance(first, last);
+            std::size_t const chunk_size = get_sort_chunk_size(policy, count);
+
+            if (count <= chunk_size)
+            {
+                return hpx::make_ready_future(std::partial_sort_copy(
+                    first, last, d_first, d_last, comp));
+            }
+
+            using policy_type = typename std::decay<ExPolicy>::type;
+
+            return execution::async_execute(policy.executor(),
+                [policy = std::forward<ExPolicy>(policy), first, last, d_first,
+                    d_last, comp = std::move(comp),
+                    chunk_size]() mutable -> RandomIt {
+                    try
+                    {
+                        return parallel_partial_sort_copy_helper(policy, first,
+                            last, d_first, d_last, comp, chunk_size);
+                    }
+                    catch (...)
+                    {
+                        util::detail::handle_local_exceptions<
+                            policy_type>::call(std::current_exception());
+                    }
+
+                    // Not reachable.
+                    HPX_ASSERT(false);
+                    return d_first;
+                });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // partial_sort_copy
+        template <typename RandomIt>
+        struct partial_sort_copy
+          : public detail::algorithm<partial_sort_copy<RandomIt>, RandomIt>
+        {
+            partial_sort_copy()
+              : partial_sort_copy::algorithm("partial_sort_copy")
+            {
+            }
+
+            template <typename ExPolicy, typename InIter, typename Compare,
+                typename Proj>
+            static RandomIt sequential(ExPolicy, InIter first, InIter last,
+                RandomIt d_first, RandomIt d_last, Compare&& comp, Proj&& proj)
+            {
+                return std::partial_sort_copy(first, last, d_first, d_last,
+                    util::compare_projected<Compare, Proj>(
+                        std::forward<Compare>(comp), std::forward<Proj>(proj)));
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Compare,
+                typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            parallel(ExPolicy&& policy, FwdIter first, FwdIter last,
+                RandomIt d_first, RandomIt d_last, Compare&& comp, Proj&& proj)
+            {
+                typedef util::detail::algorithm_result<ExPolicy, RandomIt>
+                    algorithm_result;
+
+                try
+                {
+                    return algorithm_result::get(
+                        parallel_partial_sort_copy_async(
+                            std::forward<ExPolicy>(policy), first, last,
+                            d_first, d_last,
+                            util::compare_projected<Compare, Proj>(
+                                std::forward<Compare>(comp),
+                                std::forward<Proj>(proj))));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+
+    //-----------------------------------------------------------------------------
+    /// Sorts some of the elements in the range [first, last) in ascending
+    /// order, storing the result in the range [d_first, d_last). At most
+    /// d_last - d_first of the elements are placed sorted to the range
+    /// [d_first, d_first + n) where n is the number of elements to sort
+    /// (n = min(last - first, d_last - d_first)). The order of equal
+    /// elements is not guaranteed to be preserved.
+    ///
+    /// \note   Complexity: Approximately (last-first) log(n) applications of
+    ///                     the predicate.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam RandomIt    The type of the destination iterators used
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param d_first      Refers to the beginning of the destination range.
+    /// \param d_last       Refers to the end of the destination range.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The parallel version of this algorithm selects the smallest elements
+    /// of each chunk of the input sequence concurrently if n is small.
+    /// Otherwise it copies the input sequence and uses the same algorithm as
+    /// \a partial_sort. The value type of the input sequence has to be copy
+    /// constructible.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a partial_sort_copy algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandomIt
+    ///           otherwise.
+    ///           The algorithm returns an iterator to the element defining
+    ///           the upper boundary of the sorted range i.e.
+    ///           d_first + min(last - first, d_last - d_first).
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename FwdIter, typename RandomIt,
+        typename Proj = util::projection_identity,
+        typename Compare = detail::less,
+        HPX_CONCEPT_REQUIRES_(execution::is_execution_policy<ExPolicy>::value&&
+                hpx::traits::is_iterator<FwdIter>::value&&
+                    hpx::traits::is_iterator<RandomIt>::value&&
+                        traits::is_projected<Proj, FwdIter>::value&&
+                            traits::is_indirect_callable<ExPolicy, Compare,
+                                traits::projected<Proj, FwdIter>,
+                                traits::projected<Proj, FwdIter>>::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    partial_sort_copy(ExPolicy&& policy, FwdIter first, FwdIter last,
+        RandomIt d_first, RandomIt d_last, Compare&& comp = Compare(),
+        Proj&& proj = Proj())
+    {
+        static_assert((hpx::traits::is_forward_iterator<FwdIter>::value),
+            "Requires at least forward iterator.");
+        static_assert((hpx::traits::is_random_access_iterator<RandomIt>::value),
+            "Requires a random access iterator.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::partial_sort_copy<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, last, d_first,
+            d_last, std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+}}}    // namespace hpx::parallel::v1
+
+#endif
@@ -16,6 +16,7 @@
 #include <hpx/dataflow.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
 #include <hpx/type_support/decay.hpp>
 
 #include <hpx/execution/algorithms/detail/predicates.hpp>
@@ -25,10 +26,12 @@
 #include <hpx/execution/executors/execution_information.hpp>
 #include <hpx/execution/executors/execution_parameters.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
 #include <hpx/parallel/traits/projected.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
 #include <hpx/parallel/util/projection_identity.hpp>
 
 #include <algorithm>
@@ -39,6 +42,7 @@
 #include <list>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx { namespace parallel { inline namespace v1 {
     ///////////////////////////////////////////////////////////////////////////
@@ -163,23 +167,15 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 std::move(left), std::move(right));
         }
 
-        //------------------------------------------------------------------------
-        //  function : parallel_sort_async
-        //------------------------------------------------------------------------
-        /// @param [in] first : iterator to the first element to sort
-        /// @param [in] last : iterator to the next element after the last
-        /// @param [in] comp : object for to compare
-        /// @exception
-        /// @return
-        /// @remarks
-        template <typename ExPolicy, typename RandomIt, typename Compare>
-        hpx::future<RandomIt> parallel_sort_async(
-            ExPolicy&& policy, RandomIt first, RandomIt last, Compare comp)
+        ///////////////////////////////////////////////////////////////////////
+        // Figure out the number of elements the sorting algorithms process
+        // sequentially in a single task, honoring the executor parameters of
+        // the given execution policy.
+        template <typename ExPolicy>
+        std::size_t get_sort_chunk_size(ExPolicy const& policy,
+            std::size_t count,
+            std::size_t limit_per_task = sort_limit_per_task)
         {
-            // number of elements to sort
-            std::size_t count = last - first;
-
-            // figure out the chunk size to use
             std::size_t const cores = execution::processing_units_count(
                 policy.executor(), policy.parameters());
 
@@ -193,8 +189,61 @@ namespace hpx { namespace parallel { inline namespace v1 {
             util::detail::adjust_chunk_size_and_max_chunks(
                 cores, count, max_chunks, chunk_size);
 
-            // we should not get smaller than our sort_limit_per_task
-            chunk_size = (std::max)(chunk_size, sort_limit_per_task);
+            // we should not get smaller than our limit_per_task
+            return (std::max)(chunk_size, limit_per_task);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Run f1 on a new task and f2 on the calling thread and wait for both
+        // to finish. Exceptions are reported as required by the execution
+        // policy.
+        template <typename ExPolicy, typename F1, typename F2>
+        void sort_fork_join(ExPolicy& policy, F1&& f1, F2&& f2)
+        {
+            hpx::future<void> fut = execution::async_execute(
+                policy.executor(), std::forward<F1>(f1));
+
+            try
+            {
+                f2();
+            }
+            catch (...)
+            {
+                fut.wait();
+
+                std::vector<hpx::future<void>> futures(2);
+                futures[0] = std::move(fut);
+                futures[1] = hpx::make_exceptional_future<void>(
+                    std::current_exception());
+
+                std::list<std::exception_ptr> errors;
+                util::detail::handle_local_exceptions<ExPolicy>::call(
+                    futures, errors);
+
+                // Not reachable.
+                HPX_ASSERT(false);
+                return;
+            }
+
+            fut.get();
+        }
+
+        //------------------------------------------------------------------------
+        //  function : parallel_sort_async
+        //------------------------------------------------------------------------
+        /// @param [in] first : iterator to the first element to sort
+        /// @param [in] last : iterator to the next element after the last
+        /// @param [in] comp : object for to compare
+        /// @exception
+        /// @return
+        /// @remarks
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<RandomIt> parallel_sort_async(
+            ExPolicy&& policy, RandomIt first, RandomIt last, Compare comp)
+        {
+            // figure out the chunk size to use
+            std::size_t const chunk_size =
+                get_sort_chunk_size(policy, std::size_t(last - first));
 
             std::ptrdiff_t N = last - first;
             HPX_ASSERT(N >= 0);
@@ -215,6 +264,82 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 std::forward<ExPolicy>(policy), first, last, comp, chunk_size);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Sequences of arithmetic keys (or elements projected onto arithmetic
+        // keys) which are sorted by their natural order are sorted using a
+        // parallel radix sort instead of the comparison based quicksort.
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        hpx::future<RandomIt> parallel_radix_sort_async(ExPolicy&& policy,
+            RandomIt first, RandomIt last, Compare comp, Proj proj)
+        {
+            std::ptrdiff_t N = last - first;
+            HPX_ASSERT(N >= 0);
+
+            // figure out the chunk size to use
+            std::size_t const chunk_size =
+                get_sort_chunk_size(policy, std::size_t(N));
+
+            util::compare_projected<Compare const&, Proj const&> pred(
+                comp, proj);
+
+            if (std::size_t(N) < chunk_size)
+            {
+                std::sort(first, last, pred);
+                return hpx::make_ready_future(last);
+            }
+
+            // check if already sorted
+            if (detail::is_sorted_sequential(first, last, pred))
+                return hpx::make_ready_future(last);
+
+            using policy_type = typename std::decay<ExPolicy>::type;
+
+            return execution::async_execute(policy.executor(),
+                [policy = std::forward<ExPolicy>(policy), first, last,
+                    proj = std::move(proj), chunk_size]() mutable -> RandomIt {
+                    try
+                    {
+                        parallel_radix_sort_helper<policy_type, RandomIt,
+                            Compare>(policy, first, std::size_t(last - first),
+                            chunk_size, proj);
+                        return last;
+                    }
+                    catch (...)
+                    {
+                        util::detail::handle_local_exceptions<
+                            policy_type>::call(std::current_exception());
+                    }
+
+                    // Not reachable.
+                    HPX_ASSERT(false);
+                    return last;
+                });
+        }
+
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        hpx::future<RandomIt> parallel_sort_async(ExPolicy&& policy,
+            RandomIt first, RandomIt last, Compare&& comp, Proj&& proj,
+            std::false_type)
+        {
+            return parallel_sort_async(std::forward<ExPolicy>(policy), first,
+                last,
+                util::compare_projected<Compare, Proj>(
+                    std::forward<Compare>(comp), std::forward<Proj>(proj)));
+        }
+
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        hpx::future<RandomIt> parallel_sort_async(ExPolicy&& policy,
+            RandomIt first, RandomIt last, Compare&& comp, Proj&& proj,
+            std::true_type)
+        {
+            return parallel_radix_sort_async(std::forward<ExPolicy>(policy),
+                first, last, std::forward<Compare>(comp),
+                std::forward<Proj>(proj));
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // sort
         template <typename RandomIt>
@@ -246,13 +371,17 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 try
                 {
+                    using is_radix_sortable =
+                        std::integral_constant<bool,
+                            detail::is_radix_sortable<RandomIt, Compare,
+                                Proj>::value>;
+
                     // call the sort routine and return the right type,
                     // depending on execution policy
                     return algorithm_result::get(parallel_sort_async(
                         std::forward<ExPolicy>(policy), first, last,
-                        util::compare_projected<Compare, Proj>(
-                            std::forward<Compare>(comp),
-                            std::forward<Proj>(proj))));
+                        std::forward<Compare>(comp), std::forward<Proj>(proj),
+                        is_radix_sortable()));
                 }
                 catch (...)
                 {
@@ -262,6 +391,28 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 }
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // non-segmented implementation
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+        sort_(ExPolicy&& policy, RandomIt first, RandomIt last, Compare&& comp,
+            Proj&& proj, std::false_type)
+        {
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            return sort<RandomIt>().call(std::forward<ExPolicy>(policy),
+                is_seq(), first, last, std::forward<Compare>(comp),
+                std::forward<Proj>(proj));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+        sort_(ExPolicy&& policy, RandomIt first, RandomIt last, Compare&& comp,
+            Proj&& proj, std::true_type);
         /// \endcond
     }    // namespace detail
 
@@ -312,6 +463,14 @@ namespace hpx { namespace parallel { inline namespace v1 {
     ///
     /// \a comp has to induce a strict weak ordering on the values.
     ///
+    /// If the projected elements are of an arithmetic type, \a comp is one
+    /// of \a std::less or \a std::greater, and the value type of the sequence
+    /// is default constructible, the parallel version of this algorithm uses
+    /// a least significant digit radix sort. It requires O(N) applications
+    /// of the projection and temporary storage for N elements. Floating point
+    /// keys are ordered by their binary representation in this case, i.e.
+    /// negative zeros are placed before positive zeros.
+    ///
     /// The application of function objects in parallel algorithm
     /// invoked with an execution policy object of type
     /// \a sequenced_policy execute in sequential order in the
@@ -348,11 +507,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
         static_assert((hpx::traits::is_random_access_iterator<RandomIt>::value),
             "Requires a random access iterator.");
 
-        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+        typedef hpx::traits::is_segmented_iterator<RandomIt> is_segmented;
 
-        return detail::sort<RandomIt>().call(std::forward<ExPolicy>(policy),
-            is_seq(), first, last, std::forward<Compare>(comp),
-            std::forward<Proj>(proj));
+        return detail::sort_(std::forward<ExPolicy>(policy), first, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj),
+            is_segmented());
     }
 }}}    // namespace hpx::parallel::v1
 
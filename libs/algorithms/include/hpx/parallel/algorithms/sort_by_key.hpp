@@ -89,6 +89,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
     ///
     /// \a comp has to induce a strict weak ordering on the values.
     ///
+    /// Arithmetic keys compared using \a std::less or \a std::greater are
+    /// sorted using a parallel radix sort, see \a sort. Keys and values are
+    /// moved independently in this case.
+    ///
     /// The application of function objects in parallel algorithm
     /// invoked with an execution policy object of type
     /// \a sequenced_policy execute in sequential order in the
@@ -0,0 +1,348 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/stable_sort.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHM_STABLE_SORT_HPP)
+#define HPX_PARALLEL_ALGORITHM_STABLE_SORT_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/execution_policy.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // stable_sort
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        // Merge the two sorted ranges [first1, last1) and [first2, last2) by
+        // moving their elements to dest. Equivalent elements of the first
+        // range precede those of the second range.
+        template <typename Iter1, typename Iter2, typename Compare>
+        Iter2 sequential_move_merge(Iter1 first1, Iter1 last1, Iter1 first2,
+            Iter1 last2, Iter2 dest, Compare& comp)
+        {
+            while (first1 != last1 && first2 != last2)
+            {
+                if (comp(*first2, *first1))
+                    *dest++ = std::move(*first2++);
+                else
+                    *dest++ = std::move(*first1++);
+            }
+            dest = std::move(first1, last1, dest);
+            return std::move(first2, last2, dest);
+        }
+
+        // Parallel version of the above: the larger of the two ranges is
+        // split at its middle and the other one at the corresponding
+        // (stability preserving) bound, both halves are merged concurrently.
+        template <typename ExPolicy, typename Iter1, typename Iter2,
+            typename Compare>
+        void parallel_move_merge(ExPolicy& policy, Iter1 first1, Iter1 last1,
+            Iter1 first2, Iter1 last2, Iter2 dest, Compare& comp,
+            std::size_t chunk_size)
+        {
+            std::size_t const size1 = last1 - first1;
+            std::size_t const size2 = last2 - first2;
+
+            if (size1 + size2 <= chunk_size)
+            {
+                sequential_move_merge(first1, last1, first2, last2, dest, comp);
+                return;
+            }
+
+            Iter1 mid1 = first1;
+            Iter1 mid2 = first2;
+            if (size1 >= size2)
+            {
+                mid1 = first1 + size1 / 2;
+                mid2 = std::lower_bound(first2, last2, *mid1, comp);
+            }
+            else
+            {
+                mid2 = first2 + size2 / 2;
+                mid1 = std::upper_bound(first1, last1, *mid2, comp);
+            }
+
+            Iter2 dest_mid = dest + (mid1 - first1) + (mid2 - first2);
+
+            sort_fork_join(policy,
+                [&]() {
+                    parallel_move_merge(policy, first1, mid1, first2, mid2,
+                        dest, comp, chunk_size);
+                },
+                [&]() {
+                    parallel_move_merge(policy, mid1, last1, mid2, last2,
+                        dest_mid, comp, chunk_size);
+                });
+        }
+
+        // Merge sort of [first, last) using the scratch range starting at
+        // buffer. The sorted sequence ends up in the scratch range if
+        // into_buffer is true, otherwise it ends up in [first, last). Both
+        // halves are sorted into the respectively other range, which allows
+        // to merge them into the target without additional copies.
+        template <typename ExPolicy, typename Iter1, typename Iter2,
+            typename Compare>
+        void parallel_stable_sort_helper(ExPolicy& policy, Iter1 first,
+            Iter1 last, Iter2 buffer, Compare& comp, std::size_t chunk_size,
+            bool into_buffer)
+        {
+            std::size_t const size = last - first;
+            if (size <= chunk_size)
+            {
+                std::stable_sort(first, last, comp);
+                if (into_buffer)
+                    std::move(first, last, buffer);
+                return;
+            }
+
+            std::size_t const half = size / 2;
+
+            sort_fork_join(policy,
+                [&]() {
+                    parallel_stable_sort_helper(policy, first, first + half,
+                        buffer, comp, chunk_size, !into_buffer);
+                },
+                [&]() {
+                    parallel_stable_sort_helper(policy, first + half, last,
+                        buffer + half, comp, chunk_size, !into_buffer);
+                });
+
+            if (into_buffer)
+            {
+                parallel_move_merge(policy, first, first + half, first + half,
+                    last, buffer, comp, chunk_size);
+            }
+            else
+            {
+                parallel_move_merge(policy, buffer, buffer + half,
+                    buffer + half, buffer + size, first, comp, chunk_size);
+            }
+        }
+
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<RandomIt> parallel_stable_sort_async(
+            ExPolicy&& policy, RandomIt first, RandomIt last, Compare comp)
+        {
+            std::ptrdiff_t N = last - first;
+            HPX_ASSERT(N >= 0);
+
+            std::size_t const chunk_size =
+                get_sort_chunk_size(policy, std::size_t(N));
+
+            if (std::size_t(N) <= chunk_size)
+            {
+                std::stable_sort(first, last, comp);
+                return hpx::make_ready_future(last);
+            }
+
+            // check if already sorted
+            if (detail::is_sorted_sequential(first, last, comp))
+                return hpx::make_ready_future(last);
+
+            using policy_type = typename std::decay<ExPolicy>::type;
+
+            return execution::async_execute(policy.executor(),
+                [policy = std::forward<ExPolicy>(policy), first, last,
+                    comp = std::move(comp),
+                    chunk_size]() mutable -> RandomIt {
+                    try
+                    {
+                        // The elements are moved into the scratch buffer
+                        // which is then sorted back into [first, last).
+                        using value_type = typename std::iterator_traits<
+                            RandomIt>::value_type;
+
+                        std::vector<value_type> buffer(
+                            std::make_move_iterator(first),
+                            std::make_move_iterator(last));
+
+                        parallel_stable_sort_helper(policy, buffer.begin(),
+                            buffer.end(), first, comp, chunk_size, true);
+
+                        return last;
+                    }
+                    catch (...)
+                    {
+                        util::detail::handle_local_exceptions<
+                            policy_type>::call(std::current_exception());
+                    }
+
+                    // Not reachable.
+                    HPX_ASSERT(false);
+                    return last;
+                });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // stable_sort
+        template <typename RandomIt>
+        struct stable_sort
+          : public detail::algorithm<stable_sort<RandomIt>, RandomIt>
+        {
+            stable_sort()
+              : stable_sort::algorithm("stable_sort")
+            {
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static RandomIt sequential(ExPolicy, RandomIt first, RandomIt last,
+                Compare&& comp, Proj&& proj)
+            {
+                std::stable_sort(first, last,
+                    util::compare_projected<Compare, Proj>(
+                        std::forward<Compare>(comp), std::forward<Proj>(proj)));
+                return last;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            parallel(ExPolicy&& policy, RandomIt first, RandomIt last,
+                Compare&& comp, Proj&& proj)
+            {
+                typedef util::detail::algorithm_result<ExPolicy, RandomIt>
+                    algorithm_result;
+
+                try
+                {
+                    // call the sort routine and return the right type,
+                    // depending on execution policy
+                    return algorithm_result::get(parallel_stable_sort_async(
+                        std::forward<ExPolicy>(policy), first, last,
+                        util::compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj))));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+
+    //-----------------------------------------------------------------------------
+    /// Sorts the elements in the range [first, last) in ascending order. The
+    /// relative order of equal elements is preserved. The function
+    /// uses the given comparison function object comp (defaults to using
+    /// operator<()).
+    ///
+    /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
+    ///                     comparisons.
+    ///
+    /// A sequence is sorted with respect to a comparator \a comp and a
+    /// projection \a proj if for every iterator i pointing to the sequence and
+    /// every non-negative integer n such that i + n is a valid iterator
+    /// pointing to an element of the sequence, and
+    /// INVOKE(comp, INVOKE(proj, *(i + n)), INVOKE(proj, *i)) == false.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The parallel version of this algorithm is a merge sort which requires
+    /// a scratch buffer holding N elements. The value type of the sequence
+    /// has to be move constructible.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a stable_sort algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandomIt
+    ///           otherwise.
+    ///           The algorithm returns an iterator pointing to the first
+    ///           element after the last element in the input sequence.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RandomIt,
+        typename Proj = util::projection_identity,
+        typename Compare = detail::less,
+        HPX_CONCEPT_REQUIRES_(execution::is_execution_policy<ExPolicy>::value&&
+                hpx::traits::is_iterator<RandomIt>::value&&
+                    traits::is_projected<Proj, RandomIt>::value&&
+                        traits::is_indirect_callable<ExPolicy, Compare,
+                            traits::projected<Proj, RandomIt>,
+                            traits::projected<Proj, RandomIt>>::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    stable_sort(ExPolicy&& policy, RandomIt first, RandomIt last,
+        Compare&& comp = Compare(), Proj&& proj = Proj())
+    {
+        static_assert((hpx::traits::is_random_access_iterator<RandomIt>::value),
+            "Requires a random access iterator.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::stable_sort<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+}}}    // namespace hpx::parallel::v1
+
+#endif
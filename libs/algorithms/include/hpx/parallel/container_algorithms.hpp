@@ -21,6 +21,9 @@
 #include <hpx/parallel/container_algorithms/merge.hpp>
 #include <hpx/parallel/container_algorithms/minmax.hpp>
 #include <hpx/parallel/container_algorithms/move.hpp>
+#include <hpx/parallel/container_algorithms/nth_element.hpp>
+#include <hpx/parallel/container_algorithms/partial_sort.hpp>
+#include <hpx/parallel/container_algorithms/partial_sort_copy.hpp>
 #include <hpx/parallel/container_algorithms/partition.hpp>
 #include <hpx/parallel/container_algorithms/remove.hpp>
 #include <hpx/parallel/container_algorithms/remove_copy.hpp>
@@ -29,6 +32,7 @@
 #include <hpx/parallel/container_algorithms/rotate.hpp>
 #include <hpx/parallel/container_algorithms/search.hpp>
 #include <hpx/parallel/container_algorithms/sort.hpp>
+#include <hpx/parallel/container_algorithms/stable_sort.hpp>
 #include <hpx/parallel/container_algorithms/transform.hpp>
 #include <hpx/parallel/container_algorithms/unique.hpp>
 
@@ -0,0 +1,109 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/container_algorithms/partial_sort_copy.hpp
+
+#if !defined(HPX_PARALLEL_CONTAINER_ALGORITHM_PARTIAL_SORT_COPY_HPP)
+#define HPX_PARALLEL_CONTAINER_ALGORITHM_PARTIAL_SORT_COPY_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/iterator_support/traits/is_range.hpp>
+
+#include <hpx/parallel/algorithms/partial_sort_copy.hpp>
+#include <hpx/parallel/traits/projected_range.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    /// Sorts some of the elements of the range \a rng1 in ascending order,
+    /// storing the result in the range \a rng2. The smallest
+    /// n = min(size(rng1), size(rng2)) elements of \a rng1 are placed
+    /// sorted to the first n elements of \a rng2. The order of equal
+    /// elements is not guaranteed to be preserved.
+    ///
+    /// \note   Complexity: Approximately N log(n) applications of the
+    ///             predicate, where N = std::distance(begin(rng1), end(rng1)).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam Rng1        The type of the source range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of a forward iterator.
+    /// \tparam Rng2        The type of the destination range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of a random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param rng1         Refers to the sequence of elements the algorithm
+    ///                     will be applied to.
+    /// \param rng2         Refers to the destination range.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a partial_sort_copy algorithm returns a
+    ///           \a hpx::future<Iter> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a Iter
+    ///           otherwise, where \a Iter is the iterator type of \a rng2.
+    ///           It returns an iterator to the element defining the upper
+    ///           boundary of the sorted range in \a rng2.
+    template <typename ExPolicy, typename Rng1, typename Rng2,
+        typename Proj = util::projection_identity,
+        typename Compare = detail::less,
+        HPX_CONCEPT_REQUIRES_(execution::is_execution_policy<ExPolicy>::value&&
+                hpx::traits::is_range<Rng1>::value&&
+                    hpx::traits::is_range<Rng2>::value&&
+                        traits::is_projected_range<Proj, Rng1>::value&&
+                            traits::is_indirect_callable<ExPolicy, Compare,
+                                traits::projected_range<Proj, Rng1>,
+                                traits::projected_range<Proj, Rng1>>::value)>
+    typename util::detail::algorithm_result<ExPolicy,
+        typename hpx::traits::range_iterator<Rng2>::type>::type
+    partial_sort_copy(ExPolicy&& policy, Rng1&& rng1, Rng2&& rng2,
+        Compare&& comp = Compare(), Proj&& proj = Proj())
+    {
+        return partial_sort_copy(std::forward<ExPolicy>(policy),
+            hpx::util::begin(rng1), hpx::util::end(rng1),
+            hpx::util::begin(rng2), hpx::util::end(rng2),
+            std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+}}}    // namespace hpx::parallel::v1
+
+#endif
@@ -0,0 +1,112 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_UTIL_DETAIL_PARTITIONER_BULK_EXECUTE)
+#define HPX_PARALLEL_UTIL_DETAIL_PARTITIONER_BULK_EXECUTE
+
+#include <hpx/config.hpp>
+#include <hpx/errors.hpp>
+#include <hpx/lcos/future.hpp>
+
+#include <hpx/execution/execution_policy.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/traits/executor_traits.hpp>
+
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace util { namespace detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // Executors with an aggregated bulk_sync_execute run all chunks through
+    // a single shared state. The results are handed to the reduction step as
+    // ready futures, for void results no futures are created at all.
+    template <typename Result>
+    struct partitioner_bulk_sync_execute
+    {
+        template <typename Executor, typename F, typename Shape>
+        static std::vector<hpx::future<Result>> call(
+            Executor&& exec, F&& f, Shape const& shape)
+        {
+            std::vector<Result> results = execution::bulk_sync_execute(
+                std::forward<Executor>(exec), std::forward<F>(f), shape);
+
+            std::vector<hpx::future<Result>> workitems;
+            workitems.reserve(results.size());
+            for (auto&& result : results)
+            {
+                workitems.push_back(
+                    hpx::make_ready_future<Result>(std::move(result)));
+            }
+            return workitems;
+        }
+    };
+
+    template <>
+    struct partitioner_bulk_sync_execute<void>
+    {
+        template <typename Executor, typename F, typename Shape>
+        static std::vector<hpx::future<void>> call(
+            Executor&& exec, F&& f, Shape const& shape)
+        {
+            execution::bulk_sync_execute(
+                std::forward<Executor>(exec), std::forward<F>(f), shape);
+            return std::vector<hpx::future<void>>();
+        }
+    };
+
+    template <typename Result, typename Executor, typename F, typename Shape>
+    std::vector<hpx::future<Result>> partitioner_bulk_execute(
+        std::true_type, Executor&& exec, F&& f, Shape const& shape)
+    {
+        try
+        {
+            return partitioner_bulk_sync_execute<Result>::call(
+                std::forward<Executor>(exec), std::forward<F>(f), shape);
+        }
+        catch (hpx::exception_list const& errors)
+        {
+            // report every exception as if it was stored in the future of
+            // the chunk which has thrown it
+            std::vector<hpx::future<Result>> workitems;
+            workitems.reserve(errors.size());
+            for (std::exception_ptr const& e : errors)
+            {
+                workitems.push_back(hpx::make_exceptional_future<Result>(e));
+            }
+            return workitems;
+        }
+    }
+
+    template <typename Result, typename Executor, typename F, typename Shape>
+    std::vector<hpx::future<Result>> partitioner_bulk_execute(
+        std::false_type, Executor&& exec, F&& f, Shape const& shape)
+    {
+        return execution::bulk_async_execute(
+            std::forward<Executor>(exec), std::forward<F>(f), shape);
+    }
+
+    // Schedule all chunks described by the given shape. Synchronous
+    // policies use bulk_sync_execute if the executor implements it without
+    // a future per chunk.
+    template <typename Result, typename ExPolicy, typename F, typename Shape>
+    std::vector<hpx::future<Result>> partitioner_bulk_execute(
+        ExPolicy&& policy, F&& f, Shape const& shape)
+    {
+        using executor_type =
+            typename std::decay<ExPolicy>::type::executor_type;
+        using is_aggregated = std::integral_constant<bool,
+            execution::has_aggregated_bulk_sync_execute<executor_type>::value &&
+                !execution::is_async_execution_policy<ExPolicy>::value>;
+
+        return partitioner_bulk_execute<Result>(
+            is_aggregated{}, policy.executor(), std::forward<F>(f), shape);
+    }
+}}}}    // namespace hpx::parallel::util::detail
+
+#endif
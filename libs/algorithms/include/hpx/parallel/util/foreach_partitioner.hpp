@@ -22,6 +22,7 @@
 #include <hpx/execution/executors/execution_parameters.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/detail/partitioner_bulk_execute.hpp>
 #include <hpx/parallel/util/detail/partitioner_iteration.hpp>
 #include <hpx/parallel/util/detail/scoped_executor_parameters.hpp>
 #include <hpx/parallel/util/detail/select_partitioner.hpp>
@@ -58,9 +59,9 @@ namespace hpx { namespace parallel { namespace util {
                 inititems, f, first, count, 1);
 
             std::vector<hpx::future<Result>> workitems =
-                execution::bulk_async_execute(policy.executor(),
+                detail::partitioner_bulk_execute<Result>(policy,
                     partitioner_iteration<Result, F>{std::forward<F>(f)},
-                    std::move(shape));
+                    shape);
             return std::make_pair(std::move(inititems), std::move(workitems));
         }
 
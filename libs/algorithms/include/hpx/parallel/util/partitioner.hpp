@@ -23,6 +23,7 @@
 #include <hpx/execution/executors/execution_parameters.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/detail/partitioner_bulk_execute.hpp>
 #include <hpx/parallel/util/detail/partitioner_iteration.hpp>
 #include <hpx/parallel/util/detail/scoped_executor_parameters.hpp>
 #include <hpx/parallel/util/detail/select_partitioner.hpp>
@@ -58,9 +59,9 @@ namespace hpx { namespace parallel { namespace util {
                 inititems, f, first, count, 1);
 
             std::vector<hpx::future<Result>> workitems =
-                execution::bulk_async_execute(policy.executor(),
+                detail::partitioner_bulk_execute<Result>(policy,
                     partitioner_iteration<Result, F>{std::forward<F>(f)},
-                    std::move(shape));
+                    shape);
 
             if (inititems.empty())
                 return workitems;
@@ -90,9 +91,9 @@ namespace hpx { namespace parallel { namespace util {
                 inititems, f, first, count, stride);
 
             std::vector<hpx::future<Result>> workitems =
-                execution::bulk_async_execute(policy.executor(),
+                detail::partitioner_bulk_execute<Result>(policy,
                     partitioner_iteration<Result, F>{std::forward<F>(f)},
-                    std::move(shape));
+                    shape);
 
             if (inititems.empty())
                 return workitems;
@@ -142,9 +143,8 @@ namespace hpx { namespace parallel { namespace util {
             }
             HPX_ASSERT(chunk_size_it == chunk_sizes.end());
 
-            return execution::bulk_async_execute(policy.executor(),
-                partitioner_iteration<Result, F>{std::forward<F>(f)},
-                std::move(shape));
+            return detail::partitioner_bulk_execute<Result>(policy,
+                partitioner_iteration<Result, F>{std::forward<F>(f)}, shape);
         }
 
         ///////////////////////////////////////////////////////////////////////
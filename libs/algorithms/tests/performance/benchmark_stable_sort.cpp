@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/format.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_generate.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/testing.hpp>
+#include <hpx/timing.hpp>
+
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+///////////////////////////////////////////////////////////////////////////////
+
+struct random_fill
+{
+    random_fill(std::size_t random_range)
+      : gen(seed)
+      , dist(0, random_range - 1)
+    {
+    }
+
+    int operator()()
+    {
+        return dist(gen);
+    }
+
+    std::mt19937 gen;
+    std::uniform_int_distribution<> dist;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+double run_stable_sort_benchmark_std(
+    int test_count, std::vector<int> const& org)
+{
+    std::uint64_t time = 0;
+
+    for (int i = 0; i < test_count; ++i)
+    {
+        std::vector<int> v = org;
+
+        std::uint64_t elapsed = hpx::util::high_resolution_clock::now();
+        std::stable_sort(std::begin(v), std::end(v));
+        time += hpx::util::high_resolution_clock::now() - elapsed;
+    }
+
+    return (time * 1e-9) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+double run_stable_sort_benchmark_hpx(int test_count, ExPolicy policy,
+    std::vector<int> const& org)
+{
+    std::uint64_t time = 0;
+
+    for (int i = 0; i < test_count; ++i)
+    {
+        std::vector<int> v = org;
+
+        std::uint64_t elapsed = hpx::util::high_resolution_clock::now();
+        hpx::parallel::stable_sort(policy, std::begin(v), std::end(v));
+        time += hpx::util::high_resolution_clock::now() - elapsed;
+    }
+
+    return (time * 1e-9) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void run_benchmark(
+    std::size_t vector_size, int test_count, std::size_t random_range)
+{
+    std::cout << "* Preparing Benchmark..." << std::endl;
+
+    std::vector<int> org(vector_size);
+
+    // initialize data
+    using namespace hpx::parallel;
+    generate(execution::par, std::begin(org), std::end(org),
+        random_fill(random_range));
+
+    std::cout << "* Running Benchmark..." << std::endl;
+    std::cout << "--- run_stable_sort_benchmark_std ---" << std::endl;
+    double time_std = run_stable_sort_benchmark_std(test_count, org);
+
+    std::cout << "--- run_stable_sort_benchmark_seq ---" << std::endl;
+    double time_seq =
+        run_stable_sort_benchmark_hpx(test_count, execution::seq, org);
+
+    std::cout << "--- run_stable_sort_benchmark_par ---" << std::endl;
+    double time_par =
+        run_stable_sort_benchmark_hpx(test_count, execution::par, org);
+
+    std::cout << "--- run_stable_sort_benchmark_par_unseq ---" << std::endl;
+    double time_par_unseq = run_stable_sort_benchmark_hpx(
+        test_count, execution::par_unseq, org);
+
+    std::cout << "\n-------------- Benchmark Result --------------"
+              << std::endl;
+    auto fmt = "stable_sort ({1}) : {2}(sec)";
+    hpx::util::format_to(std::cout, fmt, "std", time_std) << std::endl;
+    hpx::util::format_to(std::cout, fmt, "seq", time_seq) << std::endl;
+    hpx::util::format_to(std::cout, fmt, "par", time_par) << std::endl;
+    hpx::util::format_to(std::cout, fmt, "par_unseq", time_par_unseq)
+        << std::endl;
+    std::cout << "----------------------------------------------" << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    // pull values from cmd
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    std::size_t random_range = vm["random_range"].as<std::size_t>();
+    int test_count = vm["test_count"].as<int>();
+
+    std::size_t const os_threads = hpx::get_os_thread_count();
+
+    if (random_range < 1)
+        random_range = 1;
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "seed         : " << seed << std::endl;
+    std::cout << "vector_size  : " << vector_size << std::endl;
+    std::cout << "random_range : " << random_range << std::endl;
+    std::cout << "test_count   : " << test_count << std::endl;
+    std::cout << "os threads   : " << os_threads << std::endl;
+    std::cout << "----------------------------------------------\n"
+              << std::endl;
+
+    run_benchmark(vector_size, test_count, random_range);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("vector_size",
+        hpx::program_options::value<std::size_t>()->default_value(1000000),
+        "size of vector (default: 1000000)")("random_range",
+        hpx::program_options::value<std::size_t>()->default_value(1000000),
+        "range of random numbers [0, x) (default: 1000000)")("test_count",
+        hpx::program_options::value<int>()->default_value(10),
+        "number of tests to be averaged (default: 10)")("seed,s",
+        hpx::program_options::value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,160 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+// large enough to be split into several tasks
+std::size_t const test_size = 300007;
+
+std::vector<int> make_test_data(std::size_t size)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dis(0, 10000);
+
+    std::vector<int> c(size);
+    for (auto& v : c)
+    {
+        v = dis(gen);
+    }
+    return c;
+}
+
+struct throw_always
+{
+    template <typename T>
+    bool operator()(T const&, T const&) const
+    {
+        throw std::runtime_error("test");
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename Compare>
+void test_partial_sort(
+    ExPolicy policy, std::size_t size, std::size_t n, Compare comp)
+{
+    auto c = make_test_data(size);
+    auto d = c;
+
+    auto result = hpx::parallel::partial_sort(
+        policy, c.begin(), c.begin() + n, c.end(), comp);
+    HPX_TEST(result == c.end());
+
+    std::partial_sort(d.begin(), d.begin() + n, d.end(), comp);
+    HPX_TEST(std::equal(c.begin(), c.begin() + n, d.begin()));
+
+    // the elements have been permuted only
+    std::sort(c.begin(), c.end());
+    std::sort(d.begin(), d.end());
+    HPX_TEST(c == d);
+}
+
+template <typename ExPolicy>
+void test_partial_sort_async(ExPolicy policy, std::size_t size, std::size_t n)
+{
+    auto c = make_test_data(size);
+    auto d = c;
+
+    auto f = hpx::parallel::partial_sort(
+        policy, c.begin(), c.begin() + n, c.end());
+    HPX_TEST(f.get() == c.end());
+
+    std::partial_sort(d.begin(), d.begin() + n, d.end());
+    HPX_TEST(std::equal(c.begin(), c.begin() + n, d.begin()));
+}
+
+template <typename ExPolicy>
+void test_partial_sort_exception(ExPolicy policy)
+{
+    auto c = make_test_data(test_size);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::parallel::partial_sort(
+            policy, c.begin(), c.begin() + 1000, c.end(), throw_always());
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+    HPX_TEST(caught_exception);
+}
+
+void partial_sort_test()
+{
+    using namespace hpx::parallel;
+
+    for (std::size_t size : {std::size_t(1), std::size_t(1000), test_size})
+    {
+        for (std::size_t n : {std::size_t(0), std::size_t(1), size / 2, size})
+        {
+            test_partial_sort(execution::seq, size, n, std::less<int>());
+            test_partial_sort(execution::par, size, n, std::less<int>());
+            test_partial_sort(execution::par_unseq, size, n, std::less<int>());
+            test_partial_sort(execution::par, size, n, std::greater<int>());
+
+            test_partial_sort_async(execution::seq(execution::task), size, n);
+            test_partial_sort_async(execution::par(execution::task), size, n);
+        }
+    }
+
+    test_partial_sort_exception(execution::seq);
+    test_partial_sort_exception(execution::par);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+
+    partial_sort_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,225 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/algorithms/sort_by_key.hpp>
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// the sizes are chosen to be large enough to select the radix sort
+#if defined(HPX_DEBUG)
+std::size_t const test_size = 300007;
+#else
+std::size_t const test_size = 1000003;
+#endif
+
+std::mt19937 gen;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, std::vector<T>>::type
+make_keys(T lower, T upper)
+{
+    // std::uniform_int_distribution does not support character types
+    using int_type = typename std::conditional<std::is_signed<T>::value,
+        long long, unsigned long long>::type;
+    std::uniform_int_distribution<int_type> dist(lower, upper);
+
+    std::vector<T> c(test_size);
+    std::generate(c.begin(), c.end(), [&]() { return T(dist(gen)); });
+    return c;
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, std::vector<T>>::type
+make_keys(T lower, T upper)
+{
+    std::uniform_real_distribution<T> dist(lower, upper);
+
+    std::vector<T> c(test_size);
+    std::generate(c.begin(), c.end(), [&]() { return dist(gen); });
+
+    // make sure positive and negative zeros are present as well
+    c[0] = T(-0.0);
+    c[1] = T(0.0);
+    return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T, typename Compare = std::less<T>>
+void test_sort_radix(ExPolicy&& policy, T lower, T upper,
+    Compare comp = Compare())
+{
+    std::vector<T> c = make_keys(lower, upper);
+    std::vector<T> expected = c;
+    std::sort(expected.begin(), expected.end(), comp);
+
+    auto result = hpx::parallel::sort(policy, c.begin(), c.end(), comp);
+    HPX_TEST(result == c.end());
+
+    // positive and negative zeros compare equal, compare the values only
+    HPX_TEST(std::equal(c.begin(), c.end(), expected.begin(),
+        [](T lhs, T rhs) { return !(lhs < rhs) && !(rhs < lhs); }));
+}
+
+template <typename ExPolicy, typename T>
+void test_sort_radix_async(ExPolicy&& policy, T lower, T upper)
+{
+    std::vector<T> c = make_keys(lower, upper);
+    std::vector<T> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    auto f = hpx::parallel::sort(policy, c.begin(), c.end());
+    HPX_TEST(f.get() == c.end());
+
+    HPX_TEST(c == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct element
+{
+    std::int64_t key;
+    std::string payload;
+};
+
+template <typename ExPolicy>
+void test_sort_radix_projection(ExPolicy&& policy)
+{
+    std::vector<std::int64_t> keys = make_keys(
+        (std::numeric_limits<std::int64_t>::min)(),
+        (std::numeric_limits<std::int64_t>::max)());
+
+    std::vector<element> c;
+    c.reserve(keys.size());
+    for (std::int64_t key : keys)
+        c.push_back(element{key, std::to_string(key)});
+
+    auto result = hpx::parallel::sort(policy, c.begin(), c.end(),
+        std::greater<std::int64_t>(),
+        [](element const& e) -> std::int64_t { return e.key; });
+    HPX_TEST(result == c.end());
+
+    std::sort(keys.begin(), keys.end(), std::greater<std::int64_t>());
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        HPX_TEST_EQ(c[i].key, keys[i]);
+        HPX_TEST_EQ(c[i].payload, std::to_string(keys[i]));
+    }
+}
+
+template <typename ExPolicy>
+void test_sort_by_key_radix(ExPolicy&& policy)
+{
+    std::vector<std::uint64_t> keys = make_keys(
+        std::uint64_t(0), (std::numeric_limits<std::uint64_t>::max)());
+
+    std::vector<std::string> values;
+    values.reserve(keys.size());
+    for (std::uint64_t key : keys)
+        values.push_back(std::to_string(key));
+
+    hpx::parallel::sort_by_key(policy, keys.begin(), keys.end(),
+        values.begin());
+
+    HPX_TEST(std::is_sorted(keys.begin(), keys.end()));
+    for (std::size_t i = 0; i != keys.size(); ++i)
+    {
+        HPX_TEST_EQ(values[i], std::to_string(keys[i]));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_sort_radix(ExPolicy&& policy)
+{
+    test_sort_radix(policy, (std::numeric_limits<std::int8_t>::min)(),
+        (std::numeric_limits<std::int8_t>::max)());
+    test_sort_radix(policy, std::uint16_t(0),
+        (std::numeric_limits<std::uint16_t>::max)());
+    test_sort_radix(policy, (std::numeric_limits<std::int32_t>::min)(),
+        (std::numeric_limits<std::int32_t>::max)());
+    test_sort_radix(policy, (std::numeric_limits<std::int64_t>::min)(),
+        (std::numeric_limits<std::int64_t>::max)());
+    test_sort_radix(policy, std::uint64_t(0),
+        (std::numeric_limits<std::uint64_t>::max)());
+
+    // keys which are equal in most of their digits
+    test_sort_radix(policy, std::uint64_t(0), std::uint64_t(255));
+    test_sort_radix(policy, std::int64_t(-10), std::int64_t(10));
+    test_sort_radix(policy, std::uint32_t(42), std::uint32_t(42));
+
+    test_sort_radix(policy, -1.0e6f, 1.0e6f);
+    test_sort_radix(policy, -1.0e300, 1.0e300);
+
+    // descending order
+    test_sort_radix(policy, (std::numeric_limits<std::int32_t>::min)(),
+        (std::numeric_limits<std::int32_t>::max)(),
+        std::greater<std::int32_t>());
+    test_sort_radix(policy, -1.0e300, 1.0e300, std::greater<>());
+
+    test_sort_radix_projection(policy);
+    test_sort_by_key_radix(policy);
+}
+
+void test_sort_radix()
+{
+    using namespace hpx::parallel;
+
+    test_sort_radix(execution::par);
+    test_sort_radix(execution::par_unseq);
+
+    test_sort_radix_async(execution::par(execution::task),
+        (std::numeric_limits<std::int64_t>::min)(),
+        (std::numeric_limits<std::int64_t>::max)());
+    test_sort_radix_async(execution::par(execution::task), -1.0, 1.0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_sort_radix();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,186 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+// large enough to be split into several tasks
+std::size_t const test_size = 300007;
+
+// the keys have many duplicates, the second member records the original
+// position of the element to verify stability
+std::vector<std::pair<int, std::size_t>> make_test_data(std::size_t size)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dis(0, 1000);
+
+    std::vector<std::pair<int, std::size_t>> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        c[i] = std::make_pair(dis(gen), i);
+    }
+    return c;
+}
+
+struct compare_first
+{
+    bool operator()(std::pair<int, std::size_t> const& lhs,
+        std::pair<int, std::size_t> const& rhs) const
+    {
+        return lhs.first < rhs.first;
+    }
+};
+
+struct throw_always
+{
+    template <typename T>
+    bool operator()(T const&, T const&) const
+    {
+        throw std::runtime_error("test");
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_stable_sort(ExPolicy policy, std::size_t size)
+{
+    auto c = make_test_data(size);
+    auto d = c;
+
+    auto result =
+        hpx::parallel::stable_sort(policy, c.begin(), c.end(), compare_first());
+    HPX_TEST(result == c.end());
+
+    std::stable_sort(d.begin(), d.end(), compare_first());
+    HPX_TEST(c == d);
+}
+
+template <typename ExPolicy>
+void test_stable_sort_projection(ExPolicy policy, std::size_t size)
+{
+    auto c = make_test_data(size);
+    auto d = c;
+
+    hpx::parallel::stable_sort(policy, c.begin(), c.end(), std::greater<int>(),
+        [](std::pair<int, std::size_t> const& p) { return p.first; });
+
+    std::stable_sort(d.begin(), d.end(),
+        [](std::pair<int, std::size_t> const& lhs,
+            std::pair<int, std::size_t> const& rhs) {
+            return lhs.first > rhs.first;
+        });
+    HPX_TEST(c == d);
+}
+
+template <typename ExPolicy>
+void test_stable_sort_async(ExPolicy policy, std::size_t size)
+{
+    auto c = make_test_data(size);
+    auto d = c;
+
+    auto f =
+        hpx::parallel::stable_sort(policy, c.begin(), c.end(), compare_first());
+    HPX_TEST(f.get() == c.end());
+
+    std::stable_sort(d.begin(), d.end(), compare_first());
+    HPX_TEST(c == d);
+}
+
+template <typename ExPolicy>
+void test_stable_sort_exception(ExPolicy policy)
+{
+    auto c = make_test_data(test_size);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::parallel::stable_sort(policy, c.begin(), c.end(), throw_always());
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const&)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+    HPX_TEST(caught_exception);
+}
+
+void stable_sort_test()
+{
+    using namespace hpx::parallel;
+
+    for (std::size_t size : {std::size_t(0), std::size_t(1),
+             std::size_t(1000), test_size})
+    {
+        test_stable_sort(execution::seq, size);
+        test_stable_sort(execution::par, size);
+        test_stable_sort(execution::par_unseq, size);
+
+        test_stable_sort_projection(execution::seq, size);
+        test_stable_sort_projection(execution::par, size);
+
+        test_stable_sort_async(execution::seq(execution::task), size);
+        test_stable_sort_async(execution::par(execution::task), size);
+    }
+
+    // make sure the executor parameters are honored
+    test_stable_sort(execution::par.with(execution::static_chunk_size(1000)),
+        test_size);
+
+    test_stable_sort_exception(execution::seq);
+    test_stable_sort_exception(execution::par);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+
+    stable_sort_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,113 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+// large enough to be split into several tasks
+std::size_t const test_size = 300007;
+
+std::vector<int> make_test_data(std::size_t size)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dis(0, 10000);
+
+    std::vector<int> c(size);
+    for (auto& v : c)
+    {
+        v = dis(gen);
+    }
+    return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_partial_sort_copy_range(ExPolicy policy)
+{
+    auto c = make_test_data(test_size);
+    std::vector<int> d(100);
+    std::vector<int> e(100);
+
+    auto result = hpx::parallel::partial_sort_copy(policy, c, d);
+    HPX_TEST(result == d.end());
+
+    std::partial_sort_copy(c.begin(), c.end(), e.begin(), e.end());
+    HPX_TEST(d == e);
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy_range_async(ExPolicy policy)
+{
+    auto c = make_test_data(test_size);
+    std::vector<int> d(test_size / 2);
+    std::vector<int> e(test_size / 2);
+
+    auto f =
+        hpx::parallel::partial_sort_copy(policy, c, d, std::greater<int>());
+    HPX_TEST(f.get() == d.end());
+
+    std::partial_sort_copy(
+        c.begin(), c.end(), e.begin(), e.end(), std::greater<int>());
+    HPX_TEST(d == e);
+}
+
+void partial_sort_copy_range_test()
+{
+    using namespace hpx::parallel;
+
+    test_partial_sort_copy_range(execution::seq);
+    test_partial_sort_copy_range(execution::par);
+    test_partial_sort_copy_range(execution::par_unseq);
+
+    test_partial_sort_copy_range_async(execution::seq(execution::task));
+    test_partial_sort_copy_range_async(execution::par(execution::task));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+
+    partial_sort_copy_range_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,114 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+// large enough to be split into several tasks
+std::size_t const test_size = 300007;
+
+std::vector<int> make_test_data(std::size_t size)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dis(0, 10000);
+
+    std::vector<int> c(size);
+    for (auto& v : c)
+    {
+        v = dis(gen);
+    }
+    return c;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_stable_sort_range(ExPolicy policy)
+{
+    auto c = make_test_data(test_size);
+    auto d = c;
+
+    // compare the last decimal digit only to have many equivalent elements
+    auto proj = [](int v) { return v % 10; };
+
+    auto result =
+        hpx::parallel::stable_sort(policy, c, std::less<int>(), proj);
+    HPX_TEST(result == c.end());
+
+    std::stable_sort(d.begin(), d.end(),
+        [&](int lhs, int rhs) { return proj(lhs) < proj(rhs); });
+    HPX_TEST(c == d);
+}
+
+template <typename ExPolicy>
+void test_stable_sort_range_async(ExPolicy policy)
+{
+    auto c = make_test_data(test_size);
+    auto d = c;
+
+    auto f = hpx::parallel::stable_sort(policy, c, std::greater<int>());
+    HPX_TEST(f.get() == c.end());
+
+    std::stable_sort(d.begin(), d.end(), std::greater<int>());
+    HPX_TEST(c == d);
+}
+
+void stable_sort_range_test()
+{
+    using namespace hpx::parallel;
+
+    test_stable_sort_range(execution::seq);
+    test_stable_sort_range(execution::par);
+    test_stable_sort_range(execution::par_unseq);
+
+    test_stable_sort_range_async(execution::seq(execution::task));
+    test_stable_sort_range_async(execution::par(execution::task));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+
+    stable_sort_range_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
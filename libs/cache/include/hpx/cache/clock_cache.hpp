@@ -0,0 +1,379 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_UTIL_CACHE_CLOCK_CACHE_HPP
+#define HPX_UTIL_CACHE_CLOCK_CACHE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+
+#include <cstddef>
+#include <map>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util { namespace cache {
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class clock_cache clock_cache.hpp hpx/cache/clock_cache.hpp
+    ///
+    /// \brief The \a clock_cache implements a local (non-distributed) cache
+    ///        using the CLOCK (second chance) replacement policy, which
+    ///        approximates LRU. As opposed to the \a lru_cache, a hit only
+    ///        sets a reference bit of the entry instead of relinking it,
+    ///        which keeps lookups cheap.
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache
+    /// \tparam Entry         The type of the items to be held in the cache.
+    /// \tparam Statistics    A (optional) type allowing to collect some basic
+    ///                       statistics about the operation of the cache
+    ///                       instance. The type must conform to the
+    ///                       CacheStatistics concept. The default value is
+    ///                       the type \a statistics#no_statistics which does
+    ///                       not collect any numbers, but provides empty stubs
+    ///                       allowing the code to compile.
+    template <typename Key, typename Entry,
+        typename Statistics = statistics::no_statistics>
+    class clock_cache
+    {
+    public:
+        typedef Key key_type;
+        typedef Entry entry_type;
+        typedef Statistics statistics_type;
+        typedef std::pair<key_type, entry_type> entry_pair;
+        typedef std::size_t size_type;
+
+    private:
+        typedef typename statistics_type::update_on_exit update_on_exit;
+        typedef std::map<key_type, size_type> map_type;
+
+        struct slot
+        {
+            typename map_type::iterator it_;
+            entry_type entry_;
+            bool referenced_;
+        };
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of a clock_cache.
+        ///
+        /// \param max_size   [in] The maximal number of entries this cache is
+        ///                   allowed to hold at any time. The default is zero
+        ///                   (no size limitation).
+        ///
+        clock_cache(size_type max_size = 0)
+          : max_size_(max_size)
+          , hand_(0)
+        {
+        }
+
+        clock_cache(clock_cache&& other) = default;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return current size of the cache.
+        ///
+        /// \returns The current size of this cache instance.
+        size_type size() const
+        {
+            return slots_.size();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Access the maximum size the cache is allowed to grow to.
+        ///
+        /// \returns    The maximum size this cache instance is currently
+        ///             allowed to reach. If this number is zero the cache has
+        ///             no limitation with regard to a maximum size.
+        size_type capacity() const
+        {
+            return max_size_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Change the maximum size this cache can grow to
+        ///
+        /// \param max_size    [in] The new maximum size this cache will be
+        ///             allowed to grow to.
+        ///
+        void reserve(size_type max_size)
+        {
+            max_size_ = max_size;
+            while (max_size_ != 0 && slots_.size() > max_size_)
+            {
+                evict();
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Check whether the cache currently holds an entry identified
+        ///        by the given key
+        ///
+        /// \note         This function does not mark the entry as referenced.
+        bool holds_key(key_type const& key) const
+        {
+            return map_.find(key) != map_.end();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key     [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param realkey [out] The key the entry is stored under in the
+        ///               cache.
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \note         The function will mark the entry as referenced if the
+        ///               key was found in the cache.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(
+            key_type const& key, key_type& realkey, entry_type& entry)
+        {
+            update_on_exit update(statistics_, statistics::method_get_entry);
+
+            auto it = map_.find(key);
+            if (it == map_.end())
+            {
+                // Got miss
+                statistics_.got_miss();    // update statistics
+                return false;
+            }
+
+            slot& s = slots_[it->second];
+            s.referenced_ = true;
+
+            // update statistics
+            statistics_.got_hit();
+
+            // got hit
+            realkey = it->first;
+            entry = s.entry_;
+            return true;
+        }
+
+        bool get_entry(key_type const& key, entry_type& entry)
+        {
+            key_type tmp;
+            return get_entry(key, tmp, entry);
+        }
+
+        /// \brief Insert a new entry into this cache
+        ///
+        /// \param key    [in] The key for the entry which should be added to
+        ///               the cache.
+        /// \param entry  [in] The entry which should be added to the cache.
+        ///
+        /// \returns      This function returns \a false if the cache already
+        ///               holds an entry for the given key.
+        bool insert(key_type const& key, entry_type const& entry)
+        {
+            update_on_exit update(statistics_, statistics::method_insert_entry);
+            if (map_.find(key) != map_.end())
+            {
+                return false;
+            }
+
+            insert_nonexist(key, entry);
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache, inserting it if
+        ///        it is not held by the cache yet.
+        void update(key_type const& key, entry_type const& entry)
+        {
+            update_on_exit update(statistics_, statistics::method_update_entry);
+
+            auto it = map_.find(key);
+            if (it == map_.end())
+            {
+                statistics_.got_miss();    // update statistics
+                update_on_exit update(
+                    statistics_, statistics::method_insert_entry);
+                insert_nonexist(key, entry);
+                return;
+            }
+
+            slot& s = slots_[it->second];
+            s.entry_ = entry;
+            s.referenced_ = true;
+
+            statistics_.got_hit();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param key    [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param entry  [in] The value which should be used as a replacement
+        ///               for the existing value in the cache.
+        /// \param f      [in] A callable taking two arguments, \a k and the
+        ///               key found in the cache (in that order). If \a f
+        ///               returns true, then the update will not succeed.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully updated or inserted, otherwise it
+        ///               returns \a false.
+        template <typename F>
+        bool update_if(key_type const& key, entry_type const& entry, F&& f)
+        {
+            update_on_exit update(statistics_, statistics::method_update_entry);
+
+            auto it = map_.find(key);
+            if (it == map_.end())
+            {
+                // got miss
+                statistics_.got_miss();    // update statistics
+                update_on_exit update(
+                    statistics_, statistics::method_insert_entry);
+                insert_nonexist(key, entry);
+                return true;
+            }
+
+            if (f(key, it->first))
+                return false;
+
+            // got hit!
+            slot& s = slots_[it->second];
+            s.entry_ = entry;
+            s.referenced_ = true;
+
+            statistics_.got_hit();
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove stored entries from the cache for which the supplied
+        ///        function object returns true.
+        ///
+        /// \param ep     [in] This parameter has to be a (unary) function
+        ///               object invoked with a std::pair<key_type, entry_type>
+        ///               for each of the entries currently held in the cache.
+        ///
+        /// \returns      This function returns the number of removed entries.
+        template <typename Func>
+        size_type erase(Func const& ep)
+        {
+            update_on_exit update(statistics_, statistics::method_erase_entry);
+
+            size_type erased = 0;
+            for (size_type i = 0; i < slots_.size();)
+            {
+                slot& s = slots_[i];
+                if (ep(entry_pair(s.it_->first, s.entry_)))
+                {
+                    ++erased;
+                    remove_slot(i);
+
+                    // update statistics
+                    statistics_.got_eviction();
+                }
+                else
+                {
+                    ++i;
+                }
+            }
+
+            return erased;
+        }
+
+        /// \brief Clear the cache
+        ///
+        /// Unconditionally removes all stored entries from the cache.
+        size_type clear()
+        {
+            size_type erased = slots_.size();
+            slots_.clear();
+            map_.clear();
+            hand_ = 0;
+            return erased;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Allow to access the embedded statistics instance
+        statistics_type const& get_statistics() const
+        {
+            return statistics_;
+        }
+
+        statistics_type& get_statistics()
+        {
+            return statistics_;
+        }
+
+    private:
+        void insert_nonexist(key_type const& key, entry_type const& entry)
+        {
+            // Do we need to evict a cache entry first?
+            if (max_size_ != 0 && slots_.size() >= max_size_)
+            {
+                evict();
+            }
+
+            auto p = map_.emplace(key, slots_.size());
+            slots_.push_back(slot{p.first, entry, false});
+
+            // update statistics
+            statistics_.got_insertion();
+        }
+
+        // Advance the clock hand, giving referenced entries a second chance,
+        // and remove the first entry which was not referenced since the hand
+        // passed it the last time.
+        void evict()
+        {
+            if (slots_.empty())
+                return;
+
+            while (true)
+            {
+                if (hand_ >= slots_.size())
+                    hand_ = 0;
+
+                slot& s = slots_[hand_];
+                if (!s.referenced_)
+                    break;
+
+                s.referenced_ = false;
+                ++hand_;
+            }
+
+            statistics_.got_eviction();
+            remove_slot(hand_);
+        }
+
+        // Remove the given slot by moving the last slot into its place.
+        void remove_slot(size_type i)
+        {
+            map_.erase(slots_[i].it_);
+
+            size_type last = slots_.size() - 1;
+            if (i != last)
+            {
+                slots_[i] = std::move(slots_[last]);
+                slots_[i].it_->second = i;
+            }
+            slots_.pop_back();
+        }
+
+        size_type max_size_;
+        size_type hand_;
+
+        std::vector<slot> slots_;
+        map_type map_;
+
+        statistics_type statistics_;
+    };
+}}}    // namespace hpx::util::cache
+
+#endif
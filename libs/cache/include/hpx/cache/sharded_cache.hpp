@@ -0,0 +1,273 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_UTIL_CACHE_SHARDED_CACHE_HPP
+#define HPX_UTIL_CACHE_SHARDED_CACHE_HPP
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util { namespace cache {
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class sharded_cache sharded_cache.hpp hpx/cache/sharded_cache.hpp
+    ///
+    /// \brief The \a sharded_cache makes a local cache safe for concurrent
+    ///        use by splitting it into a number of independent shards, each
+    ///        protected by its own lock.
+    ///
+    /// \tparam Cache         The type of the cache used for each of the
+    ///                       shards, e.g. \a clock_cache or \a lru_cache.
+    /// \tparam Mutex         The type of the lock protecting each shard.
+    /// \tparam ShardSelector A function object type which is invoked with a
+    ///                       key and the number of shards. It returns a
+    ///                       std::pair<std::size_t, std::size_t> holding the
+    ///                       index of the first shard responsible for the key
+    ///                       and the number of consecutive (modulo the number
+    ///                       of shards) shards the key has to be stored in.
+    ///                       Keys covering more than one shard (for instance
+    ///                       key ranges) are replicated to all of those.
+    ///                       Lookups are always directed to the first shard.
+    ///
+    /// Eviction happens independently in each of the shards, each shard is
+    /// allowed to hold an equal part of the overall capacity.
+    template <typename Cache, typename Mutex, typename ShardSelector>
+    class sharded_cache
+    {
+    public:
+        typedef Cache cache_type;
+        typedef Mutex mutex_type;
+        typedef typename cache_type::key_type key_type;
+        typedef typename cache_type::entry_type entry_type;
+        typedef typename cache_type::statistics_type statistics_type;
+        typedef std::size_t size_type;
+
+    private:
+        struct shard
+        {
+            mutable mutex_type mtx_;
+            cache_type cache_;
+        };
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of a sharded_cache.
+        ///
+        /// \param num_shards [in] The number of independent shards to create.
+        /// \param max_size   [in] The maximal overall number of entries this
+        ///                   cache is allowed to hold. The default is zero
+        ///                   (no size limitation).
+        ///
+        explicit sharded_cache(size_type num_shards, size_type max_size = 0,
+            ShardSelector selector = ShardSelector())
+          : max_size_(0)
+          , selector_(std::move(selector))
+        {
+            if (num_shards == 0)
+                num_shards = 1;
+
+            shards_.reserve(num_shards);
+            for (size_type i = 0; i != num_shards; ++i)
+            {
+                // each shard is allocated separately to avoid false sharing
+                // between the locks of neighboring shards
+                shards_.emplace_back(new shard);
+            }
+
+            reserve(max_size);
+        }
+
+        sharded_cache(sharded_cache const&) = delete;
+        sharded_cache& operator=(sharded_cache const&) = delete;
+
+        /// \brief Return the number of shards of this cache.
+        size_type num_shards() const
+        {
+            return shards_.size();
+        }
+
+        /// \brief Return current size of the cache.
+        ///
+        /// \note Keys which are replicated to several shards are counted
+        ///       once for each of the shards.
+        size_type size() const
+        {
+            size_type result = 0;
+            for (auto const& s : shards_)
+            {
+                std::lock_guard<mutex_type> l(s->mtx_);
+                result += s->cache_.size();
+            }
+            return result;
+        }
+
+        /// \brief Access the maximum size the cache is allowed to grow to.
+        size_type capacity() const
+        {
+            return max_size_;
+        }
+
+        /// \brief Change the maximum size this cache can grow to. The new
+        ///        size is evenly distributed over all shards.
+        void reserve(size_type max_size)
+        {
+            max_size_ = max_size;
+
+            size_type shard_size = 0;
+            if (max_size != 0)
+            {
+                shard_size = (max_size + shards_.size() - 1) / shards_.size();
+            }
+
+            for (auto& s : shards_)
+            {
+                std::lock_guard<mutex_type> l(s->mtx_);
+                s->cache_.reserve(shard_size);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(
+            key_type const& key, key_type& realkey, entry_type& entry)
+        {
+            shard& s = *shards_[selector_(key, shards_.size()).first];
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            return s.cache_.get_entry(key, realkey, entry);
+        }
+
+        bool get_entry(key_type const& key, entry_type& entry)
+        {
+            key_type tmp;
+            return get_entry(key, tmp, entry);
+        }
+
+        /// \brief Insert a new entry into all shards responsible for the
+        ///        given key.
+        ///
+        /// \returns      This function returns \a false if any of the shards
+        ///               already held an entry for the given key.
+        bool insert(key_type const& key, entry_type const& entry)
+        {
+            bool result = true;
+            for_each_shard(key, [&](cache_type& c) {
+                if (!c.insert(key, entry))
+                    result = false;
+            });
+            return result;
+        }
+
+        /// \brief Update (or insert) an entry in all shards responsible for
+        ///        the given key.
+        void update(key_type const& key, entry_type const& entry)
+        {
+            for_each_shard(
+                key, [&](cache_type& c) { c.update(key, entry); });
+        }
+
+        /// \brief Update (or insert) an entry in all shards responsible for
+        ///        the given key, see \a lru_cache#update_if.
+        ///
+        /// \returns      This function returns \a false if the update did not
+        ///               succeed for any of the shards.
+        template <typename F>
+        bool update_if(key_type const& key, entry_type const& entry, F&& f)
+        {
+            bool result = true;
+            for_each_shard(key, [&](cache_type& c) {
+                if (!c.update_if(key, entry, f))
+                    result = false;
+            });
+            return result;
+        }
+
+        /// \brief Remove stored entries from all shards for which the supplied
+        ///        function object returns true.
+        ///
+        /// \returns      This function returns the number of removed entries.
+        template <typename Func>
+        size_type erase(Func const& ep)
+        {
+            size_type erased = 0;
+            for (auto& s : shards_)
+            {
+                std::lock_guard<mutex_type> l(s->mtx_);
+                erased += s->cache_.erase(ep);
+            }
+            return erased;
+        }
+
+        /// \brief Unconditionally removes all stored entries from the cache.
+        size_type clear()
+        {
+            size_type erased = 0;
+            for (auto& s : shards_)
+            {
+                std::lock_guard<mutex_type> l(s->mtx_);
+                erased += s->cache_.clear();
+            }
+            return erased;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Combine a value extracted from the statistics instances of
+        ///        all shards.
+        ///
+        /// \param f      [in] A callable which is invoked with a reference to
+        ///               the statistics instance of each of the shards. The
+        ///               sum of all returned values is returned.
+        template <typename F>
+        std::int64_t accumulate_statistics(F&& f)
+        {
+            std::int64_t result = 0;
+            for (auto& s : shards_)
+            {
+                std::lock_guard<mutex_type> l(s->mtx_);
+                result += static_cast<std::int64_t>(
+                    f(s->cache_.get_statistics()));
+            }
+            return result;
+        }
+
+    private:
+        template <typename F>
+        void for_each_shard(key_type const& key, F&& f)
+        {
+            std::pair<size_type, size_type> range =
+                selector_(key, shards_.size());
+
+            size_type count = range.second;
+            if (count == 0)
+                count = 1;
+            else if (count > shards_.size())
+                count = shards_.size();
+
+            for (size_type i = 0; i != count; ++i)
+            {
+                shard& s = *shards_[(range.first + i) % shards_.size()];
+
+                std::lock_guard<mutex_type> l(s.mtx_);
+                f(s.cache_);
+            }
+        }
+
+        size_type max_size_;
+        ShardSelector selector_;
+        std::vector<std::unique_ptr<shard>> shards_;
+    };
+}}}    // namespace hpx::util::cache
+
+#endif
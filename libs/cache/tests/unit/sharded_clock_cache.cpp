@@ -0,0 +1,185 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/cache/clock_cache.hpp>
+#include <hpx/cache/sharded_cache.hpp>
+#include <hpx/cache/statistics/local_statistics.hpp>
+#include <hpx/hpx_main.hpp>
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_clock_eviction()
+{
+    using namespace hpx::util::cache;
+
+    typedef clock_cache<int, std::string, statistics::local_statistics>
+        cache_type;
+
+    cache_type c(3);
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.capacity());
+
+    HPX_TEST(c.insert(1, "one"));
+    HPX_TEST(c.insert(2, "two"));
+    HPX_TEST(c.insert(3, "three"));
+    HPX_TEST(!c.insert(3, "three"));
+
+    // referencing entry 1 gives it a second chance
+    std::string value;
+    HPX_TEST(c.get_entry(1, value));
+    HPX_TEST_EQ(value, std::string("one"));
+
+    // entry 2 is the first entry which was not referenced
+    HPX_TEST(c.insert(4, "four"));
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+
+    HPX_TEST(c.holds_key(1));
+    HPX_TEST(!c.holds_key(2));
+    HPX_TEST(c.holds_key(3));
+    HPX_TEST(c.holds_key(4));
+
+    HPX_TEST(!c.get_entry(2, value));
+
+    c.update(3, "drei");
+    HPX_TEST(c.get_entry(3, value));
+    HPX_TEST_EQ(value, std::string("drei"));
+
+    HPX_TEST_EQ(c.erase([](std::pair<int, std::string> const& p) {
+        return p.first != 4;
+    }),
+        static_cast<cache_type::size_type>(2));
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(1), c.size());
+    HPX_TEST(c.holds_key(4));
+
+    statistics::local_statistics const& stat = c.get_statistics();
+    HPX_TEST_EQ(stat.hits(), static_cast<std::size_t>(3));
+    HPX_TEST_EQ(stat.misses(), static_cast<std::size_t>(1));
+    HPX_TEST_EQ(stat.insertions(), static_cast<std::size_t>(4));
+    HPX_TEST_EQ(stat.evictions(), static_cast<std::size_t>(3));
+
+    c.reserve(0);
+    HPX_TEST_EQ(c.clear(), static_cast<cache_type::size_type>(1));
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(0), c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// keys are replicated to 'count' consecutive shards
+struct key_selector
+{
+    std::pair<std::size_t, std::size_t> operator()(
+        std::pair<std::size_t, std::size_t> const& key,
+        std::size_t num_shards) const
+    {
+        return std::make_pair(key.first % num_shards, key.second);
+    }
+};
+
+typedef hpx::util::cache::sharded_cache<
+    hpx::util::cache::clock_cache<std::pair<std::size_t, std::size_t>,
+        std::size_t, hpx::util::cache::statistics::local_statistics>,
+    std::mutex, key_selector>
+    sharded_cache_type;
+
+void test_sharded()
+{
+    sharded_cache_type c(4, 40);
+
+    HPX_TEST_EQ(c.num_shards(), static_cast<std::size_t>(4));
+    HPX_TEST_EQ(c.capacity(), static_cast<std::size_t>(40));
+
+    for (std::size_t i = 0; i != 8; ++i)
+    {
+        HPX_TEST(c.insert(std::make_pair(i, std::size_t(1)), i));
+    }
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(8));
+
+    // this key is replicated to all shards
+    HPX_TEST(c.insert(std::make_pair(std::size_t(8), std::size_t(10)), 8));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(12));
+
+    for (std::size_t i = 0; i != 8; ++i)
+    {
+        std::size_t value = 0;
+        HPX_TEST(c.get_entry(std::make_pair(i, std::size_t(1)), value));
+        HPX_TEST_EQ(value, i);
+    }
+
+    c.update(std::make_pair(std::size_t(1), std::size_t(1)), 42);
+
+    std::size_t value = 0;
+    HPX_TEST(c.get_entry(std::make_pair(std::size_t(1), std::size_t(1)), value));
+    HPX_TEST_EQ(value, static_cast<std::size_t>(42));
+
+    std::size_t erased =
+        c.erase([](std::pair<std::pair<std::size_t, std::size_t>,
+                    std::size_t> const& p) { return p.first.first == 8; });
+    HPX_TEST_EQ(erased, static_cast<std::size_t>(4));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(8));
+
+    std::int64_t hits = c.accumulate_statistics(
+        [](hpx::util::cache::statistics::local_statistics& s) {
+            return s.hits();
+        });
+    HPX_TEST_EQ(hits, std::int64_t(10));
+
+    HPX_TEST_EQ(c.clear(), static_cast<std::size_t>(8));
+    HPX_TEST_EQ(c.size(), static_cast<std::size_t>(0));
+}
+
+void test_sharded_concurrent()
+{
+    std::size_t const num_threads = 4;
+    std::size_t const num_keys = 1000;
+
+    sharded_cache_type c(8, num_keys);
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&c, t, num_keys]() {
+            for (std::size_t i = t; i < num_keys; i += num_threads)
+            {
+                c.insert(std::make_pair(i, std::size_t(1)), i);
+            }
+            for (std::size_t i = 0; i != num_keys; ++i)
+            {
+                std::size_t value = 0;
+                if (c.get_entry(std::make_pair(i, std::size_t(1)), value))
+                {
+                    HPX_TEST_EQ(value, i);
+                }
+            }
+        });
+    }
+
+    for (std::thread& t : threads)
+        t.join();
+
+    HPX_TEST_LTE(c.size(), num_keys);
+
+    std::int64_t insertions = c.accumulate_statistics(
+        [](hpx::util::cache::statistics::local_statistics& s) {
+            return s.insertions();
+        });
+    HPX_TEST_EQ(insertions, std::int64_t(num_keys));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_clock_eviction();
+    test_sharded();
+    test_sharded_concurrent();
+
+    return hpx::util::report_errors();
+}
@@ -17,11 +17,14 @@
 #define CHECKPOINT_HPP_07262017
 
 #include <hpx/dataflow.hpp>
+#include <hpx/errors.hpp>
 #include <hpx/lcos/future.hpp>
 #include <hpx/runtime/components/client_base.hpp>
 #include <hpx/runtime/components/new.hpp>
 #include <hpx/runtime/get_ptr.hpp>
 #include <hpx/runtime/naming_fwd.hpp>
+#include <hpx/runtime_fwd.hpp>
+#include <hpx/serialization/binary_filter.hpp>
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/vector.hpp>
 #include <hpx/traits/is_client.hpp>
@@ -60,9 +63,15 @@ namespace hpx { namespace util {
     ///
     /// Checkpoints are able to store all containers which are able to be
     /// serialized including components.
+    ///
+    /// The data can be compressed while it is saved by naming a binary
+    /// filter (see \a set_binary_filter). Only filters which record the size
+    /// of the uncompressed data themselves can be used for this purpose
+    /// (currently lz4_serialization_filter and zstd_serialization_filter).
     class checkpoint
     {
         std::vector<char> data_;
+        std::string filter_type_;
 
         friend std::ostream& operator<<(
             std::ostream& ost, checkpoint const& ckp);
@@ -85,10 +94,12 @@ namespace hpx { namespace util {
         checkpoint() = default;
         checkpoint(checkpoint const& c)
           : data_(c.data_)
+          , filter_type_(c.filter_type_)
         {
         }
         checkpoint(checkpoint&& c) noexcept
           : data_(std::move(c.data_))
+          , filter_type_(std::move(c.filter_type_))
         {
         }
         ~checkpoint() = default;
@@ -109,6 +120,7 @@ namespace hpx { namespace util {
             if (&c != this)
             {
                 data_ = c.data_;
+                filter_type_ = c.filter_type_;
             }
             return *this;
         }
@@ -117,6 +129,7 @@ namespace hpx { namespace util {
             if (&c != this)
             {
                 data_ = std::move(c.data_);
+                filter_type_ = std::move(c.filter_type_);
             }
             return *this;
         }
@@ -148,6 +161,40 @@ namespace hpx { namespace util {
         {
             return data_.size();
         }
+
+        /// Compress the data written by subsequent calls to save_checkpoint
+        /// using the binary filter of the given type (for instance
+        /// "zstd_serialization_filter"), an empty string disables the
+        /// compression. The filter is not stored in the checkpoint itself,
+        /// restore_checkpoint detects the compression automatically.
+        ///
+        /// \throws hpx::exception if the filter is not available or if it
+        ///         doesn't record the size of the uncompressed data, as
+        ///         such data could not be restored.
+        void set_binary_filter(std::string const& binary_filter_type)
+        {
+            if (!binary_filter_type.empty())
+            {
+                std::unique_ptr<hpx::serialization::binary_filter> filter(
+                    hpx::create_binary_filter(
+                        binary_filter_type.c_str(), true));
+
+                if (!filter->records_data_size())
+                {
+                    HPX_THROW_EXCEPTION(bad_parameter,
+                        "checkpoint::set_binary_filter",
+                        "the binary filter " + binary_filter_type +
+                            " does not record the size of the uncompressed "
+                            "data, it can't be used for checkpoints");
+                }
+            }
+            filter_type_ = binary_filter_type;
+        }
+
+        std::string const& get_binary_filter() const
+        {
+            return filter_type_;
+        }
     };
 
     // Stream Overloads
@@ -245,8 +292,18 @@ namespace hpx { namespace util {
             template <typename... Ts>
             checkpoint operator()(checkpoint&& c, Ts&&... ts) const
             {
+                std::unique_ptr<hpx::serialization::binary_filter> filter;
+                std::uint32_t flags = 0;
+                if (!c.filter_type_.empty())
+                {
+                    filter.reset(hpx::create_binary_filter(
+                        c.filter_type_.c_str(), true));
+                    flags = hpx::serialization::enable_compression;
+                }
+
                 // Create serialization archive from checkpoint data member
-                hpx::serialization::output_archive ar(c.data_);
+                hpx::serialization::output_archive ar(
+                    c.data_, flags, nullptr, filter.get());
 
                 // force check-pointing flag to be created in the archive,
                 // the serialization of id_type's checks for it
@@ -259,6 +316,10 @@ namespace hpx { namespace util {
                 int const sequencer[] = {0, (ar << ts, 0)...};
                 (void) sequencer;    // Suppress unused param. warnings
 
+                // the filter writes its (compressed) output while flushing
+                if (filter)
+                    ar.flush();
+
                 return std::move(c);
             }
         };
@@ -593,8 +654,9 @@ namespace hpx { namespace util {
     template <typename T, typename... Ts>
     void restore_checkpoint(checkpoint const& c, T& t, Ts&... ts)
     {
-        // Create serialization archive
-        hpx::serialization::input_archive ar(c.data_, c.size());
+        // Create serialization archive, the size of the data is not known
+        // beforehand if the checkpoint was compressed
+        hpx::serialization::input_archive ar(c.data_);
 
         // De-serialize data
         detail::restore_impl(ar, t);
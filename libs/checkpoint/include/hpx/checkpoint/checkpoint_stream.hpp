@@ -0,0 +1,501 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file checkpoint_stream.hpp
+///
+/// This header defines the save_checkpoint_stream and
+/// restore_checkpoint_stream functions. In contrast to save_checkpoint they
+/// never hold the complete serialized state in memory: the data is
+/// serialized into chunks of a fixed size which are written to the stream
+/// on the I/O thread pool while the serialization continues. The restore
+/// reads the stream lazily, one chunk ahead of the deserialization.
+///
+/// The written data has the same format as produced by the operator<<
+/// of a checkpoint, i.e. it can be read into a checkpoint using operator>>
+/// (and vice versa).
+
+#if !defined(HPX_CHECKPOINT_CHECKPOINT_STREAM_HPP)
+#define HPX_CHECKPOINT_CHECKPOINT_STREAM_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/checkpoint/checkpoint.hpp>
+#include <hpx/dataflow.hpp>
+#include <hpx/errors.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/runtime/threads/run_as_os_thread.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/traits/serialization_access_data.hpp>
+#include <hpx/traits/is_client.hpp>
+#include <hpx/type_support/unwrap_ref.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if !defined(HPX_CHECKPOINT_STREAM_CHUNK_SIZE)
+// The size of the chunks streaming checkpoints are written and read in
+#define HPX_CHECKPOINT_STREAM_CHUNK_SIZE std::size_t(1024 * 1024)
+#endif
+
+namespace hpx { namespace util {
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // The output 'container' used for streaming checkpoints. The data is
+        // collected in a chunk, full chunks are handed over to the I/O thread
+        // pool. At most two chunks exist at any time: one being written to
+        // the stream and one being filled.
+        class checkpoint_stream_sink
+        {
+        public:
+            checkpoint_stream_sink(std::ostream& ost,
+                std::size_t chunk_size = HPX_CHECKPOINT_STREAM_CHUNK_SIZE)
+              : ost_(ost)
+              , chunk_size_((std::max)(chunk_size, sizeof(std::int64_t)))
+              , start_(ost.tellp())
+              , size_(0)
+            {
+                // the size of the data is written in front of it once the
+                // serialization is done
+                if (start_ == std::ostream::pos_type(-1))
+                {
+                    HPX_THROW_EXCEPTION(bad_parameter,
+                        "checkpoint_stream_sink::checkpoint_stream_sink",
+                        "streaming checkpoints require a seekable stream");
+                }
+
+                current_.reserve(chunk_size_);
+                current_.resize(sizeof(std::int64_t), 0);
+            }
+
+            checkpoint_stream_sink(checkpoint_stream_sink const&) = delete;
+            checkpoint_stream_sink& operator=(
+                checkpoint_stream_sink const&) = delete;
+
+            ~checkpoint_stream_sink()
+            {
+                // the pending write refers to our buffer
+                if (pending_write_.valid())
+                    pending_write_.wait();
+            }
+
+            // number of bytes written by the archive
+            std::size_t size() const
+            {
+                return size_;
+            }
+
+            void write(void const* address, std::size_t count,
+                std::size_t current)
+            {
+                HPX_ASSERT(current == size_);
+                (void) current;
+
+                char const* src = static_cast<char const*>(address);
+                while (count != 0)
+                {
+                    std::size_t const n =
+                        (std::min)(count, chunk_size_ - current_.size());
+                    current_.insert(current_.end(), src, src + n);
+
+                    src += n;
+                    count -= n;
+                    size_ += n;
+
+                    if (current_.size() == chunk_size_)
+                        write_chunk();
+                }
+            }
+
+            // write the remaining data and the overall size, returns once
+            // everything was written
+            void finalize()
+            {
+                if (!current_.empty())
+                    write_chunk();
+
+                if (pending_write_.valid())
+                    pending_write_.get();
+
+                std::ostream& ost = ost_;
+                std::ostream::pos_type start = start_;
+                std::int64_t size = static_cast<std::int64_t>(size_);
+
+                hpx::threads::run_as_os_thread([&ost, start, size]() {
+                    std::ostream::pos_type end = ost.tellp();
+                    ost.seekp(start);
+                    ost.write(reinterpret_cast<char const*>(&size),
+                        sizeof(std::int64_t));
+                    ost.seekp(end);
+                    ost.flush();
+                    if (!ost)
+                    {
+                        HPX_THROW_EXCEPTION(filesystem_error,
+                            "checkpoint_stream_sink::finalize",
+                            "writing the checkpoint failed");
+                    }
+                }).get();
+            }
+
+        private:
+            void write_chunk()
+            {
+                // wait for the previous chunk to be written before reusing
+                // its buffer, this rethrows any error
+                if (pending_write_.valid())
+                    pending_write_.get();
+
+                std::swap(current_, writing_);
+                current_.clear();
+                current_.reserve(chunk_size_);
+
+                std::ostream& ost = ost_;
+                std::vector<char> const& data = writing_;
+                pending_write_ =
+                    hpx::threads::run_as_os_thread([&ost, &data]() {
+                        ost.write(data.data(), data.size());
+                        if (!ost)
+                        {
+                            HPX_THROW_EXCEPTION(filesystem_error,
+                                "checkpoint_stream_sink::write_chunk",
+                                "writing the checkpoint failed");
+                        }
+                    });
+            }
+
+            std::ostream& ost_;
+            std::size_t chunk_size_;
+            std::ostream::pos_type start_;
+            std::size_t size_;
+
+            std::vector<char> current_;
+            std::vector<char> writing_;
+            hpx::future<void> pending_write_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The input 'container' used for streaming checkpoints. The next
+        // chunk is read on the I/O thread pool while the current one is
+        // deserialized.
+        class checkpoint_stream_source
+        {
+        public:
+            checkpoint_stream_source(std::istream& ist,
+                std::size_t chunk_size = HPX_CHECKPOINT_STREAM_CHUNK_SIZE)
+              : ist_(ist)
+              , chunk_size_((std::max)(chunk_size, std::size_t(1)))
+              , size_(0)
+              , requested_(0)
+              , consumed_(0)
+              , pos_(0)
+            {
+                std::int64_t size = 0;
+                hpx::threads::run_as_os_thread([&ist, &size]() {
+                    ist.read(reinterpret_cast<char*>(&size),
+                        sizeof(std::int64_t));
+                    if (!ist || size < 0)
+                    {
+                        HPX_THROW_EXCEPTION(filesystem_error,
+                            "checkpoint_stream_source::"
+                            "checkpoint_stream_source",
+                            "reading the checkpoint failed");
+                    }
+                }).get();
+
+                size_ = static_cast<std::size_t>(size);
+                prefetch(std::vector<char>());
+            }
+
+            checkpoint_stream_source(checkpoint_stream_source const&) = delete;
+            checkpoint_stream_source& operator=(
+                checkpoint_stream_source const&) = delete;
+
+            ~checkpoint_stream_source()
+            {
+                // the pending read refers to our stream
+                if (next_.valid())
+                    next_.wait();
+            }
+
+            // overall number of bytes available to the archive
+            std::size_t size() const
+            {
+                return size_;
+            }
+
+            // reading advances the stream, even if the archive refers to
+            // its data through a const reference
+            void read(
+                void* address, std::size_t count, std::size_t current) const
+            {
+                HPX_ASSERT(current == consumed_);
+                (void) current;
+
+                char* dst = static_cast<char*>(address);
+                while (count != 0)
+                {
+                    if (pos_ == current_.size())
+                        next_chunk();
+
+                    std::size_t const n =
+                        (std::min)(count, current_.size() - pos_);
+                    std::memcpy(dst, current_.data() + pos_, n);
+
+                    pos_ += n;
+                    dst += n;
+                    count -= n;
+                    consumed_ += n;
+                }
+            }
+
+        private:
+            void next_chunk() const
+            {
+                if (!next_.valid())
+                {
+                    HPX_THROW_EXCEPTION(serialization_error,
+                        "checkpoint_stream_source::next_chunk",
+                        "archive data bstream is too short");
+                }
+
+                std::vector<char> used = std::move(current_);
+                current_ = next_.get();
+                pos_ = 0;
+
+                prefetch(std::move(used));
+            }
+
+            // start reading the next chunk, reusing the given buffer
+            void prefetch(std::vector<char>&& buffer) const
+            {
+                std::size_t const n =
+                    (std::min)(chunk_size_, size_ - requested_);
+                if (n == 0)
+                    return;
+
+                requested_ += n;
+
+                std::istream& ist = ist_;
+                next_ = hpx::threads::run_as_os_thread(
+                    [&ist, n](std::vector<char> data) -> std::vector<char> {
+                        data.resize(n);
+                        ist.read(data.data(), n);
+                        if (static_cast<std::size_t>(ist.gcount()) != n)
+                        {
+                            HPX_THROW_EXCEPTION(filesystem_error,
+                                "checkpoint_stream_source::prefetch",
+                                "reading the checkpoint failed");
+                        }
+                        return data;
+                    },
+                    std::move(buffer));
+            }
+
+            std::istream& ist_;
+            std::size_t chunk_size_;
+            std::size_t size_;
+
+            mutable std::size_t requested_;
+            mutable std::size_t consumed_;
+            mutable std::size_t pos_;
+            mutable std::vector<char> current_;
+            mutable hpx::future<std::vector<char>> next_;
+        };
+    }    // namespace detail
+}}    // namespace hpx::util
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace traits {
+
+    template <>
+    struct serialization_access_data<util::detail::checkpoint_stream_sink>
+      : default_serialization_access_data<
+            util::detail::checkpoint_stream_sink>
+    {
+        using container_type = util::detail::checkpoint_stream_sink;
+
+        static std::size_t size(container_type const& cont)
+        {
+            return cont.size();
+        }
+
+        // the data is appended while writing
+        static void resize(container_type&, std::size_t) {}
+
+        static void write(container_type& cont, std::size_t count,
+            std::size_t current, void const* address)
+        {
+            cont.write(address, count, current);
+        }
+    };
+
+    template <>
+    struct serialization_access_data<util::detail::checkpoint_stream_source>
+      : default_serialization_access_data<
+            util::detail::checkpoint_stream_source>
+    {
+        using container_type = util::detail::checkpoint_stream_source;
+
+        static std::size_t size(container_type const& cont)
+        {
+            return cont.size();
+        }
+
+        static void read(container_type const& cont, std::size_t count,
+            std::size_t current, void* address)
+        {
+            cont.read(address, count, current);
+        }
+    };
+}}    // namespace hpx::traits
+
+namespace hpx { namespace util {
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Objects passed as lvalues are referenced (not copied) while they
+        // are serialized
+        template <typename T,
+            typename U = typename std::enable_if<!hpx::traits::is_client<
+                typename std::decay<T>::type>::value>::type>
+        typename std::conditional<std::is_lvalue_reference<T>::value,
+            std::reference_wrapper<
+                typename std::remove_reference<T>::type const>,
+            typename std::decay<T>::type>::type
+        prep_ref(T&& t)
+        {
+            return std::forward<T>(t);
+        }
+
+        template <typename Client, typename Server>
+        auto prep_ref(hpx::components::client_base<Client, Server> const& c)
+            -> decltype(prep(c))
+        {
+            return prep(c);
+        }
+
+        struct save_stream_funct_obj
+        {
+            template <typename... Ts>
+            void operator()(
+                std::reference_wrapper<std::ostream> ost, Ts&&... ts) const
+            {
+                checkpoint_stream_sink sink(ost.get());
+
+                {
+                    hpx::serialization::output_archive ar(sink);
+
+                    // force check-pointing flag to be created in the archive,
+                    // the serialization of id_type's checks for it
+                    ar.get_extra_data<naming::checkpointing_tag>();
+
+                    int const sequencer[] = {
+                        0, (ar << hpx::util::unwrap_ref(ts), 0)...};
+                    (void) sequencer;    // Suppress unused param. warnings
+                }
+
+                sink.finalize();
+            }
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint_stream
+    ///
+    /// \tparam T            Containers passed to save_checkpoint_stream to be
+    ///                      serialized and written to the stream.
+    ///
+    /// \tparam Ts           More containers passed to save_checkpoint_stream
+    ///                      to be serialized and written to the stream.
+    ///
+    /// \param ost           The (seekable) stream to write the checkpoint to.
+    ///
+    /// \param t             A container to save.
+    ///
+    /// \param ts            Other containers to save.
+    ///
+    /// Save_checkpoint_stream serializes the given objects directly into the
+    /// stream in chunks of HPX_CHECKPOINT_STREAM_CHUNK_SIZE bytes, the
+    /// complete serialized data is never held in memory. The stream and the
+    /// objects are referenced and have to stay alive until the returned
+    /// future becomes ready.
+    ///
+    /// \returns Save_checkpoint_stream returns a future which becomes ready
+    ///          once all data was written to the stream.
+    template <typename T, typename... Ts>
+    hpx::future<void> save_checkpoint_stream(
+        std::ostream& ost, T&& t, Ts&&... ts)
+    {
+        return hpx::dataflow(detail::save_stream_funct_obj{}, std::ref(ost),
+            detail::prep_ref(std::forward<T>(t)),
+            detail::prep_ref(std::forward<Ts>(ts))...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint_stream - Sync_policy overload
+    ///
+    /// \param sync_p        hpx::launch::sync_policy
+    ///
+    /// \param ost           The (seekable) stream to write the checkpoint to.
+    ///
+    /// \param t             A container to save.
+    ///
+    /// \param ts            Other containers to save.
+    ///
+    /// This overload returns once all data was written to the stream.
+    template <typename T, typename... Ts>
+    void save_checkpoint_stream(hpx::launch::sync_policy sync_p,
+        std::ostream& ost, T&& t, Ts&&... ts)
+    {
+        hpx::dataflow(sync_p, detail::save_stream_funct_obj{}, std::ref(ost),
+            detail::prep_ref(std::forward<T>(t)),
+            detail::prep_ref(std::forward<Ts>(ts))...)
+            .get();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Restore_checkpoint_stream
+    ///
+    /// \param ist          The stream to read the checkpoint from.
+    ///
+    /// \param t            A container to restore.
+    ///
+    /// \param ts           Other containers to restore Containers
+    ///                     must be in the same order that they were
+    ///                     inserted into the checkpoint.
+    ///
+    /// Restore_checkpoint_stream reads the data written by
+    /// save_checkpoint_stream (or by operator<< of a checkpoint) lazily in
+    /// chunks of HPX_CHECKPOINT_STREAM_CHUNK_SIZE bytes while the objects
+    /// are being restored.
+    template <typename T, typename... Ts>
+    void restore_checkpoint_stream(std::istream& ist, T& t, Ts&... ts)
+    {
+        detail::checkpoint_stream_source source(ist);
+
+        // Create serialization archive
+        hpx::serialization::input_archive ar(source, source.size());
+
+        // De-serialize data
+        detail::restore_impl(ar, t);
+
+        int const sequencer[] = {0, (detail::restore_impl(ar, ts), 0)...};
+        (void) sequencer;    // Suppress unused variable warnings
+    }
+}}    // namespace hpx::util
+
+#endif
@@ -0,0 +1,119 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that checkpoints can be compressed using the binary
+// filters which record the size of the uncompressed data themselves and that
+// all other filters are rejected.
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/checkpoint.hpp>
+#include <hpx/errors.hpp>
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using hpx::util::checkpoint;
+using hpx::util::restore_checkpoint;
+using hpx::util::save_checkpoint;
+
+void test_checkpoint_compression(std::string const& filter)
+{
+    // well compressible data
+    std::vector<std::int64_t> values(100000);
+    for (std::size_t i = 0; i != values.size(); ++i)
+        values[i] = std::int64_t(i % 16);
+
+    // incompressible data is stored as is
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<char> noise(10000);
+    for (char& c : noise)
+        c = char(dist(gen));
+
+    // data below the compression threshold
+    std::string str = "I am a string of characters";
+
+    checkpoint uncompressed =
+        save_checkpoint(hpx::launch::sync, values, noise, str);
+
+    checkpoint archive;
+    archive.set_binary_filter(filter);
+    HPX_TEST_EQ(archive.get_binary_filter(), filter);
+
+    checkpoint compressed = save_checkpoint(
+        hpx::launch::sync, std::move(archive), values, noise, str);
+
+    HPX_TEST_LT(compressed.size(), uncompressed.size());
+
+    std::vector<std::int64_t> values2;
+    std::vector<char> noise2;
+    std::string str2;
+    restore_checkpoint(compressed, values2, noise2, str2);
+
+    HPX_TEST(values == values2);
+    HPX_TEST(noise == noise2);
+    HPX_TEST_EQ(str, str2);
+
+    // small checkpoints are stored uncompressed, but are still restorable
+    checkpoint small;
+    small.set_binary_filter(filter);
+    small = save_checkpoint(hpx::launch::sync, std::move(small), str);
+
+    std::string str3;
+    restore_checkpoint(small, str3);
+    HPX_TEST_EQ(str, str3);
+}
+
+void test_unsupported_filter(std::string const& filter)
+{
+    checkpoint archive;
+
+    bool caught_exception = false;
+    try
+    {
+        archive.set_binary_filter(filter);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+    HPX_TEST(archive.get_binary_filter().empty());
+
+    // the checkpoint is still usable without compression
+    std::string str = "I am a string of characters";
+    checkpoint uncompressed =
+        save_checkpoint(hpx::launch::sync, std::move(archive), str);
+
+    std::string str2;
+    restore_checkpoint(uncompressed, str2);
+    HPX_TEST_EQ(str, str2);
+}
+
+int main()
+{
+    // these filters don't record the size of the uncompressed data (if they
+    // are available at all)
+    test_unsupported_filter("zlib_serialization_filter");
+    test_unsupported_filter("bzip2_serialization_filter");
+    test_unsupported_filter("snappy_serialization_filter");
+    test_unsupported_filter("no_such_serialization_filter");
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+    test_checkpoint_compression("lz4_serialization_filter");
+#endif
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+    test_checkpoint_compression("zstd_serialization_filter");
+#endif
+
+    return hpx::util::report_errors();
+}
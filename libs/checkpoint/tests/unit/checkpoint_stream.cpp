@@ -0,0 +1,120 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies the streaming checkpoint functions, the saved data
+// spans several chunks.
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/checkpoint/checkpoint.hpp>
+#include <hpx/checkpoint/checkpoint_stream.hpp>
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using hpx::util::checkpoint;
+using hpx::util::restore_checkpoint;
+using hpx::util::restore_checkpoint_stream;
+using hpx::util::save_checkpoint;
+using hpx::util::save_checkpoint_stream;
+
+int main()
+{
+    int integer = 10;
+    std::string str = "I am a string of characters";
+    // the vector alone fills more than four chunks
+    std::size_t const num_chunks = 4;
+    std::vector<double> vec(
+        num_chunks * HPX_CHECKPOINT_STREAM_CHUNK_SIZE / sizeof(double) + 17);
+    std::iota(vec.begin(), vec.end(), 0.0);
+
+    // Test 1
+    //  save asynchronously and restore using the streaming functions
+    {
+        std::stringstream strm;
+        hpx::future<void> f = save_checkpoint_stream(strm, integer, str, vec);
+        f.get();
+
+        HPX_TEST_LT(num_chunks * HPX_CHECKPOINT_STREAM_CHUNK_SIZE,
+            strm.str().size());
+
+        int integer2 = 0;
+        std::string str2;
+        std::vector<double> vec2;
+        restore_checkpoint_stream(strm, integer2, str2, vec2);
+
+        HPX_TEST_EQ(integer, integer2);
+        HPX_TEST_EQ(str, str2);
+        HPX_TEST(vec == vec2);
+    }
+
+    // Test 2
+    //  the streamed data is compatible with the checkpoint stream operators
+    {
+        std::stringstream strm;
+        save_checkpoint_stream(hpx::launch::sync, strm, integer, str, vec);
+
+        checkpoint c;
+        strm >> c;
+
+        int integer2 = 0;
+        std::string str2;
+        std::vector<double> vec2;
+        restore_checkpoint(c, integer2, str2, vec2);
+
+        HPX_TEST_EQ(integer, integer2);
+        HPX_TEST_EQ(str, str2);
+        HPX_TEST(vec == vec2);
+
+        // and vice versa
+        std::stringstream strm2;
+        strm2 << save_checkpoint(hpx::launch::sync, integer, str, vec);
+
+        int integer3 = 0;
+        std::string str3;
+        std::vector<double> vec3;
+        restore_checkpoint_stream(strm2, integer3, str3, vec3);
+
+        HPX_TEST_EQ(integer, integer3);
+        HPX_TEST_EQ(str, str3);
+        HPX_TEST(vec == vec3);
+    }
+
+    // Test 3
+    //  several checkpoints in one file
+    {
+        std::string const filename = "checkpoint_stream_test.chk";
+        {
+            std::ofstream ofs(filename, std::ios::binary);
+            save_checkpoint_stream(hpx::launch::sync, ofs, integer, vec);
+            save_checkpoint_stream(hpx::launch::sync, ofs, str);
+        }
+
+        int integer2 = 0;
+        std::string str2;
+        std::vector<double> vec2;
+        {
+            std::ifstream ifs(filename, std::ios::binary);
+            restore_checkpoint_stream(ifs, integer2, vec2);
+            restore_checkpoint_stream(ifs, str2);
+        }
+        std::remove(filename.c_str());
+
+        HPX_TEST_EQ(integer, integer2);
+        HPX_TEST_EQ(str, str2);
+        HPX_TEST(vec == vec2);
+    }
+
+    return hpx::util::report_errors();
+}
@@ -42,6 +42,16 @@ namespace hpx { namespace lcos {
     ///             usage of the \a HPX_REGISTER_ALLREDUCE macro to define the
     ///             necessary internal facilities used by \a all_reduce.
     ///
+    /// \note       The algorithm used is selected from the number of sites
+    ///             and the size of the data (see the configuration section
+    ///             hpx.lcos.collectives): with more than two sites the values
+    ///             are exchanged using recursive doubling, large std::vector
+    ///             values are reduced using a ring based reduce-scatter
+    ///             followed by an all-gather if the operation is marked as
+    ///             element-wise (see \a hpx::traits::is_elementwise_reduction).
+    ///             The operation is required to be associative and
+    ///             commutative.
+    ///
     /// \returns    This function returns a future holding a vector with all
     ///             values send by all participating sites. It will become
     ///             ready once the all_reduce operation has been completed.
@@ -142,7 +152,9 @@ namespace hpx { namespace lcos {
 #include <hpx/dataflow.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/lcos/future.hpp>
+#include <hpx/lcos/wait_all.hpp>
 #include <hpx/local_lcos/and_gate.hpp>
+#include <hpx/local_lcos/receive_buffer.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/parallel/algorithms/reduce.hpp>
 #include <hpx/preprocessor/cat.hpp>
@@ -151,20 +163,39 @@ namespace hpx { namespace lcos {
 #include <hpx/runtime/basename_registration.hpp>
 #include <hpx/runtime/components/new.hpp>
 #include <hpx/runtime/components/server/component_base.hpp>
+#include <hpx/runtime/config_entry.hpp>
 #include <hpx/runtime/get_num_localities.hpp>
+#include <hpx/runtime/get_ptr.hpp>
 #include <hpx/runtime/launch_policy.hpp>
 #include <hpx/runtime/naming/id_type.hpp>
 #include <hpx/runtime/naming/unmanaged.hpp>
 #include <hpx/type_support/decay.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+namespace hpx { namespace traits {
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// Customization point marking a reduction operation \a F as combining
+    /// std::vector arguments element by element, i.e. applying it to slices
+    /// of its arguments yields the corresponding slice of its result. This
+    /// enables the ring based all_reduce algorithm for large vectors.
+    template <typename F, typename Enable = void>
+    struct is_elementwise_reduction : std::false_type
+    {
+    };
+}}    // namespace hpx::traits
+
 namespace hpx { namespace lcos {
 
     namespace detail {
@@ -192,6 +223,33 @@ namespace hpx { namespace lcos {
             {
             }
 
+            // servers created with this constructor are used by the peer to
+            // peer algorithms, they receive the data sent by other sites
+            all_reduce_server(std::string const& name, std::size_t site)
+              : num_sites_(0)
+              , gate_(0)
+              , name_(name)
+              , site_(site)
+            {
+            }
+
+            void set_data(std::size_t step, T t)
+            {
+                buffer_.store_received(step, std::move(t));
+            }
+
+            struct set_data_action
+              : hpx::actions::make_action<void (all_reduce_server::*)(
+                                              std::size_t, T),
+                    &all_reduce_server::set_data, set_data_action>::type
+            {
+            };
+
+            hpx::future<T> get_data(std::size_t step)
+            {
+                return buffer_.receive(step);
+            }
+
             template <typename F>
             hpx::future<T> get_result(std::size_t which, T t, F op)
             {
@@ -253,6 +311,7 @@ namespace hpx { namespace lcos {
             lcos::local::and_gate gate_;
             std::string name_;
             std::size_t site_;
+            lcos::local::receive_buffer<T> buffer_;
         };
 
         ////////////////////////////////////////////////////////////////////////
@@ -282,6 +341,327 @@ namespace hpx { namespace lcos {
                     return target;
                 });
         }
+
+        ////////////////////////////////////////////////////////////////////////
+        enum class all_reduce_algorithm
+        {
+            central,               // all sites send to the root site
+            recursive_doubling,    // log2(P) pairwise exchanges
+            ring                   // reduce-scatter and all-gather in a ring
+        };
+
+        template <typename T, typename F>
+        struct is_segmentable : std::false_type
+        {
+        };
+
+        template <typename T, typename Allocator, typename F>
+        struct is_segmentable<std::vector<T, Allocator>, F>
+          : hpx::traits::is_elementwise_reduction<F>
+        {
+        };
+
+        template <typename T>
+        std::size_t get_num_elements(T const&)
+        {
+            return 1;
+        }
+
+        template <typename T, typename Allocator>
+        std::size_t get_num_elements(std::vector<T, Allocator> const& v)
+        {
+            return v.size();
+        }
+
+        template <typename T>
+        std::size_t get_payload_size(T const& t)
+        {
+            return get_num_elements(t) * sizeof(T);
+        }
+
+        template <typename T, typename Allocator>
+        std::size_t get_payload_size(std::vector<T, Allocator> const& v)
+        {
+            return v.size() * sizeof(T);
+        }
+
+        // All sites have to select the same algorithm, the decision is based
+        // on the configuration, the number of sites, and the size of the data
+        // only.
+        template <typename T, typename F>
+        all_reduce_algorithm select_all_reduce_algorithm(
+            T const& value, std::size_t num_sites)
+        {
+            std::string algorithm = hpx::get_config_entry(
+                "hpx.lcos.collectives.all_reduce_algorithm", "auto");
+
+            bool const segmentable = is_segmentable<T, F>::value &&
+                get_num_elements(value) >= num_sites;
+
+            if (algorithm == "central")
+            {
+                return all_reduce_algorithm::central;
+            }
+            if (algorithm == "recursive_doubling")
+            {
+                return all_reduce_algorithm::recursive_doubling;
+            }
+            if (algorithm == "ring")
+            {
+                return segmentable ? all_reduce_algorithm::ring :
+                                     all_reduce_algorithm::recursive_doubling;
+            }
+
+            // for two sites the central algorithm needs the fewest messages
+            if (num_sites <= 2)
+                return all_reduce_algorithm::central;
+
+            std::size_t const ring_threshold = std::stoull(hpx::get_config_entry(
+                "hpx.lcos.collectives.all_reduce_ring_threshold", "65536"));
+
+            if (segmentable && get_payload_size(value) >= ring_threshold)
+                return all_reduce_algorithm::ring;
+
+            return all_reduce_algorithm::recursive_doubling;
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Manage the server receiving the data sent to this site by the peer
+        // to peer algorithms.
+        template <typename T>
+        class all_reduce_peer
+        {
+            using server_type = all_reduce_server<T>;
+            using set_data_action = typename server_type::set_data_action;
+
+        public:
+            all_reduce_peer(std::string name, std::size_t this_site)
+              : name_(std::move(name))
+              , this_site_(this_site)
+              , id_(hpx::new_<server_type>(hpx::find_here(), name_, this_site)
+                        .get())
+              , server_(hpx::get_ptr<server_type>(hpx::launch::sync, id_))
+            {
+                // Register unmanaged id to avoid cyclic dependencies, the
+                // server is kept alive by this object.
+                if (!hpx::register_with_basename(
+                        name_, hpx::unmanaged(id_), this_site_)
+                         .get())
+                {
+                    HPX_THROW_EXCEPTION(bad_parameter,
+                        "hpx::lcos::detail::all_reduce_peer",
+                        "the given base name for the all_reduce operation "
+                        "was already registered: " +
+                            name_);
+                }
+            }
+
+            ~all_reduce_peer()
+            {
+                // all sends have to be delivered before the operation is
+                // complete
+                hpx::wait_all(sends_);
+                hpx::unregister_with_basename(name_, this_site_).get();
+            }
+
+            void send(std::size_t site, std::size_t step, T value)
+            {
+                sends_.push_back(hpx::async(
+                    set_data_action(), get_id(site), step, std::move(value)));
+            }
+
+            T receive(std::size_t step)
+            {
+                return server_->get_data(step).get();
+            }
+
+        private:
+            // the id of each site is looked up once per operation only
+            hpx::id_type const& get_id(std::size_t site)
+            {
+                auto it = peers_.find(site);
+                if (it == peers_.end())
+                {
+                    it = peers_
+                             .emplace(site,
+                                 hpx::find_from_basename(name_, site).get())
+                             .first;
+                }
+                return it->second;
+            }
+
+            std::string name_;
+            std::size_t this_site_;
+            hpx::id_type id_;
+            std::shared_ptr<server_type> server_;
+            std::map<std::size_t, hpx::id_type> peers_;
+            std::vector<hpx::future<void>> sends_;
+        };
+
+        ////////////////////////////////////////////////////////////////////////
+        // Recursive doubling: the sites exchange their partial results with
+        // partners at distances 1, 2, 4, ... For a number of sites which is
+        // not a power of two, the excess sites first fold their value into
+        // their neighbor and receive the final result from it.
+        template <typename T, typename F>
+        T all_reduce_recursive_doubling(std::string const& name, T value,
+            F& op, std::size_t num_sites, std::size_t this_site)
+        {
+            all_reduce_peer<T> peer(name, this_site);
+
+            std::size_t num_sites_pow2 = 1;
+            while (num_sites_pow2 * 2 <= num_sites)
+                num_sites_pow2 *= 2;
+
+            std::size_t const excess = num_sites - num_sites_pow2;
+            std::size_t const final_step = std::size_t(-1);
+
+            std::size_t rank = 0;
+            if (this_site < 2 * excess)
+            {
+                if (this_site % 2 == 0)
+                {
+                    peer.send(this_site + 1, 0, std::move(value));
+                    return peer.receive(final_step);
+                }
+
+                value = op(peer.receive(0), std::move(value));
+                rank = this_site / 2;
+            }
+            else
+            {
+                rank = this_site - excess;
+            }
+
+            std::size_t step = 1;
+            for (std::size_t mask = 1; mask < num_sites_pow2;
+                 mask *= 2, ++step)
+            {
+                std::size_t const partner_rank = rank ^ mask;
+                std::size_t const partner = partner_rank < excess ?
+                    2 * partner_rank + 1 :
+                    partner_rank + excess;
+
+                peer.send(partner, step, value);
+
+                // combine in the same order on both sides
+                T other = peer.receive(step);
+                value = partner_rank < rank ?
+                    op(std::move(other), std::move(value)) :
+                    op(std::move(value), std::move(other));
+            }
+
+            if (this_site < 2 * excess)
+                peer.send(this_site - 1, final_step, value);
+
+            return value;
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Ring reduce-scatter followed by a ring all-gather: every site sends
+        // and receives 2 * (P - 1) slices of 1/P of the data.
+        template <typename T, typename F>
+        T all_reduce_ring(std::string const& name, T value, F& op,
+            std::size_t num_sites, std::size_t this_site)
+        {
+            all_reduce_peer<T> peer(name, this_site);
+
+            std::size_t const size = value.size();
+            auto slice_begin = [&](std::size_t slice) {
+                return value.begin() + (slice * size) / num_sites;
+            };
+            auto slice_end = [&](std::size_t slice) {
+                return value.begin() + ((slice + 1) * size) / num_sites;
+            };
+
+            std::size_t const next = (this_site + 1) % num_sites;
+
+            // after step s, the slice (this_site - s - 1) holds the partial
+            // result of s + 2 sites
+            for (std::size_t s = 0; s != num_sites - 1; ++s)
+            {
+                std::size_t const send_slice =
+                    (this_site + num_sites - s) % num_sites;
+                std::size_t const recv_slice =
+                    (this_site + 2 * num_sites - s - 1) % num_sites;
+
+                peer.send(next, s,
+                    T(slice_begin(send_slice), slice_end(send_slice)));
+
+                T received = peer.receive(s);
+                T mine(slice_begin(recv_slice), slice_end(recv_slice));
+                T combined = op(std::move(received), std::move(mine));
+
+                HPX_ASSERT(combined.size() ==
+                    std::size_t(slice_end(recv_slice) - slice_begin(recv_slice)));
+                std::move(
+                    combined.begin(), combined.end(), slice_begin(recv_slice));
+            }
+
+            // the slice (this_site + 1) is now fully reduced, circulate all
+            // reduced slices
+            for (std::size_t s = 0; s != num_sites - 1; ++s)
+            {
+                std::size_t const send_slice =
+                    (this_site + 1 + num_sites - s) % num_sites;
+                std::size_t const recv_slice = (this_site + num_sites - s) %
+                    num_sites;
+
+                peer.send(next, num_sites - 1 + s,
+                    T(slice_begin(send_slice), slice_end(send_slice)));
+
+                T received = peer.receive(num_sites - 1 + s);
+                std::move(
+                    received.begin(), received.end(), slice_begin(recv_slice));
+            }
+
+            return value;
+        }
+
+        template <typename T, typename F>
+        typename std::enable_if<is_segmentable<T, F>::value, T>::type
+        all_reduce_ring_if(std::string const& name, T value, F& op,
+            std::size_t num_sites, std::size_t this_site)
+        {
+            return all_reduce_ring(
+                name, std::move(value), op, num_sites, this_site);
+        }
+
+        template <typename T, typename F>
+        typename std::enable_if<!is_segmentable<T, F>::value, T>::type
+        all_reduce_ring_if(std::string const& name, T value, F& op,
+            std::size_t num_sites, std::size_t this_site)
+        {
+            return all_reduce_recursive_doubling(
+                name, std::move(value), op, num_sites, this_site);
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        template <typename T, typename F>
+        hpx::future<typename std::decay<T>::type> all_reduce_peers(
+            std::string name, T&& value, F&& op, std::size_t num_sites,
+            std::size_t this_site, all_reduce_algorithm algorithm)
+        {
+            using value_type = typename std::decay<T>::type;
+            using func_type = typename std::decay<F>::type;
+
+            return hpx::async(
+                [name = std::move(name), value = std::forward<T>(value),
+                    op = std::forward<F>(op), num_sites, this_site,
+                    algorithm]() mutable -> value_type {
+                    if (num_sites == 1)
+                        return std::move(value);
+
+                    if (algorithm == all_reduce_algorithm::ring)
+                    {
+                        return all_reduce_ring_if<value_type, func_type>(
+                            name, std::move(value), op, num_sites, this_site);
+                    }
+                    return all_reduce_recursive_doubling<value_type,
+                        func_type>(
+                        name, std::move(value), op, num_sites, this_site);
+                });
+        }
     }    // namespace detail
 
     ////////////////////////////////////////////////////////////////////////////
@@ -348,36 +728,6 @@ namespace hpx { namespace lcos {
             std::move(f), std::move(local_result));
     }
 
-    template <typename T, typename F>
-    hpx::future<T> all_reduce(char const* basename,
-        hpx::future<T>&& local_result, F&& op,
-        std::size_t num_sites = std::size_t(-1),
-        std::size_t generation = std::size_t(-1),
-        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0)
-    {
-        if (num_sites == std::size_t(-1))
-        {
-            num_sites = static_cast<std::size_t>(
-                hpx::get_num_localities(hpx::launch::sync));
-        }
-        if (this_site == std::size_t(-1))
-            this_site = static_cast<std::size_t>(hpx::get_locality_id());
-
-        if (this_site == 0)
-        {
-            return all_reduce(create_all_reduce<T>(
-                                  basename, num_sites, generation, root_site),
-                std::move(local_result), std::forward<F>(op), this_site);
-        }
-
-        std::string name(basename);
-        if (generation != std::size_t(-1))
-            name += std::to_string(generation) + "/";
-
-        return all_reduce(hpx::find_from_basename(std::move(name), root_site),
-            std::move(local_result), std::forward<F>(op), this_site);
-    }
-
     ////////////////////////////////////////////////////////////////////////////
     // all_reduce plain values
     template <typename T, typename F>
@@ -429,6 +779,22 @@ namespace hpx { namespace lcos {
         if (this_site == std::size_t(-1))
             this_site = static_cast<std::size_t>(hpx::get_locality_id());
 
+        using arg_type = typename std::decay<T>::type;
+        detail::all_reduce_algorithm algorithm =
+            detail::select_all_reduce_algorithm<arg_type,
+                typename std::decay<F>::type>(local_result, num_sites);
+
+        if (algorithm != detail::all_reduce_algorithm::central)
+        {
+            std::string name(basename);
+            if (generation != std::size_t(-1))
+                name += std::to_string(generation) + "/";
+
+            return detail::all_reduce_peers(std::move(name),
+                std::forward<T>(local_result), std::forward<F>(op), num_sites,
+                this_site, algorithm);
+        }
+
         if (this_site == root_site)
         {
             return all_reduce(create_all_reduce<T>(
@@ -443,6 +809,55 @@ namespace hpx { namespace lcos {
         return all_reduce(hpx::find_from_basename(std::move(name), root_site),
             std::forward<T>(local_result), std::forward<F>(op), this_site);
     }
+
+    ////////////////////////////////////////////////////////////////////////////
+    template <typename T, typename F>
+    hpx::future<T> all_reduce(char const* basename,
+        hpx::future<T>&& local_result, F&& op,
+        std::size_t num_sites = std::size_t(-1),
+        std::size_t generation = std::size_t(-1),
+        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0)
+    {
+        if (num_sites == std::size_t(-1))
+        {
+            num_sites = static_cast<std::size_t>(
+                hpx::get_num_localities(hpx::launch::sync));
+        }
+        if (this_site == std::size_t(-1))
+            this_site = static_cast<std::size_t>(hpx::get_locality_id());
+
+        // the algorithm depends on the value, select it once it's available
+        if (num_sites > 2 ||
+            hpx::get_config_entry("hpx.lcos.collectives.all_reduce_algorithm",
+                "auto") != "auto")
+        {
+            std::string name(basename);
+            if (generation != std::size_t(-1))
+                name += std::to_string(generation) + "/";
+
+            return local_result.then(hpx::launch::sync,
+                [name = std::move(name), op = std::forward<F>(op), num_sites,
+                    generation, this_site, root_site](
+                    hpx::future<T>&& f) mutable -> hpx::future<T> {
+                    return all_reduce(name.c_str(), f.get(), std::move(op),
+                        num_sites, std::size_t(-1), this_site, root_site);
+                });
+        }
+
+        if (this_site == 0)
+        {
+            return all_reduce(create_all_reduce<T>(
+                                  basename, num_sites, generation, root_site),
+                std::move(local_result), std::forward<F>(op), this_site);
+        }
+
+        std::string name(basename);
+        if (generation != std::size_t(-1))
+            name += std::to_string(generation) + "/";
+
+        return all_reduce(hpx::find_from_basename(std::move(name), root_site),
+            std::move(local_result), std::forward<F>(op), this_site);
+    }
 }}    // namespace hpx::lcos
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -130,6 +130,7 @@ namespace hpx { namespace lcos {
 #include <hpx/config.hpp>
 #include <hpx/apply.hpp>
 #include <hpx/assertion.hpp>
+#include <hpx/collectives/detail/tree_partitions.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/errors.hpp>
 #include <hpx/lcos/detail/async_colocated.hpp>
@@ -145,7 +146,6 @@ namespace hpx { namespace lcos {
 #include <hpx/traits/extract_action.hpp>
 #include <hpx/traits/promise_local_result.hpp>
 #include <hpx/type_support/pack.hpp>
-#include <hpx/util/calculate_fanout.hpp>
 
 #include <cstddef>
 #include <type_traits>
@@ -381,44 +381,36 @@ namespace hpx { namespace lcos {
             if (ids.empty())
                 return;    // hpx::lcos::make_ready_future();
 
-            std::size_t const local_fanout = HPX_BROADCAST_FANOUT;
-            std::size_t local_size = (std::min)(ids.size(), local_fanout);
-            std::size_t fanout =
-                util::calculate_fanout(ids.size(), local_fanout);
+            detail::tree_partitions const parts =
+                detail::calculate_tree_partitions(
+                    ids.size(), HPX_BROADCAST_FANOUT);
 
             std::vector<hpx::future<void>> broadcast_futures;
-            broadcast_futures.reserve(local_size + (ids.size() / fanout) + 1);
-            for (std::size_t i = 0; i != local_size; ++i)
+            broadcast_futures.reserve(
+                parts.local_size_ + parts.subtrees_.size());
+            for (std::size_t i = 0; i != parts.local_size_; ++i)
             {
                 broadcast_invoke(
                     act, broadcast_futures, ids[i], global_idx + i, vs...);
             }
 
-            if (ids.size() > local_fanout)
+            if (!parts.subtrees_.empty())
             {
-                std::size_t applied = local_fanout;
-                std::vector<hpx::id_type>::const_iterator it =
-                    ids.begin() + local_fanout;
-
                 typedef typename detail::make_broadcast_action<Action>::type
                     broadcast_impl_action;
 
-                while (it != ids.end())
+                for (auto const& subtree : parts.subtrees_)
                 {
-                    HPX_ASSERT(ids.size() >= applied);
-
-                    std::size_t next_fan =
-                        (std::min)(fanout, ids.size() - applied);
-                    std::vector<hpx::id_type> ids_next(it, it + next_fan);
+                    auto it = ids.begin() + subtree.first;
+                    std::vector<hpx::id_type> ids_next(
+                        it, it + subtree.second);
 
                     hpx::id_type id(ids_next[0]);
                     broadcast_futures.push_back(
                         hpx::detail::async_colocated<broadcast_impl_action>(id,
-                            act, std::move(ids_next), global_idx + applied,
-                            std::true_type(), vs...));
-
-                    applied += next_fan;
-                    it += next_fan;
+                            act, std::move(ids_next),
+                            global_idx + subtree.first, std::true_type(),
+                            vs...));
                 }
             }
 
@@ -440,45 +432,37 @@ namespace hpx { namespace lcos {
             if (ids.empty())
                 return result_type();
 
-            std::size_t const local_fanout = HPX_BROADCAST_FANOUT;
-            std::size_t local_size = (std::min)(ids.size(), local_fanout);
-            std::size_t fanout =
-                util::calculate_fanout(ids.size(), local_fanout);
+            detail::tree_partitions const parts =
+                detail::calculate_tree_partitions(
+                    ids.size(), HPX_BROADCAST_FANOUT);
 
             std::vector<hpx::future<result_type>> broadcast_futures;
-            broadcast_futures.reserve(local_size + (ids.size() / fanout) + 1);
-            for (std::size_t i = 0; i != local_size; ++i)
+            broadcast_futures.reserve(
+                parts.local_size_ + parts.subtrees_.size());
+            for (std::size_t i = 0; i != parts.local_size_; ++i)
             {
                 broadcast_invoke(act, broadcast_futures,
                     &wrap_into_vector<action_result>, ids[i], global_idx + i,
                     vs...);
             }
 
-            if (ids.size() > local_fanout)
+            if (!parts.subtrees_.empty())
             {
-                std::size_t applied = local_fanout;
-                std::vector<hpx::id_type>::const_iterator it =
-                    ids.begin() + local_fanout;
-
                 typedef typename detail::make_broadcast_action<Action>::type
                     broadcast_impl_action;
 
-                while (it != ids.end())
+                for (auto const& subtree : parts.subtrees_)
                 {
-                    HPX_ASSERT(ids.size() >= applied);
-
-                    std::size_t next_fan =
-                        (std::min)(fanout, ids.size() - applied);
-                    std::vector<hpx::id_type> ids_next(it, it + next_fan);
+                    auto it = ids.begin() + subtree.first;
+                    std::vector<hpx::id_type> ids_next(
+                        it, it + subtree.second);
 
                     hpx::id_type id(ids_next[0]);
                     broadcast_futures.push_back(
                         hpx::detail::async_colocated<broadcast_impl_action>(id,
-                            act, std::move(ids_next), global_idx + applied,
-                            std::false_type(), vs...));
-
-                    applied += next_fan;
-                    it += next_fan;
+                            act, std::move(ids_next),
+                            global_idx + subtree.first, std::false_type(),
+                            vs...));
                 }
             }
 
@@ -496,40 +480,31 @@ namespace hpx { namespace lcos {
             if (ids.empty())
                 return;
 
-            std::size_t const local_fanout = HPX_BROADCAST_FANOUT;
-            std::size_t local_size = (std::min)(ids.size(), local_fanout);
+            detail::tree_partitions const parts =
+                detail::calculate_tree_partitions(
+                    ids.size(), HPX_BROADCAST_FANOUT);
 
-            for (std::size_t i = 0; i != local_size; ++i)
+            for (std::size_t i = 0; i != parts.local_size_; ++i)
             {
                 broadcast_invoke_apply(act, ids[i], global_idx + i, vs...);
             }
 
-            if (ids.size() > local_fanout)
+            if (!parts.subtrees_.empty())
             {
-                std::size_t applied = local_fanout;
-                std::vector<hpx::id_type>::const_iterator it =
-                    ids.begin() + local_fanout;
-
                 typedef
                     typename detail::make_broadcast_apply_action<Action>::type
                         broadcast_impl_action;
 
-                std::size_t fanout =
-                    util::calculate_fanout(ids.size(), local_fanout);
-                while (it != ids.end())
+                for (auto const& subtree : parts.subtrees_)
                 {
-                    HPX_ASSERT(ids.size() >= applied);
-
-                    std::size_t next_fan =
-                        (std::min)(fanout, ids.size() - applied);
-                    std::vector<hpx::id_type> ids_next(it, it + next_fan);
+                    auto it = ids.begin() + subtree.first;
+                    std::vector<hpx::id_type> ids_next(
+                        it, it + subtree.second);
 
                     hpx::id_type id(ids_next[0]);
                     hpx::detail::apply_colocated<broadcast_impl_action>(id, act,
-                        std::move(ids_next), global_idx + applied, vs...);
-
-                    applied += next_fan;
-                    it += next_fan;
+                        std::move(ids_next), global_idx + subtree.first,
+                        vs...);
                 }
             }
         }
@@ -0,0 +1,58 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_COLLECTIVES_DETAIL_TREE_PARTITIONS_HPP)
+#define HPX_COLLECTIVES_DETAIL_TREE_PARTITIONS_HPP
+
+#include <hpx/config.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace lcos { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The shape of one node of the tree used to distribute a collective
+    // operation over a list of targets. The node is colocated with the first
+    // of its targets.
+    struct tree_partitions
+    {
+        // the number of (leading) targets which are invoked directly
+        std::size_t local_size_;
+
+        // the ranges of targets (first, count) delegated to other nodes, each
+        // of those is handled by a node colocated with its first target
+        std::vector<std::pair<std::size_t, std::size_t>> subtrees_;
+    };
+
+    // Up to local_fanout targets are invoked directly. Larger lists of targets
+    // are split like a binomial tree: the first two targets are invoked
+    // directly, the ranges [2, 4), [4, 8), [8, 16), ... are delegated. This
+    // keeps both, the number of messages sent by any node and the depth of
+    // the tree, logarithmic in the number of targets.
+    inline tree_partitions calculate_tree_partitions(
+        std::size_t size, std::size_t local_fanout)
+    {
+        tree_partitions result;
+        if (size <= (std::max)(local_fanout, std::size_t(2)))
+        {
+            result.local_size_ = size;
+            return result;
+        }
+
+        result.local_size_ = 2;
+        for (std::size_t first = 2; first < size; first *= 2)
+        {
+            result.subtrees_.emplace_back(
+                first, (std::min)(first, size - first));
+        }
+        return result;
+    }
+}}}    // namespace hpx::lcos::detail
+
+#endif
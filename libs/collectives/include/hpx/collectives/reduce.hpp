@@ -76,6 +76,7 @@ namespace hpx { namespace lcos {
 
 #include <hpx/config.hpp>
 #include <hpx/assertion.hpp>
+#include <hpx/collectives/detail/tree_partitions.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/lcos/detail/async_colocated.hpp>
 #include <hpx/lcos/future.hpp>
@@ -90,7 +91,6 @@ namespace hpx { namespace lcos {
 #include <hpx/traits/promise_local_result.hpp>
 #include <hpx/type_support/decay.hpp>
 #include <hpx/type_support/pack.hpp>
-#include <hpx/util/calculate_fanout.hpp>
 
 #include <cstddef>
 #include <utility>
@@ -236,45 +236,35 @@ namespace hpx { namespace lcos {
             if (ids.empty())
                 return result_type();
 
-            std::size_t const local_fanout = HPX_REDUCE_FANOUT;
-            std::size_t local_size = (std::min)(ids.size(), local_fanout);
-            std::size_t fanout =
-                util::calculate_fanout(ids.size(), local_fanout);
+            detail::tree_partitions const parts =
+                detail::calculate_tree_partitions(
+                    ids.size(), HPX_REDUCE_FANOUT);
 
             std::vector<hpx::future<result_type>> reduce_futures;
-            reduce_futures.reserve(local_size + (ids.size() / fanout) + 1);
-            for (std::size_t i = 0; i != local_size; ++i)
+            reduce_futures.reserve(parts.local_size_ + parts.subtrees_.size());
+            for (std::size_t i = 0; i != parts.local_size_; ++i)
             {
                 reduce_invoke(
                     act, reduce_futures, ids[i], global_idx + i, vs...);
             }
 
-            if (ids.size() > local_fanout)
+            if (!parts.subtrees_.empty())
             {
-                std::size_t applied = local_fanout;
-                std::vector<hpx::id_type>::const_iterator it =
-                    ids.begin() + local_fanout;
-
                 typedef typename detail::make_reduce_action<
                     Action>::template reduce_invoker_helper<ReduceOp>::type
                     reduce_impl_action;
 
-                while (it != ids.end())
+                for (auto const& subtree : parts.subtrees_)
                 {
-                    HPX_ASSERT(ids.size() >= applied);
-
-                    std::size_t next_fan =
-                        (std::min)(fanout, ids.size() - applied);
-                    std::vector<hpx::id_type> ids_next(it, it + next_fan);
+                    auto it = ids.begin() + subtree.first;
+                    std::vector<hpx::id_type> ids_next(
+                        it, it + subtree.second);
 
                     hpx::id_type id(ids_next[0]);
                     reduce_futures.push_back(
                         hpx::detail::async_colocated<reduce_impl_action>(id,
                             act, std::move(ids_next), reduce_op,
-                            global_idx + applied, vs...));
-
-                    applied += next_fan;
-                    it += next_fan;
+                            global_idx + subtree.first, vs...));
                 }
             }
 
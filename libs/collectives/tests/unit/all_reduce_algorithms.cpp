@@ -0,0 +1,145 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/collectives.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct plus_elementwise
+{
+    std::vector<int> operator()(
+        std::vector<int> lhs, std::vector<int> const& rhs) const
+    {
+        HPX_TEST_EQ(lhs.size(), rhs.size());
+        for (std::size_t i = 0; i != lhs.size(); ++i)
+        {
+            lhs[i] += rhs[i];
+        }
+        return lhs;
+    }
+};
+
+namespace hpx { namespace traits {
+
+    template <>
+    struct is_elementwise_reduction<plus_elementwise> : std::true_type
+    {
+    };
+}}    // namespace hpx::traits
+
+typedef std::vector<int> vector_int;
+
+HPX_REGISTER_ALLREDUCE(std::uint32_t, test_all_reduce_algorithms);
+HPX_REGISTER_ALLREDUCE(vector_int, test_all_reduce_algorithms_vector);
+
+///////////////////////////////////////////////////////////////////////////////
+void test_scalar(std::string const& algorithm, std::uint32_t num_localities)
+{
+    hpx::set_config_entry(
+        "hpx.lcos.collectives.all_reduce_algorithm", algorithm);
+
+    std::string basename = "/test/all_reduce_algorithms/" + algorithm + "/";
+
+    std::uint32_t sum = 0;
+    for (std::uint32_t j = 0; j != num_localities; ++j)
+    {
+        sum += j;
+    }
+
+    for (int i = 0; i != 10; ++i)
+    {
+        hpx::future<std::uint32_t> overall_result =
+            hpx::all_reduce(basename.c_str(), hpx::get_locality_id(),
+                std::plus<std::uint32_t>{}, num_localities, i);
+
+        HPX_TEST_EQ(sum, overall_result.get());
+    }
+
+    for (int i = 10; i != 20; ++i)
+    {
+        hpx::future<std::uint32_t> value =
+            hpx::make_ready_future(hpx::get_locality_id());
+
+        hpx::future<std::uint32_t> overall_result =
+            hpx::all_reduce(basename.c_str(), std::move(value),
+                std::plus<std::uint32_t>{}, num_localities, i);
+
+        HPX_TEST_EQ(sum, overall_result.get());
+    }
+}
+
+void test_vector(std::string const& algorithm, std::uint32_t num_localities)
+{
+    hpx::set_config_entry(
+        "hpx.lcos.collectives.all_reduce_algorithm", algorithm);
+
+    std::string basename =
+        "/test/all_reduce_algorithms/vector/" + algorithm + "/";
+
+    // sizes not evenly divisible by the number of sites are intentional
+    std::size_t const sizes[] = {1, 7, 1000};
+    int generation = 0;
+    for (std::size_t size : sizes)
+    {
+        std::uint32_t const this_locality = hpx::get_locality_id();
+
+        std::vector<int> value(size);
+        for (std::size_t k = 0; k != size; ++k)
+        {
+            value[k] = static_cast<int>(k + this_locality);
+        }
+
+        hpx::future<std::vector<int>> overall_result =
+            hpx::all_reduce(basename.c_str(), std::move(value),
+                plus_elementwise{}, num_localities, generation++);
+
+        std::vector<int> result = overall_result.get();
+        HPX_TEST_EQ(result.size(), size);
+        for (std::size_t k = 0; k != result.size(); ++k)
+        {
+            int expected = 0;
+            for (std::uint32_t j = 0; j != num_localities; ++j)
+            {
+                expected += static_cast<int>(k + j);
+            }
+            HPX_TEST_EQ(result[k], expected);
+        }
+    }
+}
+
+int hpx_main(int argc, char* argv[])
+{
+    std::uint32_t num_localities = hpx::get_num_localities(hpx::launch::sync);
+
+    for (char const* algorithm : {"central", "recursive_doubling", "auto"})
+    {
+        test_scalar(algorithm, num_localities);
+    }
+
+    for (char const* algorithm : {"central", "recursive_doubling", "ring"})
+    {
+        test_vector(algorithm, num_localities);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,213 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This is an implementation of the dynamic circular work-stealing deque as
+// described in:
+//
+//   D. Chase and Y. Lev, "Dynamic Circular Work-Stealing Deque", SPAA 2005
+//
+// using the C11 memory model mapping given in:
+//
+//   N.M. Le, A. Pop, A. Cohen and F. Zappa Nardelli, "Correct and Efficient
+//   Work-Stealing for Weak Memory Models", PPoPP 2013
+//
+// The owning thread pushes and pops items at the bottom end of the deque
+// (LIFO) without using any read-modify-write operations, except when racing
+// with a thief for the very last item. Any other thread may steal items from
+// the top end (FIFO).
+
+#if !defined(HPX_CONCURRENCY_CHASE_LEV_DEQUE_HPP)
+#define HPX_CONCURRENCY_CHASE_LEV_DEQUE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace hpx { namespace util {
+
+    template <typename T>
+    class chase_lev_deque
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+            "chase_lev_deque requires trivially copyable items");
+
+        // circular array, the capacity is always a power of two
+        class array
+        {
+        public:
+            explicit array(std::int64_t capacity)
+              : mask_(capacity - 1)
+              , items_(new std::atomic<T>[std::size_t(capacity)])
+            {
+                HPX_ASSERT(capacity > 0 && (capacity & mask_) == 0);
+            }
+
+            std::int64_t capacity() const
+            {
+                return mask_ + 1;
+            }
+
+            T get(std::int64_t i) const
+            {
+                return items_[i & mask_].load(std::memory_order_relaxed);
+            }
+
+            void put(std::int64_t i, T val)
+            {
+                items_[i & mask_].store(val, std::memory_order_relaxed);
+            }
+
+            array* grow(std::int64_t bottom, std::int64_t top) const
+            {
+                array* a = new array(2 * capacity());
+                for (std::int64_t i = top; i != bottom; ++i)
+                {
+                    a->put(i, get(i));
+                }
+                return a;
+            }
+
+        private:
+            std::int64_t mask_;
+            std::unique_ptr<std::atomic<T>[]> items_;
+        };
+
+        static std::int64_t round_up_capacity(std::size_t initial_capacity)
+        {
+            std::int64_t capacity = 16;
+            while (capacity < std::int64_t(initial_capacity))
+                capacity *= 2;
+            return capacity;
+        }
+
+    public:
+        explicit chase_lev_deque(std::size_t initial_capacity = 128)
+          : array_(new array(round_up_capacity(initial_capacity)))
+        {
+            top_.data_.store(0, std::memory_order_relaxed);
+            bottom_.data_.store(0, std::memory_order_relaxed);
+        }
+
+        chase_lev_deque(chase_lev_deque const&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque const&) = delete;
+
+        ~chase_lev_deque()
+        {
+            delete array_.load(std::memory_order_relaxed);
+        }
+
+        // Add an item at the bottom end of the deque. This may be called by
+        // the owning thread only.
+        void push(T val)
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            array* a = array_.load(std::memory_order_relaxed);
+
+            if (b - t > a->capacity() - 1)
+            {
+                // Thieves might still be reading from the old array, keep it
+                // alive until the deque is destroyed. The overall amount of
+                // memory kept is bounded by the size of the current array.
+                array* new_array = a->grow(b, t);
+                retired_.emplace_back(a);
+                array_.store(new_array, std::memory_order_release);
+                a = new_array;
+            }
+
+            a->put(b, val);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+        }
+
+        // Remove the item at the bottom end of the deque. This may be called
+        // by the owning thread only.
+        bool pop(T& val)
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed) - 1;
+            array* a = array_.load(std::memory_order_relaxed);
+            bottom_.data_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                // the deque was empty
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            val = a->get(b);
+            if (t == b)
+            {
+                // this is the last item, race against thieves for it
+                bool success = top_.data_.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed);
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return success;
+            }
+            return true;
+        }
+
+        // Remove the item at the top end of the deque. This may be called by
+        // any thread.
+        bool steal(T& val)
+        {
+            while (true)
+            {
+                std::int64_t t = top_.data_.load(std::memory_order_acquire);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                std::int64_t b = bottom_.data_.load(std::memory_order_acquire);
+
+                if (t >= b)
+                    return false;
+
+                T item = array_.load(std::memory_order_acquire)->get(t);
+                if (top_.data_.compare_exchange_strong(t, t + 1,
+                        std::memory_order_seq_cst, std::memory_order_relaxed))
+                {
+                    val = item;
+                    return true;
+                }
+
+                // lost the race against another thief or the owner, retry
+            }
+        }
+
+        // The result is accurate only if no other thread modifies the deque
+        // concurrently.
+        bool empty() const
+        {
+            return size() <= 0;
+        }
+
+        std::int64_t size() const
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+            return b - t;
+        }
+
+    private:
+        // top_ is modified by thieves, bottom_ by the owner only, keep them
+        // on separate cache lines
+        util::cache_line_data<std::atomic<std::int64_t>> top_;
+        util::cache_line_data<std::atomic<std::int64_t>> bottom_;
+        std::atomic<array*> array_;
+
+        // old arrays, accessed by the owner only
+        std::vector<std::unique_ptr<array>> retired_;
+    };
+}}    // namespace hpx::util
+
+#endif
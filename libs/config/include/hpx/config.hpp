@@ -171,6 +171,19 @@
 #  define HPX_AGAS_LOCAL_CACHE_SIZE 4096
 #endif
 
+/// This defines the number of independently locked shards the AGAS local
+/// cache is split into.
+///
+/// This value can be changes at runtime by setting the configuration parameter:
+///
+///   hpx.agas.local_cache_shards = ...
+///
+/// (or by setting the corresponding environment variable
+/// HPX_AGAS_LOCAL_CACHE_SHARDS)
+#if !defined(HPX_AGAS_LOCAL_CACHE_SHARDS)
+#  define HPX_AGAS_LOCAL_CACHE_SHARDS 16
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 #if !defined(HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS)
 #  define HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS 4096
@@ -440,6 +453,14 @@
 #  define HPX_THREAD_QUEUE_MAX_TERMINATED_THREADS 100
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Maximum number of recycled thread objects to keep per stack size in each
+// thread queue. The stacks of any other terminated threads are returned to the
+// stack cache of the worker thread.
+#if !defined(HPX_THREAD_QUEUE_MAX_THREAD_HEAP_SIZE)
+#  define HPX_THREAD_QUEUE_MAX_THREAD_HEAP_SIZE 1000
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Maximum sleep time for idle backoff in milliseconds (used only if
 // HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF is defined).
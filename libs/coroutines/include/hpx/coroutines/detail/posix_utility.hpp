@@ -47,6 +47,7 @@
  */
 #include <cerrno>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <stdexcept>
 
@@ -78,7 +79,29 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
     _POSIX_MAPPED_FILES > 0
 
-        inline void* alloc_stack(std::size_t size)
+        ///////////////////////////////////////////////////////////////////////
+        // Freed stacks are kept in a cache local to the OS thread freeing
+        // them. As worker threads are pinned, the cached pages stay on the
+        // NUMA domain they were first touched on. The cache holds at most
+        // stack_cache_size stacks, the pages of the least recently cached
+        // stacks are released to the OS once the number of (estimated)
+        // resident bytes exceeds stack_cache_high_watermark.
+        HPX_EXPORT extern std::size_t stack_cache_size;
+        HPX_EXPORT extern std::size_t stack_cache_high_watermark;
+
+        // returns nullptr if no stack of the given size was cached
+        HPX_EXPORT void* get_cached_stack(std::size_t size);
+
+        // returns false if the stack could not be added to the cache
+        HPX_EXPORT bool cache_stack(void* stack, std::size_t size);
+
+        HPX_EXPORT std::int64_t get_stack_cache_hits(bool reset);
+        HPX_EXPORT std::int64_t get_stack_cache_misses(bool reset);
+        HPX_EXPORT std::int64_t get_stack_cache_resident_bytes(bool reset);
+        HPX_EXPORT std::int64_t get_stack_cache_trimmed_bytes(bool reset);
+
+        ///////////////////////////////////////////////////////////////////////
+        inline void* map_stack(std::size_t size)
         {
             void* real_stack = ::mmap(nullptr, size + EXEC_PAGESIZE,
                 PROT_EXEC | PROT_READ | PROT_WRITE,
@@ -124,6 +147,16 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
 #endif
         }
 
+        inline void* alloc_stack(std::size_t size)
+        {
+            void* stack = get_cached_stack(size);
+            if (stack == nullptr)
+            {
+                stack = map_stack(size);
+            }
+            return stack;
+        }
+
         inline void watermark_stack(void* stack, std::size_t size)
         {
             HPX_ASSERT(size > EXEC_PAGESIZE);
@@ -152,7 +185,7 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
             return false;
         }
 
-        inline void free_stack(void* stack, std::size_t size)
+        inline void unmap_stack(void* stack, std::size_t size)
         {
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
             if (use_guard_pages)
@@ -170,6 +203,14 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
 #endif
         }
 
+        inline void free_stack(void* stack, std::size_t size)
+        {
+            if (!cache_stack(stack, size))
+            {
+                unmap_stack(stack, size);
+            }
+        }
+
 #else    // non-mmap()
 
         //this should be a fine default.
@@ -10,11 +10,220 @@
     defined(__FreeBSD__) || defined(__APPLE__)
 #include <hpx/coroutines/detail/posix_utility.hpp>
 
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+#endif
+
 namespace hpx { namespace threads { namespace coroutines { namespace detail {
     namespace posix {
         ///////////////////////////////////////////////////////////////////////
         // this global (urghhh) variable is used to control whether guard pages
         // will be used or not
         HPX_EXPORT bool use_guard_pages = true;
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+        ///////////////////////////////////////////////////////////////////////
+        // these are set from the runtime configuration (hpx.stacks section)
+        HPX_EXPORT std::size_t stack_cache_size = 64;
+        HPX_EXPORT std::size_t stack_cache_high_watermark = 0x800000;
+
+        namespace {
+            std::atomic<std::int64_t> stack_cache_hits(0);
+            std::atomic<std::int64_t> stack_cache_misses(0);
+            std::atomic<std::int64_t> stack_cache_resident_bytes(0);
+            std::atomic<std::int64_t> stack_cache_trimmed_bytes(0);
+
+            std::int64_t get_and_reset(
+                std::atomic<std::int64_t>& value, bool reset)
+            {
+                return reset ? value.exchange(0) : value.load();
+            }
+
+            // Estimate the number of resident bytes of a freed stack. Stacks
+            // which did not grow beyond their first page still have their
+            // watermark intact (see watermark_stack).
+            std::size_t resident_size(void* stack, std::size_t size)
+            {
+                void** watermark = static_cast<void**>(stack) +
+                    ((size - EXEC_PAGESIZE) / sizeof(void*));
+
+                if ((reinterpret_cast<void*>(0xDEADBEEFDEADBEEFull)) !=
+                    *watermark)
+                {
+                    return size;
+                }
+                return EXEC_PAGESIZE;
+            }
+
+            // Release all but the first page of the given stack, the first
+            // page is initialized only when the stack is created.
+            void trim_stack(void* stack, std::size_t size)
+            {
+#if defined(MADV_FREE)
+                ::madvise(stack, size - EXEC_PAGESIZE, MADV_FREE);
+#else
+                ::madvise(stack, size - EXEC_PAGESIZE, MADV_DONTNEED);
+#endif
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            class stack_cache
+            {
+                struct cached_stack
+                {
+                    void* stack_;
+                    std::size_t size_;
+                    std::size_t resident_;
+                };
+
+            public:
+                stack_cache()
+                  : resident_(0)
+                {
+                }
+
+                ~stack_cache()
+                {
+                    for (cached_stack const& s : stacks_)
+                    {
+                        stack_cache_resident_bytes -=
+                            static_cast<std::int64_t>(s.resident_);
+                        unmap_stack(s.stack_, s.size_);
+                    }
+                    destroyed() = true;
+                }
+
+                // the cache of the current OS thread has already been
+                // destroyed if stacks are freed during thread shutdown
+                static bool& destroyed()
+                {
+                    static thread_local bool destroyed_ = false;
+                    return destroyed_;
+                }
+
+                void* get(std::size_t size)
+                {
+                    // the most recently cached stacks are the warmest ones
+                    for (auto it = stacks_.rbegin(); it != stacks_.rend(); ++it)
+                    {
+                        if (it->size_ == size)
+                        {
+                            void* stack = it->stack_;
+                            resident_ -= it->resident_;
+                            stack_cache_resident_bytes -=
+                                static_cast<std::int64_t>(it->resident_);
+                            stacks_.erase(std::next(it).base());
+                            return stack;
+                        }
+                    }
+                    return nullptr;
+                }
+
+                bool put(void* stack, std::size_t size)
+                {
+                    if (stacks_.size() >= stack_cache_size)
+                        return false;
+
+                    std::size_t resident = resident_size(stack, size);
+                    stacks_.push_back(cached_stack{stack, size, resident});
+
+                    resident_ += resident;
+                    stack_cache_resident_bytes +=
+                        static_cast<std::int64_t>(resident);
+
+                    if (resident_ > stack_cache_high_watermark)
+                        trim();
+
+                    return true;
+                }
+
+            private:
+                // release the pages of the least recently cached stacks until
+                // the resident size has dropped below the high watermark
+                void trim()
+                {
+                    for (cached_stack& s : stacks_)
+                    {
+                        if (resident_ <= stack_cache_high_watermark)
+                            break;
+
+                        if (s.resident_ <= EXEC_PAGESIZE)
+                            continue;
+
+                        trim_stack(s.stack_, s.size_);
+
+                        std::size_t trimmed = s.resident_ - EXEC_PAGESIZE;
+                        s.resident_ = EXEC_PAGESIZE;
+                        resident_ -= trimmed;
+
+                        stack_cache_resident_bytes -=
+                            static_cast<std::int64_t>(trimmed);
+                        stack_cache_trimmed_bytes +=
+                            static_cast<std::int64_t>(trimmed);
+                    }
+                }
+
+                std::vector<cached_stack> stacks_;
+                std::size_t resident_;
+            };
+
+            stack_cache& get_stack_cache()
+            {
+                static thread_local stack_cache cache;
+                return cache;
+            }
+        }    // namespace
+
+        void* get_cached_stack(std::size_t size)
+        {
+            if (stack_cache_size == 0 || stack_cache::destroyed())
+                return nullptr;
+
+            void* stack = get_stack_cache().get(size);
+            if (stack != nullptr)
+            {
+                stack_cache_hits.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                stack_cache_misses.fetch_add(1, std::memory_order_relaxed);
+            }
+            return stack;
+        }
+
+        bool cache_stack(void* stack, std::size_t size)
+        {
+            if (stack_cache_size == 0 || stack_cache::destroyed())
+                return false;
+
+            return get_stack_cache().put(stack, size);
+        }
+
+        std::int64_t get_stack_cache_hits(bool reset)
+        {
+            return get_and_reset(stack_cache_hits, reset);
+        }
+
+        std::int64_t get_stack_cache_misses(bool reset)
+        {
+            return get_and_reset(stack_cache_misses, reset);
+        }
+
+        std::int64_t get_stack_cache_resident_bytes(bool /*reset*/)
+        {
+            return stack_cache_resident_bytes.load();
+        }
+
+        std::int64_t get_stack_cache_trimmed_bytes(bool reset)
+        {
+            return get_and_reset(stack_cache_trimmed_bytes, reset);
+        }
+#endif
 }}}}}    // namespace hpx::threads::coroutines::detail::posix
 #endif
@@ -14,10 +14,13 @@
 #include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/assertion.hpp>
 #include <hpx/async_launch_policy_dispatch.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/errors.hpp>
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/execution/executors/fused_bulk_execute.hpp>
 #include <hpx/execution/executors/post_policy_dispatch.hpp>
 #include <hpx/execution/executors/static_chunk_size.hpp>
+#include <hpx/execution/traits/executor_traits.hpp>
 #include <hpx/execution/traits/is_executor.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/deferred_call.hpp>
@@ -28,6 +31,7 @@
 #include <hpx/runtime/launch_policy.hpp>
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/synchronization/latch.hpp>
+#include <hpx/synchronization/spinlock.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
@@ -36,7 +40,12 @@
 #include <hpx/util/unwrap.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <exception>
+#include <list>
+#include <mutex>
+#include <new>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -65,12 +74,144 @@ namespace hpx { namespace parallel { namespace execution {
         template <typename F, typename Shape, typename... Ts>
         struct bulk_function_result;
 
+        template <typename F, typename Shape, typename... Ts>
+        struct bulk_execute_result;
+
         ///////////////////////////////////////////////////////////////////////
         template <typename F, typename Shape, typename Future, typename... Ts>
         struct bulk_then_execute_result;
 
         template <typename F, typename Shape, typename Future, typename... Ts>
         struct then_bulk_function_result;
+
+        ///////////////////////////////////////////////////////////////////////
+        // Shared state of a bulk_sync_execute: all tasks count down the same
+        // latch, write their result into a preallocated slot, and collect
+        // their exceptions into one list.
+        struct bulk_sync_state_base
+        {
+            explicit bulk_sync_state_base(std::size_t size)
+              : latch_(static_cast<std::ptrdiff_t>(size))
+              , has_errors_(false)
+            {
+            }
+
+            void set_exception(std::exception_ptr e)
+            {
+                std::lock_guard<lcos::local::spinlock> l(mtx_);
+                errors_.push_back(std::move(e));
+                has_errors_.store(true, std::memory_order_relaxed);
+            }
+
+            void set_bad_alloc(std::exception_ptr e)
+            {
+                std::lock_guard<lcos::local::spinlock> l(mtx_);
+                if (!bad_alloc_)
+                    bad_alloc_ = std::move(e);
+                has_errors_.store(true, std::memory_order_relaxed);
+            }
+
+            // wait for all tasks to finish and rethrow either bad_alloc or
+            // an exception_list holding all other exceptions
+            void wait()
+            {
+                latch_.wait();
+
+                // no other threads may access the exceptions at this point
+                if (has_errors_.load(std::memory_order_relaxed))
+                {
+                    if (bad_alloc_)
+                        std::rethrow_exception(bad_alloc_);
+                    throw exception_list(std::move(errors_));
+                }
+            }
+
+            lcos::local::latch latch_;
+            std::atomic<bool> has_errors_;
+            lcos::local::spinlock mtx_;
+            std::list<std::exception_ptr> errors_;
+            std::exception_ptr bad_alloc_;
+        };
+
+        template <typename Result>
+        struct bulk_sync_state : bulk_sync_state_base
+        {
+            explicit bulk_sync_state(std::size_t size)
+              : bulk_sync_state_base(size)
+              , results_(size)
+            {
+            }
+
+            template <typename F, typename T, typename... Ts>
+            void execute(std::size_t i, F const& f, T&& t, Ts const&... ts)
+            {
+                try
+                {
+                    // every task invokes its own copy of the function object
+                    typename std::decay<F>::type func(f);
+                    results_[i].emplace(
+                        hpx::util::invoke(func, std::forward<T>(t), ts...));
+                }
+                catch (std::bad_alloc const&)
+                {
+                    set_bad_alloc(std::current_exception());
+                }
+                catch (...)
+                {
+                    set_exception(std::current_exception());
+                }
+                latch_.count_down(1);
+            }
+
+            std::vector<Result> get()
+            {
+                wait();
+
+                std::vector<Result> results;
+                results.reserve(results_.size());
+                for (auto& r : results_)
+                {
+                    results.push_back(std::move(*r));
+                }
+                return results;
+            }
+
+            std::vector<hpx::util::optional<Result>> results_;
+        };
+
+        template <>
+        struct bulk_sync_state<void> : bulk_sync_state_base
+        {
+            explicit bulk_sync_state(std::size_t size)
+              : bulk_sync_state_base(size)
+            {
+            }
+
+            template <typename F, typename T, typename... Ts>
+            void execute(std::size_t, F const& f, T&& t, Ts const&... ts)
+            {
+                try
+                {
+                    // every task invokes its own copy of the function object
+                    typename std::decay<F>::type func(f);
+                    hpx::util::invoke(func, std::forward<T>(t), ts...);
+                }
+                catch (std::bad_alloc const&)
+                {
+                    set_bad_alloc(std::current_exception());
+                }
+                catch (...)
+                {
+                    set_exception(std::current_exception());
+                }
+                latch_.count_down(1);
+            }
+
+            void get()
+            {
+                wait();
+            }
+        };
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -252,6 +393,46 @@ namespace hpx { namespace parallel { namespace execution {
             return results;
         }
 
+        // BulkOneWayExecutor interface
+        //
+        // All tasks report to one shared state instead of creating a future
+        // each. Results are written in place and exceptions are collected
+        // into an exception_list (std::bad_alloc is rethrown as is).
+        template <typename F, typename S, typename... Ts>
+        typename detail::bulk_execute_result<F, S, Ts...>::type
+        bulk_sync_execute(F&& f, S const& shape, Ts&&... ts) const
+        {
+            using result_type =
+                typename detail::bulk_function_result<F, S, Ts...>::type;
+
+            std::size_t size = hpx::util::size(shape);
+            detail::bulk_sync_state<result_type> state(size);
+
+            if (hpx::detail::has_async_policy(policy_))
+            {
+                std::size_t num_tasks = num_tasks_;
+                if (num_tasks == std::size_t(-1))
+                {
+                    auto pool = threads::detail::get_self_or_default_pool();
+                    num_tasks = (std::min)(
+                        std::size_t(128), pool->get_os_thread_count());
+                }
+
+                spawn_hierarchical(state, 0, size, num_tasks, f,
+                    hpx::util::begin(shape), ts...);
+            }
+            else
+            {
+                auto it = hpx::util::begin(shape);
+                for (std::size_t i = 0; i != size; ++i, ++it)
+                {
+                    state.execute(i, f, *it, ts...);
+                }
+            }
+
+            return state.get();
+        }
+
         template <typename F, typename S, typename Future, typename... Ts>
         hpx::future<typename detail::bulk_then_execute_result<F, S, Future,
             Ts...>::type>
@@ -347,6 +528,48 @@ namespace hpx { namespace parallel { namespace execution {
             // spawn remaining tasks sequentially
             spawn_sequential(results, l, base, size, func, it, ts...);
         }
+
+        template <typename Result, typename F, typename Iter, typename... Ts>
+        void spawn_sequential(detail::bulk_sync_state<Result>& state,
+            std::size_t base, std::size_t size, F const& func, Iter it,
+            Ts const&... ts) const
+        {
+            // spawn tasks sequentially
+            for (std::size_t i = 0; i != size; ++i, ++it)
+            {
+                post([&, base, i, it] {
+                    state.execute(base + i, func, *it, ts...);
+                });
+            }
+        }
+
+        template <typename Result, typename F, typename Iter, typename... Ts>
+        void spawn_hierarchical(detail::bulk_sync_state<Result>& state,
+            std::size_t base, std::size_t size, std::size_t num_tasks,
+            F const& func, Iter it, Ts const&... ts) const
+        {
+            if (size > num_tasks)
+            {
+                // spawn hierarchical tasks
+                std::size_t chunk_size = (size + num_spread_) / num_spread_ - 1;
+                chunk_size = (std::max)(chunk_size, num_tasks);
+
+                while (size > chunk_size)
+                {
+                    post([&, base, chunk_size, num_tasks, it] {
+                        spawn_hierarchical(state, base, chunk_size,
+                            num_tasks, func, it, ts...);
+                    });
+
+                    base += chunk_size;
+                    it = hpx::parallel::v1::detail::next(it, chunk_size);
+                    size -= chunk_size;
+                }
+            }
+
+            // spawn remaining tasks sequentially
+            spawn_sequential(state, base, size, func, it, ts...);
+        }
         /// \endcond
 
     private:
@@ -395,6 +618,12 @@ namespace hpx { namespace parallel { namespace execution {
         parallel::execution::parallel_policy_executor<Policy>> : std::true_type
     {
     };
+
+    template <typename Policy>
+    struct has_aggregated_bulk_sync_execute<
+        parallel::execution::parallel_policy_executor<Policy>> : std::true_type
+    {
+    };
     /// \endcond
 }}}    // namespace hpx::parallel::execution
 
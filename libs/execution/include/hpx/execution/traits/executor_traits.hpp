@@ -76,6 +76,15 @@ namespace hpx { namespace parallel { namespace execution {
     {
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Condition: T::bulk_sync_execute reports all of its tasks through a
+    // single shared state, which makes it cheaper than bulk_async_execute
+    // followed by waiting for each of the returned futures.
+    template <typename T, typename Enable = void>
+    struct has_aggregated_bulk_sync_execute : std::false_type
+    {
+    };
+
 #if defined(HPX_HAVE_CXX17_VARIABLE_TEMPLATES)
     template <typename T>
     constexpr bool has_post_member_v = has_post_member<T>::value;
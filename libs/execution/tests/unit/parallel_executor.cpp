@@ -10,9 +10,11 @@
 #include <hpx/testing.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdlib>
 #include <iterator>
 #include <numeric>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -89,6 +91,55 @@ void test_bulk_sync()
     hpx::parallel::execution::bulk_sync_execute(exec, &bulk_test, v, tid, 42);
 }
 
+int bulk_test_value(int value, int passed_through)
+{
+    HPX_TEST_EQ(passed_through, 42);
+    if (value % 10 == 0)
+        throw std::runtime_error("bulk_test_value");
+    return value + passed_through;
+}
+
+void test_bulk_sync_results()
+{
+    typedef hpx::parallel::execution::parallel_executor executor;
+
+    std::vector<int> v(107);
+    std::iota(std::begin(v), std::end(v), 1);
+
+    executor exec;
+
+    std::vector<int> odd;
+    std::copy_if(std::begin(v), std::end(v), std::back_inserter(odd),
+        [](int value) { return value % 2 != 0; });
+
+    std::vector<int> results = hpx::parallel::execution::bulk_sync_execute(
+        exec, &bulk_test_value, odd, 42);
+    HPX_TEST_EQ(results.size(), odd.size());
+    for (std::size_t i = 0; i != odd.size(); ++i)
+    {
+        HPX_TEST_EQ(results[i], odd[i] + 42);
+    }
+
+    // all exceptions are collected into a single exception_list
+    bool caught_exception = false;
+    try
+    {
+        hpx::parallel::execution::bulk_sync_execute(
+            exec, &bulk_test_value, v, 42);
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e)
+    {
+        caught_exception = true;
+        HPX_TEST_EQ(e.size(), v.size() / 10);
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+    HPX_TEST(caught_exception);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void test_bulk_async()
 {
@@ -158,8 +209,8 @@ void static_check_executor()
         "has_async_execute_member<executor>::value");
     static_assert(has_then_execute_member<executor>::value,
         "has_then_execute_member<executor>::value");
-    static_assert(!has_bulk_sync_execute_member<executor>::value,
-        "!has_bulk_sync_execute_member<executor>::value");
+    static_assert(has_bulk_sync_execute_member<executor>::value,
+        "has_bulk_sync_execute_member<executor>::value");
     static_assert(has_bulk_async_execute_member<executor>::value,
         "has_bulk_async_execute_member<executor>::value");
     static_assert(has_bulk_then_execute_member<executor>::value,
@@ -178,6 +229,7 @@ int hpx_main(int argc, char* argv[])
     test_then();
 
     test_bulk_sync();
+    test_bulk_sync_results();
     test_bulk_async();
     test_bulk_then();
 
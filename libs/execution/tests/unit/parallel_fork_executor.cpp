@@ -157,8 +157,8 @@ void static_check_executor()
         "has_async_execute_member<executor>::value");
     static_assert(has_then_execute_member<executor>::value,
         "has_then_execute_member<executor>::value");
-    static_assert(!has_bulk_sync_execute_member<executor>::value,
-        "!has_bulk_sync_execute_member<executor>::value");
+    static_assert(has_bulk_sync_execute_member<executor>::value,
+        "has_bulk_sync_execute_member<executor>::value");
     static_assert(has_bulk_async_execute_member<executor>::value,
         "has_bulk_async_execute_member<executor>::value");
     static_assert(has_bulk_then_execute_member<executor>::value,
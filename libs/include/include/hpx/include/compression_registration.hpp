@@ -9,8 +9,10 @@
 
 #include <hpx/config.hpp>
 #include <hpx/plugins/binary_filter/bzip2_serialization_filter_registration.hpp>
+#include <hpx/plugins/binary_filter/lz4_serialization_filter_registration.hpp>
 #include <hpx/plugins/binary_filter/snappy_serialization_filter_registration.hpp>
 #include <hpx/plugins/binary_filter/zlib_serialization_filter_registration.hpp>
+#include <hpx/plugins/binary_filter/zstd_serialization_filter_registration.hpp>
 
 #if defined(HPX_HAVE_DEPRECATION_WARNINGS)
 #if defined(HPX_MSVC)
@@ -58,9 +58,7 @@ namespace hpx { namespace lcos { namespace local {
                 unique_pointer p(traits::allocate(alloc, 1),
                     util::allocator_deleter<other_allocator>{alloc});
 
-                using lcos::detail::in_place;
-                traits::construct(
-                    alloc, p.get(), init_no_addref{}, in_place{}, alloc);
+                traits::construct(alloc, p.get(), init_no_addref{}, alloc);
                 shared_state_.reset(p.release(), false);
             }
 
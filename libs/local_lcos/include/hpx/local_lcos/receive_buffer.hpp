@@ -9,466 +9,464 @@
 #define HPX_LCOS_LOCAL_RECEIVE_BUFFER_MAY_08_2014_1102AM
 
 #include <hpx/config.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/assertion.hpp>
+#include <hpx/datastructures/optional.hpp>
 #include <hpx/errors.hpp>
 #include <hpx/lcos/future.hpp>
 #include <hpx/local_lcos/promise.hpp>
 #include <hpx/synchronization/no_mutex.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <exception>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 namespace hpx { namespace lcos { namespace local {
-    ///////////////////////////////////////////////////////////////////////////
-    template <typename T, typename Mutex = lcos::local::spinlock>
-    struct receive_buffer
-    {
-    protected:
-        typedef Mutex mutex_type;
-        typedef hpx::lcos::local::promise<T> buffer_promise_type;
-
-        struct entry_data
+    namespace detail {
+        // Default number of generations a receive_buffer can hold without
+        // falling back to its overflow map.
+        constexpr std::size_t receive_buffer_window_size = 16;
+
+        ///////////////////////////////////////////////////////////////////////
+        // The entries of a receive_buffer live in a ring of slots indexed by
+        // step % window_size. A slot is reused as soon as both the future
+        // was retrieved and the value was stored for its step. As long as
+        // the producer and the consumer stay within window_size steps of
+        // each other all operations touch only the (uncontended) lock of
+        // a single slot.
+        //
+        // A step which maps to a slot occupied by a different step is kept
+        // in an overflow map protected by the buffer wide lock instead. The
+        // slot stays marked as overflowing until the last of its map entries
+        // has been removed, which makes all operations on this slot take
+        // the buffer wide lock in the meantime. Locks are always acquired in
+        // the order buffer wide lock, slot lock.
+        template <typename T, typename Mutex>
+        class receive_buffer_base
         {
-        public:
-            HPX_NON_COPYABLE(entry_data);
+        protected:
+            typedef Mutex mutex_type;
+            typedef hpx::lcos::local::promise<T> buffer_promise_type;
 
-        public:
-            entry_data()
-              : can_be_deleted_(false)
-              , value_set_(false)
+            struct entry_data
             {
-            }
+                // All promises share the allocator of the futures used
+                // internally, this avoids going to the system allocator for
+                // every step.
+                void activate()
+                {
+                    promise_.emplace(
+                        std::allocator_arg, hpx::util::internal_allocator<>{});
+                }
 
-            hpx::future<T> get_future()
-            {
-                return promise_.get_future();
-            }
+                void reset()
+                {
+                    promise_.reset();
+                    future_ = hpx::future<T>();
+                    received_ = false;
+                    value_set_ = false;
+                }
 
-            template <typename Val>
-            void set_value(Val&& val)
-            {
-                value_set_ = true;
-                promise_.set_value(std::forward<Val>(val));
-            }
+                // retrieve the future, return whether the entry is done
+                bool receive(hpx::future<T>& f)
+                {
+                    if (value_set_)
+                    {
+                        f = std::move(future_);
+                        return true;
+                    }
+
+                    f = promise_->get_future();
+                    received_ = true;
+                    return false;
+                }
 
-            bool cancel(std::exception_ptr const& e)
-            {
-                HPX_ASSERT(can_be_deleted_);
-                if (!value_set_)
+                // extract the promise for the value to be stored, return
+                // whether the entry is done
+                bool store(hpx::util::optional<buffer_promise_type>& p)
                 {
-                    promise_.set_exception(e);
+                    if (value_set_)
+                    {
+                        HPX_THROW_EXCEPTION(promise_already_satisfied,
+                            "receive_buffer::store_received",
+                            "a value has already been stored for this step");
+                    }
+
+                    value_set_ = true;
+                    if (!received_)
+                    {
+                        // keep the future until it is retrieved
+                        future_ = promise_->get_future();
+                        p.emplace(std::move(*promise_));
+                        return false;
+                    }
+
+                    p.emplace(std::move(*promise_));
                     return true;
                 }
-                return false;
-            }
 
-            buffer_promise_type promise_;
-            bool can_be_deleted_;
-            bool value_set_;
-        };
+                // extract the promise if nobody will set it anymore, return
+                // whether the entry should be deleted
+                bool cancel(std::vector<buffer_promise_type>& canceled,
+                    bool force_delete_entries)
+                {
+                    HPX_ASSERT(received_ || value_set_);
+                    if (!value_set_)
+                    {
+                        canceled.push_back(std::move(*promise_));
+                        return true;
+                    }
+                    return force_delete_entries;
+                }
 
-        typedef std::map<std::size_t, std::shared_ptr<entry_data>>
-            buffer_map_type;
-        typedef typename buffer_map_type::iterator iterator;
+                hpx::util::optional<buffer_promise_type> promise_;
+                hpx::future<T> future_;
+                bool received_ = false;
+                bool value_set_ = false;
+            };
 
-        struct erase_on_exit
-        {
-            erase_on_exit(buffer_map_type& buffer_map, iterator it)
-              : buffer_map_(buffer_map)
-              , it_(it)
+            struct slot
+            {
+                mutable mutex_type mtx_;
+                std::size_t step_ = 0;
+                bool active_ = false;
+                bool overflow_ = false;
+                std::size_t overflow_count_ = 0;    // buffer wide lock
+                entry_data entry_;
+            };
+
+            typedef std::map<std::size_t, entry_data> overflow_map_type;
+            typedef typename overflow_map_type::iterator iterator;
+
+            static std::size_t round_window_size(std::size_t window_size)
             {
+                std::size_t result = 1;
+                while (result < window_size)
+                    result <<= 1;
+                return result;
             }
 
-            ~erase_on_exit()
+        public:
+            explicit receive_buffer_base(
+                std::size_t window_size = receive_buffer_window_size)
+              : mask_(round_window_size(window_size) - 1)
+              , slots_(new slot[mask_ + 1])
+              , size_(0)
             {
-                buffer_map_.erase(it_);
             }
 
-            buffer_map_type& buffer_map_;
-            iterator it_;
-        };
-
-    public:
-        receive_buffer() = default;
-
-        receive_buffer(receive_buffer&& other) noexcept
-          : mtx_()
-          , buffer_map_(std::move(other.buffer_map_))
-        {
-        }
-
-        ~receive_buffer()
-        {
-            HPX_ASSERT(buffer_map_.empty());
-        }
-
-        receive_buffer& operator=(receive_buffer&& other) noexcept
-        {
-            if (this != &other)
+            // A moved-from receive_buffer may only be destroyed or assigned
+            // to.
+            receive_buffer_base(receive_buffer_base&& other) noexcept
+              : mtx_()
+              , mask_(other.mask_)
+              , slots_(std::move(other.slots_))
+              , overflow_map_(std::move(other.overflow_map_))
+              , size_(other.size_.exchange(0, std::memory_order_relaxed))
             {
-                mtx_ = mutex_type();
-                buffer_map_ = std::move(other.buffer_map_);
             }
-            return *this;
-        }
 
-        hpx::future<T> receive(std::size_t step)
-        {
-            std::lock_guard<mutex_type> l(mtx_);
-
-            iterator it = get_buffer_entry(step);
-            HPX_ASSERT(it != buffer_map_.end());
-
-            // if the value was already set we delete the entry after
-            // retrieving the future
-            if (it->second->can_be_deleted_)
+            ~receive_buffer_base()
             {
-                erase_on_exit t(buffer_map_, it);
-                return it->second->get_future();
+                HPX_ASSERT(empty());
             }
 
-            // otherwise mark the entry as to be deleted once the value was set
-            it->second->can_be_deleted_ = true;
-            return it->second->get_future();
-        }
-
-        bool try_receive(std::size_t step, hpx::future<T>* f = nullptr)
-        {
-            std::lock_guard<mutex_type> l(mtx_);
-
-            iterator it = buffer_map_.find(step);
-            if (it == buffer_map_.end())
-                return false;
-
-            // if the value was already set we delete the entry after
-            // retrieving the future
-            if (it->second->can_be_deleted_)
+            receive_buffer_base& operator=(receive_buffer_base&& other) noexcept
             {
-                if (f != nullptr)
+                if (this != &other)
                 {
-                    erase_on_exit t(buffer_map_, it);
-                    *f = it->second->get_future();
+                    HPX_ASSERT(empty());
+                    mask_ = other.mask_;
+                    slots_ = std::move(other.slots_);
+                    overflow_map_ = std::move(other.overflow_map_);
+                    size_.store(
+                        other.size_.exchange(0, std::memory_order_relaxed),
+                        std::memory_order_relaxed);
                 }
-                return true;
+                return *this;
             }
 
-            // otherwise mark the entry as to be deleted once the value was set
-            if (f != nullptr)
+            hpx::future<T> receive(std::size_t step)
             {
-                it->second->can_be_deleted_ = true;
-                *f = it->second->get_future();
+                hpx::future<T> f;
+                apply(step, [&f](entry_data& entry) -> bool {
+                    return entry.receive(f);
+                });
+                return f;
             }
-            return true;
-        }
-
-        template <typename Lock = hpx::lcos::local::no_mutex>
-        void store_received(std::size_t step, T&& val, Lock* lock = nullptr)
-        {
-            std::shared_ptr<entry_data> entry;
 
+            bool try_receive(std::size_t step, hpx::future<T>* f = nullptr)
             {
-                std::lock_guard<mutex_type> l(mtx_);
-
-                iterator it = get_buffer_entry(step);
-                HPX_ASSERT(it != buffer_map_.end());
-
-                entry = it->second;
-
-                if (!entry->can_be_deleted_)
-                {
-                    // if the future was not retrieved yet mark the entry as
-                    // to be deleted after it was be retrieved
-                    entry->can_be_deleted_ = true;
-                }
-                else
+                slot& s = get_slot(step);
                 {
-                    // if the future was already retrieved we can delete the
-                    // entry now
-                    buffer_map_.erase(it);
+                    std::lock_guard<mutex_type> sl(s.mtx_);
+                    if (!s.overflow_)
+                        return try_receive(s, step, f);
                 }
-            }
-
-            if (lock)
-                lock->unlock();
-
-            // set value in promise, but only after the lock went out of scope
-            entry->set_value(std::move(val));
-        }
-
-        bool empty() const
-        {
-            return buffer_map_.empty();
-        }
 
-        // return the number of deleted buffer entries
-        std::size_t cancel_waiting(
-            std::exception_ptr const& e, bool force_delete_entries = false)
-        {
-            std::lock_guard<mutex_type> l(mtx_);
-
-            std::size_t count = 0;
-            iterator end = buffer_map_.end();
-            for (iterator it = buffer_map_.begin(); it != end; /**/)
-            {
-                iterator to_delete = it++;
-                if (to_delete->second->cancel(e) || force_delete_entries)
-                {
-                    buffer_map_.erase(to_delete);
-                    ++count;
-                }
-            }
-            return count;
-        }
+                std::lock_guard<mutex_type> l(mtx_);
 
-    protected:
-        iterator get_buffer_entry(std::size_t step)
-        {
-            iterator it = buffer_map_.find(step);
-            if (it == buffer_map_.end())
-            {
-                std::pair<iterator, bool> res = buffer_map_.insert(
-                    std::make_pair(step, std::make_shared<entry_data>()));
-                if (!res.second)
+                iterator it = overflow_map_.find(step);
+                if (it == overflow_map_.end())
                 {
-                    HPX_THROW_EXCEPTION(invalid_status,
-                        "base_receive_buffer::get_buffer_entry",
-                        "couldn't insert a new entry into the receive buffer");
+                    std::lock_guard<mutex_type> sl(s.mtx_);
+                    return try_receive(s, step, f);
                 }
-                return res.first;
-            }
-            return it;
-        }
-
-    private:
-        mutable mutex_type mtx_;
-        buffer_map_type buffer_map_;
-    };
-
-    ///////////////////////////////////////////////////////////////////////////
-    template <typename Mutex>
-    struct receive_buffer<void, Mutex>
-    {
-    protected:
-        typedef Mutex mutex_type;
-        typedef hpx::lcos::local::promise<void> buffer_promise_type;
-
-        struct entry_data
-        {
-        public:
-            HPX_NON_COPYABLE(entry_data);
 
-        public:
-            entry_data()
-              : can_be_deleted_(false)
-              , value_set_(false)
-            {
+                if (f != nullptr && it->second.receive(*f))
+                    erase_overflow(s, it);
+                return true;
             }
 
-            hpx::future<void> get_future()
+            bool empty() const
             {
-                return promise_.get_future();
+                return size_.load(std::memory_order_relaxed) == 0;
             }
 
-            void set_value()
+            // return the number of deleted buffer entries
+            std::size_t cancel_waiting(
+                std::exception_ptr const& e, bool force_delete_entries = false)
             {
-                value_set_ = true;
-                promise_.set_value();
-            }
+                std::vector<buffer_promise_type> canceled;
+                std::size_t count = 0;
 
-            bool cancel(std::exception_ptr const& e)
-            {
-                HPX_ASSERT(can_be_deleted_);
-                if (!value_set_)
                 {
-                    promise_.set_exception(e);
-                    return true;
+                    std::lock_guard<mutex_type> l(mtx_);
+
+                    iterator end = overflow_map_.end();
+                    for (iterator it = overflow_map_.begin(); it != end; /**/)
+                    {
+                        iterator to_delete = it++;
+                        if (to_delete->second.cancel(
+                                canceled, force_delete_entries))
+                        {
+                            erase_overflow(get_slot(to_delete->first),
+                                to_delete);
+                            ++count;
+                        }
+                    }
+
+                    for (std::size_t i = 0; i <= mask_; ++i)
+                    {
+                        slot& s = slots_[i];
+
+                        std::lock_guard<mutex_type> sl(s.mtx_);
+                        if (s.active_ &&
+                            s.entry_.cancel(canceled, force_delete_entries))
+                        {
+                            deactivate(s);
+                            ++count;
+                        }
+                    }
                 }
-                return false;
-            }
-
-            buffer_promise_type promise_;
-            bool can_be_deleted_;
-            bool value_set_;
-        };
 
-        typedef std::map<std::size_t, std::shared_ptr<entry_data>>
-            buffer_map_type;
-        typedef typename buffer_map_type::iterator iterator;
+                // notify waiting threads only after the locks were released
+                for (buffer_promise_type& p : canceled)
+                    p.set_exception(e);
 
-        struct erase_on_exit
-        {
-            erase_on_exit(buffer_map_type& buffer_map, iterator it)
-              : buffer_map_(buffer_map)
-              , it_(it)
-            {
+                return count;
             }
 
-            ~erase_on_exit()
+        protected:
+            // Extract the promise for the given step, the value has to be
+            // set after all locks have been released.
+            template <typename Lock>
+            buffer_promise_type get_promise(std::size_t step, Lock* lock)
             {
-                buffer_map_.erase(it_);
-            }
-
-            buffer_map_type& buffer_map_;
-            iterator it_;
-        };
+                hpx::util::optional<buffer_promise_type> p;
+                apply(step, [&p](entry_data& entry) -> bool {
+                    return entry.store(p);
+                });
 
-    public:
-        receive_buffer() {}
+                if (lock)
+                    lock->unlock();
 
-        receive_buffer(receive_buffer&& other)
-          : buffer_map_(std::move(other.buffer_map_))
-        {
-        }
-
-        ~receive_buffer()
-        {
-            HPX_ASSERT(buffer_map_.empty());
-        }
+                return std::move(*p);
+            }
 
-        receive_buffer& operator=(receive_buffer&& other)
-        {
-            if (this != &other)
+        private:
+            slot& get_slot(std::size_t step) const
             {
-                buffer_map_ = std::move(other.buffer_map_);
+                return slots_[step & mask_];
             }
-            return *this;
-        }
-
-        hpx::future<void> receive(std::size_t step)
-        {
-            std::lock_guard<mutex_type> l(mtx_);
 
-            iterator it = get_buffer_entry(step);
-            HPX_ASSERT(it != buffer_map_.end());
-
-            // if the value was already set we delete the entry after
-            // retrieving the future
-            if (it->second->can_be_deleted_)
+            void activate(slot& s, std::size_t step)
             {
-                erase_on_exit t(buffer_map_, it);
-                return it->second->get_future();
+                s.entry_.activate();
+                s.step_ = step;
+                s.active_ = true;
+                size_.fetch_add(1, std::memory_order_relaxed);
             }
 
-            // otherwise mark the entry as to be deleted once the value was set
-            it->second->can_be_deleted_ = true;
-            return it->second->get_future();
-        }
-
-        bool try_receive(std::size_t step, hpx::future<void>* f = nullptr)
-        {
-            std::lock_guard<mutex_type> l(mtx_);
-
-            iterator it = buffer_map_.find(step);
-            if (it == buffer_map_.end())
-                return false;
+            void deactivate(slot& s)
+            {
+                s.entry_.reset();
+                s.active_ = false;
+                size_.fetch_sub(1, std::memory_order_relaxed);
+            }
 
-            // if the value was already set we delete the entry after
-            // retrieving the future
-            if (it->second->can_be_deleted_)
+            // requires mtx_ to be locked
+            void erase_overflow(slot& s, iterator it)
             {
-                if (f != nullptr)
+                overflow_map_.erase(it);
+                size_.fetch_sub(1, std::memory_order_relaxed);
+
+                if (--s.overflow_count_ == 0)
                 {
-                    erase_on_exit t(buffer_map_, it);
-                    *f = it->second->get_future();
+                    std::lock_guard<mutex_type> sl(s.mtx_);
+                    s.overflow_ = false;
                 }
-                return true;
             }
 
-            // otherwise mark the entry as to be deleted once the value was set
-            if (f != nullptr)
+            // requires the lock of the given slot to be held
+            bool try_receive(slot& s, std::size_t step, hpx::future<T>* f)
             {
-                it->second->can_be_deleted_ = true;
-                *f = it->second->get_future();
-            }
-            return true;
-        }
+                if (!s.active_ || s.step_ != step)
+                    return false;
 
-        template <typename Lock = hpx::lcos::local::no_mutex>
-        void store_received(std::size_t step, Lock* lock = nullptr)
-        {
-            std::shared_ptr<entry_data> entry;
+                if (f != nullptr && s.entry_.receive(*f))
+                    deactivate(s);
+                return true;
+            }
 
+            // Invoke f on the entry for the given step, creating it if
+            // needed. The entry is released if f returns true.
+            template <typename F>
+            void apply(std::size_t step, F&& f)
             {
-                std::lock_guard<mutex_type> l(mtx_);
-
-                iterator it = get_buffer_entry(step);
-                HPX_ASSERT(it != buffer_map_.end());
-
-                entry = it->second;
+                slot& s = get_slot(step);
 
-                if (!entry->can_be_deleted_)
+                // fast path, the step is (or can be) held in its slot
                 {
-                    // if the future was not retrieved yet mark the entry as
-                    // to be deleted after it was be retrieved
-                    entry->can_be_deleted_ = true;
+                    std::lock_guard<mutex_type> sl(s.mtx_);
+                    if (!s.overflow_)
+                    {
+                        if (!s.active_)
+                            activate(s, step);
+
+                        if (s.step_ == step)
+                        {
+                            if (f(s.entry_))
+                                deactivate(s);
+                            return;
+                        }
+
+                        // the slot is held by a different step, divert all
+                        // requests for this slot to the overflow map
+                        s.overflow_ = true;
+                    }
                 }
-                else
+
+                std::lock_guard<mutex_type> l(mtx_);
+
+                iterator it = overflow_map_.find(step);
+                if (it == overflow_map_.end())
                 {
-                    // if the future was already retrieved we can delete the
-                    // entry now
-                    buffer_map_.erase(it);
+                    std::lock_guard<mutex_type> sl(s.mtx_);
+
+                    if (!s.active_)
+                        activate(s, step);
+
+                    if (s.step_ == step)
+                    {
+                        if (f(s.entry_))
+                            deactivate(s);
+
+                        if (s.overflow_count_ == 0)
+                            s.overflow_ = false;
+                        return;
+                    }
+
+                    s.overflow_ = true;
+
+                    std::pair<iterator, bool> res =
+                        overflow_map_.emplace(std::piecewise_construct,
+                            std::forward_as_tuple(step),
+                            std::forward_as_tuple());
+                    if (!res.second)
+                    {
+                        HPX_THROW_EXCEPTION(invalid_status,
+                            "receive_buffer::apply",
+                            "couldn't insert a new entry into the receive "
+                            "buffer");
+                    }
+
+                    it = res.first;
+                    it->second.activate();
+                    ++s.overflow_count_;
+                    size_.fetch_add(1, std::memory_order_relaxed);
                 }
+
+                if (f(it->second))
+                    erase_overflow(s, it);
             }
 
-            if (lock)
-                lock->unlock();
+        private:
+            mutable mutex_type mtx_;
+            std::size_t mask_;
+            std::unique_ptr<slot[]> slots_;
+            overflow_map_type overflow_map_;
+            std::atomic<std::size_t> size_;
+        };
+    }    // namespace detail
 
-            // set value in promise, but only after the lock went out of scope
-            entry->set_value();
-        }
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Mutex = lcos::local::spinlock>
+    struct receive_buffer : detail::receive_buffer_base<T, Mutex>
+    {
+    private:
+        typedef detail::receive_buffer_base<T, Mutex> base_type;
 
-        bool empty() const
+    public:
+        receive_buffer() = default;
+
+        explicit receive_buffer(std::size_t window_size)
+          : base_type(window_size)
         {
-            return buffer_map_.empty();
         }
 
-        // return the number of deleted buffer entries
-        std::size_t cancel_waiting(
-            std::exception_ptr const& e, bool force_delete_entries = false)
-        {
-            std::lock_guard<mutex_type> l(mtx_);
+        receive_buffer(receive_buffer&& other) = default;
+        receive_buffer& operator=(receive_buffer&& other) = default;
 
-            std::size_t count = 0;
-            iterator end = buffer_map_.end();
-            for (iterator it = buffer_map_.begin(); it != end; /**/)
-            {
-                iterator to_delete = it++;
-                if (to_delete->second->cancel(e) || force_delete_entries)
-                {
-                    buffer_map_.erase(to_delete);
-                    ++count;
-                }
-            }
-            return count;
+        template <typename Lock = hpx::lcos::local::no_mutex>
+        void store_received(std::size_t step, T&& val, Lock* lock = nullptr)
+        {
+            // set value in promise, but only after the lock went out of scope
+            this->get_promise(step, lock).set_value(std::move(val));
         }
+    };
 
-    protected:
-        iterator get_buffer_entry(std::size_t step)
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Mutex>
+    struct receive_buffer<void, Mutex> : detail::receive_buffer_base<void, Mutex>
+    {
+    private:
+        typedef detail::receive_buffer_base<void, Mutex> base_type;
+
+    public:
+        receive_buffer() = default;
+
+        explicit receive_buffer(std::size_t window_size)
+          : base_type(window_size)
         {
-            iterator it = buffer_map_.find(step);
-            if (it == buffer_map_.end())
-            {
-                std::pair<iterator, bool> res = buffer_map_.insert(
-                    std::make_pair(step, std::make_shared<entry_data>()));
-                if (!res.second)
-                {
-                    HPX_THROW_EXCEPTION(invalid_status,
-                        "base_receive_buffer::get_buffer_entry",
-                        "couldn't insert a new entry into the receive buffer");
-                }
-                return res.first;
-            }
-            return it;
         }
 
-    private:
-        mutable mutex_type mtx_;
-        buffer_map_type buffer_map_;
+        receive_buffer(receive_buffer&& other) = default;
+        receive_buffer& operator=(receive_buffer&& other) = default;
+
+        template <typename Lock = hpx::lcos::local::no_mutex>
+        void store_received(std::size_t step, Lock* lock = nullptr)
+        {
+            // set value in promise, but only after the lock went out of scope
+            this->get_promise(step, lock).set_value();
+        }
     };
 }}}    // namespace hpx::lcos::local
 
@@ -202,6 +202,30 @@ void channel_range_void()
     HPX_TEST_EQ(received_elements.load(), 3);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// store many more generations than the receive buffer holds in its ring
+void channel_generations()
+{
+    hpx::lcos::local::channel<int> c;
+
+    for (int i = 1; i <= 100; ++i)
+        c.set(i);
+
+    for (int i = 1; i <= 100; ++i)
+        HPX_TEST_EQ(c.get(hpx::launch::sync), i);
+
+    // retrieve futures for generations far ahead of the stored ones
+    std::vector<hpx::future<int>> futures;
+    for (int i = 1; i <= 100; ++i)
+        futures.push_back(c.get(std::size_t(100 + 101 - i)));
+
+    for (int i = 1; i <= 100; ++i)
+        c.set(i, std::size_t(100 + i));
+
+    for (int i = 1; i <= 100; ++i)
+        HPX_TEST_EQ(futures[i - 1].get(), 101 - i);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 void deadlock_test()
 {
@@ -346,6 +370,7 @@ int main(int argc, char* argv[])
     dispatch_work();
     channel_range();
     channel_range_void();
+    channel_generations();
 
     deadlock_test();
     closed_channel_get();
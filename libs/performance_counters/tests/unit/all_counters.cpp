@@ -31,6 +31,9 @@ char const* const locality_pool_thread_counter_names[] =
 #endif
 #endif
     "/threads/time/overall",
+#ifdef HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF
+    "/threads/time/idle-parked",
+#endif
     "/threads/count/instantaneous/all",
     "/threads/count/instantaneous/active",
     "/threads/count/instantaneous/pending",
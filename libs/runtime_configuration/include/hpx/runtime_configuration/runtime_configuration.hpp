@@ -79,6 +79,10 @@ namespace hpx { namespace util {
         std::size_t get_agas_local_cache_size(
             std::size_t dflt = HPX_AGAS_LOCAL_CACHE_SIZE) const;
 
+        // Get the number of shards of the AGAS client-side local cache
+        std::size_t get_agas_local_cache_shards(
+            std::size_t dflt = HPX_AGAS_LOCAL_CACHE_SHARDS) const;
+
         bool get_agas_caching_mode() const;
 
         bool get_agas_range_caching_mode() const;
@@ -107,6 +111,11 @@ namespace hpx { namespace util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
         bool use_stack_guard_pages() const;
+
+        // Returns the maximum number of stacks cached per OS thread and the
+        // number of resident bytes above which cached stacks are released
+        std::size_t get_stack_cache_size() const;
+        std::size_t get_stack_cache_high_watermark() const;
 #endif
 
         // Returns the number of OS threads this locality is running.
@@ -184,6 +184,10 @@ namespace hpx { namespace util {
             "[hpx.lcos.collectives]",
             "arity = ${HPX_LCOS_COLLECTIVES_ARITY:32}",
             "cut_off = ${HPX_LCOS_COLLECTIVES_CUT_OFF:-1}",
+            "all_reduce_algorithm = "
+            "${HPX_LCOS_COLLECTIVES_ALL_REDUCE_ALGORITHM:auto}",
+            "all_reduce_ring_threshold = "
+            "${HPX_LCOS_COLLECTIVES_ALL_REDUCE_RING_THRESHOLD:65536}",
 
             // connect back to the given latch if specified
             "[hpx.on_startup]",
@@ -207,6 +211,8 @@ namespace hpx { namespace util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+            "cache_size = ${HPX_STACK_CACHE_SIZE:64}",
+            "cache_high_watermark = ${HPX_STACK_CACHE_HIGH_WATERMARK:8388608}",
 #endif
 
             "[hpx.threadpools]",
@@ -247,6 +253,9 @@ namespace hpx { namespace util {
             "max_terminated_threads = "
             "${HPX_THREAD_QUEUE_MAX_TERMINATED_THREADS:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_THREAD_QUEUE_MAX_TERMINATED_THREADS)) "}",
+            "max_thread_heap_size = "
+            "${HPX_THREAD_QUEUE_MAX_THREAD_HEAP_SIZE:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_MAX_THREAD_HEAP_SIZE)) "}",
 
             "[hpx.commandline]",
             // enable aliasing
@@ -297,6 +306,8 @@ namespace hpx { namespace util {
             "service_mode = hosted",
             "local_cache_size = ${HPX_AGAS_LOCAL_CACHE_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SIZE)) "}",
+            "local_cache_shards = ${HPX_AGAS_LOCAL_CACHE_SHARDS:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SHARDS)) "}",
             "use_range_caching = ${HPX_AGAS_USE_RANGE_CACHING:1}",
             "use_caching = ${HPX_AGAS_USE_CACHING:1}",
 
@@ -898,6 +909,26 @@ namespace hpx { namespace util {
         return cache_size;
     }
 
+    std::size_t runtime_configuration::get_agas_local_cache_shards(
+        std::size_t dflt) const
+    {
+        std::size_t num_shards = dflt;
+
+        if (has_section("hpx.agas"))
+        {
+            util::section const* sec = get_section("hpx.agas");
+            if (nullptr != sec)
+            {
+                num_shards = hpx::util::get_entry_as<std::size_t>(
+                    *sec, "local_cache_shards", num_shards);
+            }
+        }
+
+        if (num_shards == 0)
+            num_shards = 1;    // limit lower bound
+        return num_shards;
+    }
+
     bool runtime_configuration::get_agas_caching_mode() const
     {
         if (has_section("hpx.agas"))
@@ -1174,6 +1205,34 @@ namespace hpx { namespace util {
         }
         return true;    // default is true
     }
+
+    std::size_t runtime_configuration::get_stack_cache_size() const
+    {
+        if (has_section("hpx"))
+        {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    *sec, "cache_size", 64);
+            }
+        }
+        return 64;
+    }
+
+    std::size_t runtime_configuration::get_stack_cache_high_watermark() const
+    {
+        if (has_section("hpx"))
+        {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    *sec, "cache_high_watermark", 8388608);
+            }
+        }
+        return 8388608;
+    }
 #endif
 
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
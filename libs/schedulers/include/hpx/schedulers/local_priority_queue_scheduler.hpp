@@ -625,6 +625,8 @@ namespace hpx { namespace threads { namespace policies {
                     {
                         queues_[idx].data_->increment_num_stolen_from_pending();
                         this_queue->increment_num_stolen_to_pending();
+                        steal_half_pending(this_queue, queues_[idx].data_,
+                            steals_half<PendingQueuing>());
                         return true;
                     }
                 }
@@ -633,6 +635,26 @@ namespace hpx { namespace threads { namespace policies {
             return low_priority_queue_.get_next_thread(thrd);
         }
 
+        // Work-stealing deques let the thief take half of the remaining
+        // pending work of the victim at once.
+        void steal_half_pending(thread_queue_type* thief,
+            thread_queue_type* victim, std::true_type)
+        {
+            std::int64_t count =
+                victim->get_pending_queue_length(std::memory_order_relaxed) / 2;
+            if (count > 0)
+            {
+                std::int64_t moved = thief->move_work_items_from(victim, count);
+                victim->increment_num_stolen_from_pending(std::size_t(moved));
+                thief->increment_num_stolen_to_pending(std::size_t(moved));
+            }
+        }
+
+        void steal_half_pending(
+            thread_queue_type*, thread_queue_type*, std::false_type)
+        {
+        }
+
         /// Schedule the passed thread
         void schedule_thread(threads::thread_data* thrd,
             threads::thread_schedule_hint schedulehint,
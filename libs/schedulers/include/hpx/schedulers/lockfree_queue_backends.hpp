@@ -19,10 +19,14 @@
 #endif
 
 // Does not rely on CXX11_STD_ATOMIC_128BIT
+#include <hpx/concurrency/chase_lev_deque.hpp>
 #include <hpx/concurrency/concurrentqueue.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <thread>
+#include <type_traits>
 #include <utility>
 
 namespace hpx { namespace threads { namespace policies {
@@ -139,6 +143,128 @@ namespace hpx { namespace threads { namespace policies {
         };
     };
 
+    ////////////////////////////////////////////////////////////////////////////
+    // Chase-Lev work-stealing deque: the owning worker thread pushes and pops
+    // at the bottom end (LIFO) without any atomic read-modify-write
+    // operations, all other threads steal from the top end (FIFO).
+    //
+    // Items pushed by threads other than the owner (or pushed to the other
+    // end) are placed into a separate injection queue which is drained after
+    // the deque has run empty. Before an owner has been bound to the queue
+    // (see bind_queue_owner below) all threads are treated as thieves.
+    struct lockfree_chase_lev;
+
+    template <typename T>
+    struct lockfree_chase_lev_backend
+    {
+        using container_type = util::chase_lev_deque<T>;
+        using injection_queue_type = moodycamel::ConcurrentQueue<T>;
+
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using size_type = std::uint64_t;
+
+        lockfree_chase_lev_backend(
+            size_type initial_size = 0, size_type num_thread = size_type(-1))
+          : deque_(std::size_t(initial_size))
+          , injected_(std::size_t(initial_size))
+          , owner_()
+        {
+        }
+
+        bool push(const_reference val, bool other_end = false)
+        {
+            if (!other_end && is_owner())
+            {
+                deque_.push(val);
+                return true;
+            }
+            return injected_.enqueue(val);
+        }
+
+        bool pop(reference val, bool /*steal*/ = true)
+        {
+            if (is_owner() ? deque_.pop(val) : deque_.steal(val))
+                return true;
+            return injected_.try_dequeue(val);
+        }
+
+        bool empty()
+        {
+            return deque_.empty() && injected_.size_approx() == 0;
+        }
+
+        // make the calling thread the owner of the bottom end of the deque
+        void bind_owner()
+        {
+            owner_.store(std::this_thread::get_id(), std::memory_order_release);
+        }
+
+        void unbind_owner()
+        {
+            owner_.store(std::thread::id(), std::memory_order_release);
+        }
+
+    private:
+        bool is_owner() const
+        {
+            return owner_.load(std::memory_order_acquire) ==
+                std::this_thread::get_id();
+        }
+
+        container_type deque_;
+        injection_queue_type injected_;
+        std::atomic<std::thread::id> owner_;
+    };
+
+    struct lockfree_chase_lev
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = lockfree_chase_lev_backend<T>;
+        };
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Queue backends which distinguish the owning worker thread from other
+    // threads are notified whenever a worker thread starts or stops using a
+    // queue. This is a no-op for all other backends.
+    template <typename Queue>
+    void bind_queue_owner(Queue&)
+    {
+    }
+
+    template <typename Queue>
+    void unbind_queue_owner(Queue&)
+    {
+    }
+
+    template <typename T>
+    void bind_queue_owner(lockfree_chase_lev_backend<T>& queue)
+    {
+        queue.bind_owner();
+    }
+
+    template <typename T>
+    void unbind_queue_owner(lockfree_chase_lev_backend<T>& queue)
+    {
+        queue.unbind_owner();
+    }
+
+    // Thieves stealing from a work-stealing deque take half of the victim's
+    // pending work at once.
+    template <typename Queuing>
+    struct steals_half : std::false_type
+    {
+    };
+
+    template <>
+    struct steals_half<lockfree_chase_lev> : std::true_type
+    {
+    };
+
 // LIFO
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
             struct lockfree_lifo;
@@ -122,6 +122,9 @@ namespace hpx { namespace threads { namespace policies {
         // number of terminated threads to collect before cleaning them up
         int const max_terminated_threads_;
 
+        // number of thread objects to keep for reuse per stack size
+        std::int64_t const max_thread_heap_size_;
+
         // these ought to be atomic, but if we get a race and assign a thread
         // to queue N instead of N+1 it doesn't really matter
 
@@ -217,6 +220,7 @@ namespace hpx { namespace threads { namespace policies {
           , max_delete_count_(static_cast<int>(init.max_delete_count_))
           , max_terminated_threads_(
                 static_cast<int>(init.max_terminated_threads_))
+          , max_thread_heap_size_(init.max_thread_heap_size_)
           , terminated_items_(max_thread_count)
         {
             rollover_counters_.data_ =
@@ -290,6 +294,32 @@ namespace hpx { namespace threads { namespace policies {
             return lp_queue_ && ((owner_mask_ & 8) != 0);
         }
 
+        // ----------------------------------------------------------------
+        // the queues owned by this holder are bound to the worker thread
+        void on_start_thread(std::size_t num_thread)
+        {
+            if (owns_bp_queue())
+                bp_queue_->on_start_thread(num_thread);
+            if (owns_hp_queue())
+                hp_queue_->on_start_thread(num_thread);
+            if (owns_np_queue())
+                np_queue_->on_start_thread(num_thread);
+            if (owns_lp_queue())
+                lp_queue_->on_start_thread(num_thread);
+        }
+
+        void on_stop_thread(std::size_t num_thread)
+        {
+            if (owns_bp_queue())
+                bp_queue_->on_stop_thread(num_thread);
+            if (owns_hp_queue())
+                hp_queue_->on_stop_thread(num_thread);
+            if (owns_np_queue())
+                np_queue_->on_stop_thread(num_thread);
+            if (owns_lp_queue())
+                lp_queue_->on_stop_thread(num_thread);
+        }
+
         // ------------------------------------------------------------
         // return the next round robin thread index across all workers
         // using a batching of N per worker before incrementing
@@ -545,30 +575,44 @@ namespace hpx { namespace threads { namespace policies {
             std::ptrdiff_t stacksize =
                 get_thread_id_data(tid)->get_stack_size();
 
+            thread_heap_type* heap = nullptr;
+
             if (stacksize == get_stack_size(thread_stacksize_small))
             {
-                thread_heap_small_.push_front(tid);
+                heap = &thread_heap_small_;
             }
             else if (stacksize == get_stack_size(thread_stacksize_medium))
             {
-                thread_heap_medium_.push_front(tid);
+                heap = &thread_heap_medium_;
             }
             else if (stacksize == get_stack_size(thread_stacksize_large))
             {
-                thread_heap_large_.push_front(tid);
+                heap = &thread_heap_large_;
             }
             else if (stacksize == get_stack_size(thread_stacksize_huge))
             {
-                thread_heap_huge_.push_front(tid);
+                heap = &thread_heap_huge_;
             }
             else if (stacksize == get_stack_size(thread_stacksize_nostack))
             {
-                thread_heap_nostack_.push_front(tid);
+                heap = &thread_heap_nostack_;
             }
             else
             {
                 HPX_ASSERT_MSG(
                     false, util::format("Invalid stack size {1}", stacksize));
+                return;
+            }
+
+            // keep a bounded number of thread objects, the stacks of all
+            // others are handed to the stack cache of this worker thread
+            if (static_cast<std::int64_t>(heap->size()) < max_thread_heap_size_)
+            {
+                heap->push_front(tid);
+            }
+            else
+            {
+                deallocate(get_thread_id_data(tid));
             }
         }
 
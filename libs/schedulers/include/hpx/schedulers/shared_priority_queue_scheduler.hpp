@@ -1218,6 +1218,8 @@ namespace hpx { namespace threads { namespace policies {
 
                             numa_holder_[domain].queues_[numa_id] =
                                 thread_holder;
+
+                            thread_holder->on_start_thread(local_thread);
                         }
 
 #ifdef SHARED_PRIORITY_SCHEDULER_LINUX
@@ -1272,7 +1274,12 @@ namespace hpx { namespace threads { namespace policies {
                             "Invalid thread number: " +
                                 std::to_string(thread_num));
                     }
-                    // @TODO Do we need to do any queue related cleanup here?
+
+                    std::size_t domain_num = d_lookup_[thread_num];
+                    std::size_t q_index = q_lookup_[thread_num];
+                    numa_holder_[domain_num]
+                        .thread_queue(static_cast<std::size_t>(q_index))
+                        ->on_stop_thread(thread_num);
                 }
 
                 void on_error(std::size_t thread_num,
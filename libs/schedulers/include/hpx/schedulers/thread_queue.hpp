@@ -322,30 +322,45 @@ namespace hpx { namespace threads { namespace policies {
             std::ptrdiff_t stacksize =
                 get_thread_id_data(thrd)->get_stack_size();
 
+            thread_heap_type* heap = nullptr;
+
             if (stacksize == parameters_.small_stacksize_)
             {
-                thread_heap_small_.push_front(thrd);
+                heap = &thread_heap_small_;
             }
             else if (stacksize == parameters_.medium_stacksize_)
             {
-                thread_heap_medium_.push_front(thrd);
+                heap = &thread_heap_medium_;
             }
             else if (stacksize == parameters_.large_stacksize_)
             {
-                thread_heap_large_.push_front(thrd);
+                heap = &thread_heap_large_;
             }
             else if (stacksize == parameters_.huge_stacksize_)
             {
-                thread_heap_huge_.push_front(thrd);
+                heap = &thread_heap_huge_;
             }
             else if (stacksize == parameters_.nostack_stacksize_)
             {
-                thread_heap_nostack_.push_front(thrd);
+                heap = &thread_heap_nostack_;
             }
             else
             {
                 HPX_ASSERT_MSG(
                     false, util::format("Invalid stack size {1}", stacksize));
+                return;
+            }
+
+            // keep a bounded number of thread objects, the stacks of all
+            // others are handed to the stack cache of this worker thread
+            if (static_cast<std::int64_t>(heap->size()) <
+                parameters_.max_thread_heap_size_)
+            {
+                heap->push_front(thrd);
+            }
+            else
+            {
+                deallocate(get_thread_id_data(thrd));
             }
         }
 
@@ -703,10 +718,13 @@ namespace hpx { namespace threads { namespace policies {
                 ec = make_success_code();
         }
 
-        void move_work_items_from(thread_queue* src, std::int64_t count)
+        // move at most count pending work items from the given queue,
+        // returns the number of moved items
+        std::int64_t move_work_items_from(thread_queue* src, std::int64_t count)
         {
+            std::int64_t moved = 0;
             thread_description* trd;
-            while (src->work_items_.pop(trd))
+            while (moved != count && src->work_items_.pop(trd))
             {
                 --src->work_items_count_.data_;
 
@@ -720,11 +738,11 @@ namespace hpx { namespace threads { namespace policies {
                 }
 #endif
 
-                bool finished = count == ++work_items_count_.data_;
+                ++work_items_count_.data_;
                 work_items_.push(trd);
-                if (finished)
-                    break;
+                ++moved;
             }
+            return moved;
         }
 
         void move_task_items_from(thread_queue* src, std::int64_t count)
@@ -1039,8 +1057,14 @@ namespace hpx { namespace threads { namespace policies {
         }
 
         ///////////////////////////////////////////////////////////////////////
-        void on_start_thread(std::size_t num_thread) {}
-        void on_stop_thread(std::size_t num_thread) {}
+        void on_start_thread(std::size_t num_thread)
+        {
+            bind_queue_owner(work_items_);
+        }
+        void on_stop_thread(std::size_t num_thread)
+        {
+            unbind_queue_owner(work_items_);
+        }
         void on_error(std::size_t num_thread, std::exception_ptr const& e) {}
 
     private:
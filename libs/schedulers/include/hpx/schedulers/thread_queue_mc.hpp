@@ -282,8 +282,14 @@ namespace hpx { namespace threads { namespace policies {
         }
 
         ///////////////////////////////////////////////////////////////////////
-        void on_start_thread(std::size_t num_thread) {}
-        void on_stop_thread(std::size_t num_thread) {}
+        void on_start_thread(std::size_t num_thread)
+        {
+            bind_queue_owner(work_items_);
+        }
+        void on_stop_thread(std::size_t num_thread)
+        {
+            unbind_queue_owner(work_items_);
+        }
         void on_error(std::size_t num_thread, std::exception_ptr const& e) {}
 
         // pops all tasks off the queue, prints info and pushes them back on
@@ -10,8 +10,13 @@
 #include <hpx/config.hpp>
 #include <hpx/assertion.hpp>
 #include <hpx/lcos/dataflow.hpp>
+#include <hpx/runtime/get_colocation_id.hpp>
+#include <hpx/runtime/launch_policy.hpp>
+#include <hpx/runtime/naming/id_type.hpp>
 #include <hpx/traits/segmented_iterator_traits.hpp>
+#include <hpx/type_support/unused.hpp>
 
+#include <hpx/execution/exception_list.hpp>
 #include <hpx/execution/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
@@ -33,13 +38,101 @@ namespace hpx { namespace parallel { inline namespace v1 {
         ///////////////////////////////////////////////////////////////////////
         /// \cond NOINTERNAL
 
-        // sequential remote implementation
-        template <typename Algo, typename ExPolicy, typename SegIter,
-            typename SegOutIter>
-        static typename util::detail::algorithm_result<ExPolicy,
-            std::pair<SegIter, SegOutIter>>::type
-        segmented_transfer(Algo&& algo, ExPolicy const& policy, std::true_type,
-            SegIter first, SegIter last, SegOutIter dest)
+        // Wraps a local iterator referring to a partition of the destination
+        // sequence which is not colocated with the source partition. This
+        // prevents it from being turned into a local raw iterator before it
+        // reaches the locality of the destination partition.
+        template <typename LocalIter>
+        struct remote_destination
+        {
+            id_type id_;
+            LocalIter it_;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                // clang-format off
+                ar & id_ & it_;
+                // clang-format on
+            }
+        };
+
+        // Stores the received values into the destination partition.
+        struct transfer_receive : public algorithm<transfer_receive>
+        {
+            transfer_receive()
+              : transfer_receive::algorithm("transfer_receive")
+            {
+            }
+
+            template <typename ExPolicy, typename T, typename OutIter>
+            static hpx::util::unused_type sequential(
+                ExPolicy, std::vector<T> values, OutIter dest)
+            {
+                std::move(values.begin(), values.end(), dest);
+                return hpx::util::unused;
+            }
+
+            template <typename ExPolicy, typename T, typename OutIter>
+            static typename util::detail::algorithm_result<ExPolicy>::type
+            parallel(ExPolicy&& policy, std::vector<T> values, OutIter dest)
+            {
+                sequential(policy, std::move(values), dest);
+                return util::detail::algorithm_result<ExPolicy>::get();
+            }
+        };
+
+        // Applies the transfer algorithm to a range of the source partition
+        // it is executed on and sends the results to the locality of the
+        // destination partition.
+        template <typename Algo>
+        struct transfer_forward : public algorithm<transfer_forward<Algo>>
+        {
+            transfer_forward()
+              : transfer_forward::algorithm("transfer_forward")
+            {
+            }
+
+            template <typename ExPolicy, typename InIter, typename OutIter,
+                typename... Args>
+            static hpx::util::unused_type sequential(ExPolicy, InIter first,
+                InIter last, remote_destination<OutIter> const& dest,
+                Args&&... args)
+            {
+                // buffer the results as the elements of the destination, they
+                // may differ from the source elements (e.g. for transform)
+                typedef typename std::iterator_traits<OutIter>::value_type
+                    value_type;
+
+                std::vector<value_type> values;
+                values.reserve(std::distance(first, last));
+                Algo::sequential(execution::seq, first, last,
+                    std::back_inserter(values), std::forward<Args>(args)...);
+
+                dispatch(dest.id_, transfer_receive(), execution::seq,
+                    std::true_type(), std::move(values), dest.it_);
+                return hpx::util::unused;
+            }
+
+            template <typename ExPolicy, typename InIter, typename OutIter,
+                typename... Args>
+            static typename util::detail::algorithm_result<ExPolicy>::type
+            parallel(ExPolicy&& policy, InIter first, InIter last,
+                remote_destination<OutIter> const& dest, Args&&... args)
+            {
+                sequential(
+                    policy, first, last, dest, std::forward<Args>(args)...);
+                return util::detail::algorithm_result<ExPolicy>::get();
+            }
+        };
+
+        // Invoke the given function for each part of the range [first, last)
+        // which is stored in a single partition of the source sequence and
+        // maps onto a single partition of the destination sequence. Returns
+        // the end of the destination range.
+        template <typename SegIter, typename SegOutIter, typename F>
+        SegOutIter for_each_transfer_segment(
+            SegIter first, SegIter last, SegOutIter dest, F&& f)
         {
             typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
             typedef typename traits::segment_iterator segment_iterator;
@@ -52,71 +145,134 @@ namespace hpx { namespace parallel { inline namespace v1 {
             typedef typename output_traits::local_iterator
                 local_output_iterator_type;
 
-            typedef std::pair<local_iterator_type, local_output_iterator_type>
-                local_iterator_pair;
-
             segment_iterator sit = traits::segment(first);
             segment_iterator send = traits::segment(last);
 
-            segment_output_iterator sdest = traits::segment(dest);
+            segment_output_iterator sdest = output_traits::segment(dest);
+            local_output_iterator_type out = output_traits::local(dest);
+            local_output_iterator_type out_end = output_traits::end(sdest);
 
-            if (sit == send)
+            local_iterator_type beg = traits::local(first);
+            while (true)
             {
-                // all elements are on the same partition
-                local_iterator_type beg = traits::local(first);
-                local_iterator_type end = traits::local(last);
+                local_iterator_type end =
+                    sit == send ? traits::local(last) : traits::end(sit);
 
-                if (beg != end)
+                while (beg != end)
                 {
-                    local_iterator_pair p =
-                        dispatch(traits::get_id(sit), algo, policy,
-                            std::true_type(), beg, end, traits::local(dest));
+                    // the partitions of the destination may be smaller
+                    while (out == out_end)
+                    {
+                        ++sdest;
+                        out = output_traits::begin(sdest);
+                        out_end = output_traits::end(sdest);
+                    }
+
+                    auto count = (std::min)(std::distance(beg, end),
+                        std::distance(out, out_end));
+
+                    local_iterator_type next = beg;
+                    std::advance(next, count);
 
-                    dest = output_traits::compose(sdest, p.second);
+                    f(sit, beg, next, sdest, out);
+
+                    beg = next;
+                    std::advance(out, count);
                 }
+
+                if (sit == send)
+                    break;
+
+                beg = traits::begin(++sit);
             }
-            else
+
+            return output_traits::compose(sdest, out);
+        }
+
+        // Run the algorithm on the locality of the source partition. If the
+        // destination partition lives elsewhere, the transferred values are
+        // sent directly from there to the destination.
+        template <typename Algo, typename ExPolicy, typename IsSeq,
+            typename SegIter, typename SegOutIter, typename... Args>
+        future<void> transfer_segment_async(Algo const& algo,
+            ExPolicy const& policy, IsSeq is_seq,
+            typename hpx::traits::segmented_iterator_traits<
+                SegIter>::segment_iterator sit,
+            typename hpx::traits::segmented_iterator_traits<
+                SegIter>::local_iterator beg,
+            typename hpx::traits::segmented_iterator_traits<
+                SegIter>::local_iterator end,
+            typename hpx::traits::segmented_iterator_traits<
+                SegOutIter>::segment_iterator sdest,
+            typename hpx::traits::segmented_iterator_traits<
+                SegOutIter>::local_iterator out,
+            Args const&... args)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef hpx::traits::segmented_iterator_traits<SegOutIter>
+                output_traits;
+            typedef typename output_traits::local_iterator
+                local_output_iterator_type;
+
+            id_type source = traits::get_id(sit);
+            id_type target = output_traits::get_id(sdest);
+
+            if (get_colocation_id(launch::sync, source) ==
+                get_colocation_id(launch::sync, target))
             {
-                // handle the remaining part of the first partition
-                local_iterator_type beg = traits::local(first);
-                local_iterator_type end = traits::end(sit);
-                local_output_iterator_type out = traits::local(dest);
+                return dispatch_async(
+                    source, algo, policy, is_seq, beg, end, out, args...);
+            }
 
-                if (beg != end)
-                {
-                    local_iterator_pair p = dispatch(traits::get_id(sit), algo,
-                        policy, std::true_type(), beg, end, out);
-                    out = p.second;
-                }
+            return dispatch_async(source, transfer_forward<Algo>(), policy,
+                is_seq, beg, end,
+                remote_destination<local_output_iterator_type>{
+                    std::move(target), out},
+                args...);
+        }
 
-                // handle all of the full partitions
-                for ((void) ++sit, ++sdest; sit != send; (void) ++sit, ++sdest)
-                {
-                    beg = traits::begin(sit);
-                    end = traits::end(sit);
-                    out = traits::begin(sdest);
+        // sequential remote implementation
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename SegOutIter, typename... Args>
+        static typename util::detail::algorithm_result<ExPolicy,
+            std::pair<SegIter, SegOutIter>>::type
+        segmented_transfer(Algo&& algo, ExPolicy const& policy, std::true_type,
+            SegIter first, SegIter last, SegOutIter dest, Args const&... args)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+            typedef typename traits::local_iterator local_iterator_type;
 
-                    if (beg != end)
-                    {
-                        local_iterator_pair p = dispatch(traits::get_id(sit),
-                            algo, policy, std::true_type(), beg, end, out);
-                        out = p.second;
-                    }
-                }
+            typedef hpx::traits::segmented_iterator_traits<SegOutIter>
+                output_traits;
+            typedef typename output_traits::segment_iterator
+                segment_output_iterator;
+            typedef typename output_traits::local_iterator
+                local_output_iterator_type;
 
-                // handle the beginning of the last partition
-                beg = traits::begin(sit);
-                end = traits::local(last);
-                if (beg != end)
-                {
-                    local_iterator_pair p =
-                        dispatch(traits::get_id(sit), algo, policy,
-                            std::true_type(), beg, end, traits::begin(sdest));
-                    out = p.second;
-                }
+            typedef typename std::decay<Algo>::type algo_type;
 
-                dest = output_traits::compose(sdest, out);
-            }
+            dest = for_each_transfer_segment(first, last, dest,
+                [&](segment_iterator sit, local_iterator_type beg,
+                    local_iterator_type end, segment_output_iterator sdest,
+                    local_output_iterator_type out) {
+                    future<void> f = transfer_segment_async<algo_type,
+                        ExPolicy, std::true_type, SegIter, SegOutIter>(algo,
+                        policy, std::true_type(), sit, beg, end, sdest, out,
+                        args...);
+                    f.wait();
+
+                    // handle any remote exceptions
+                    if (f.has_exception())
+                    {
+                        std::list<std::exception_ptr> errors;
+                        parallel::util::detail::handle_remote_exceptions<
+                            ExPolicy>::call(f.get_exception_ptr(), errors);
+
+                        HPX_ASSERT(errors.empty());
+                        throw exception_list(std::move(errors));
+                    }
+                });
 
             return util::detail::algorithm_result<ExPolicy,
                 std::pair<SegIter, SegOutIter>>::get(std::make_pair(last,
@@ -125,11 +281,12 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
         // parallel remote implementation
         template <typename Algo, typename ExPolicy, typename SegIter,
-            typename SegOutIter>
+            typename SegOutIter, typename... Args>
         static typename util::detail::algorithm_result<ExPolicy,
             std::pair<SegIter, SegOutIter>>::type
-        segmented_transfer(Algo&& algo, ExPolicy const& policy, std::false_type,
-            SegIter first, SegIter last, SegOutIter dest)
+        segmented_transfer(Algo&& algo, ExPolicy const& policy,
+            std::false_type, SegIter first, SegIter last, SegOutIter dest,
+            Args const&... args)
         {
             typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
             typedef typename traits::segment_iterator segment_iterator;
@@ -142,87 +299,38 @@ namespace hpx { namespace parallel { inline namespace v1 {
             typedef typename output_traits::local_iterator
                 local_output_iterator_type;
 
-            typedef std::pair<local_iterator_type, local_output_iterator_type>
-                local_iterator_pair;
-
             typedef std::integral_constant<bool,
                 !hpx::traits::is_forward_iterator<SegIter>::value>
                 forced_seq;
 
-            segment_iterator sit = traits::segment(first);
-            segment_iterator send = traits::segment(last);
-
-            segment_output_iterator sdest = traits::segment(dest);
-
-            std::vector<shared_future<local_iterator_pair>> segments;
-            segments.reserve(std::distance(sit, send));
-
-            if (sit == send)
-            {
-                // all elements are on the same partition
-                local_iterator_type beg = traits::local(first);
-                local_iterator_type end = traits::local(last);
-
-                if (beg != end)
-                {
-                    segments.push_back(dispatch_async(traits::get_id(sit), algo,
-                        policy, forced_seq(), beg, end, traits::local(dest)));
-                }
-            }
-            else
-            {
-                // handle the remaining part of the first partition
-                local_iterator_type beg = traits::local(first);
-                local_iterator_type end = traits::end(sit);
-                local_output_iterator_type out = traits::local(dest);
-
-                if (beg != end)
-                {
-                    segments.push_back(dispatch_async(traits::get_id(sit), algo,
-                        policy, forced_seq(), beg, end, out));
-                }
-
-                // handle all of the full partitions
-                for ((void) ++sit, ++sdest; sit != send; (void) ++sit, ++sdest)
-                {
-                    beg = traits::begin(sit);
-                    end = traits::end(sit);
-                    out = traits::begin(sdest);
-
-                    if (beg != end)
-                    {
-                        segments.push_back(dispatch_async(traits::get_id(sit),
-                            algo, policy, forced_seq(), beg, end, out));
-                    }
-                }
-
-                // handle the beginning of the last partition
-                beg = traits::begin(sit);
-                end = traits::local(last);
-
-                if (beg != end)
-                {
-                    segments.push_back(dispatch_async(traits::get_id(sit), algo,
-                        policy, forced_seq(), beg, end, traits::begin(sdest)));
-                }
-            }
-            // NOLINTNEXTLINE(bugprone-use-after-move)
+            typedef typename std::decay<Algo>::type algo_type;
+
+            std::vector<future<void>> segments;
+            segments.reserve(
+                std::distance(traits::segment(first), traits::segment(last)) +
+                1);
+
+            dest = for_each_transfer_segment(first, last, dest,
+                [&](segment_iterator sit, local_iterator_type beg,
+                    local_iterator_type end, segment_output_iterator sdest,
+                    local_output_iterator_type out) {
+                    segments.push_back(
+                        transfer_segment_async<algo_type, ExPolicy,
+                            forced_seq, SegIter, SegOutIter>(algo, policy,
+                            forced_seq(), sit, beg, end, sdest, out, args...));
+                });
             HPX_ASSERT(!segments.empty());
 
             return util::detail::
                 algorithm_result<ExPolicy, std::pair<SegIter, SegOutIter>>::get(
                     hpx::dataflow(
-                        [=](std::vector<shared_future<local_iterator_pair>>&& r)
+                        [=](std::vector<future<void>>&& r)
                             -> std::pair<SegIter, SegOutIter> {
                             // handle any remote exceptions, will throw on error
                             std::list<std::exception_ptr> errors;
                             parallel::util::detail::handle_remote_exceptions<
                                 ExPolicy>::call(r, errors);
-
-                            local_iterator_pair p = r.back().get();
-                            return std::make_pair(
-                                output_traits::compose(sdest, p.first),
-                                output_traits::compose(sdest, p.second));
+                            return std::make_pair(last, dest);
                         },
                         std::move(segments)));
         }
@@ -0,0 +1,595 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_SEGMENTED_ALGORITHM_SORT)
+#define HPX_PARALLEL_SEGMENTED_ALGORITHM_SORT
+
+#include <hpx/config.hpp>
+#include <hpx/assertion.hpp>
+#include <hpx/errors.hpp>
+#include <hpx/lcos/async.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/promise.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/runtime/launch_policy.hpp>
+#include <hpx/runtime/naming/id_type.hpp>
+#include <hpx/runtime/trigger_lco.hpp>
+#include <hpx/traits/segmented_iterator_traits.hpp>
+
+#include <hpx/execution/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/transfer.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_sort
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // The number of samples drawn from each part of the sequence per
+        // part, more samples lead to more evenly sized buckets.
+        constexpr std::size_t segmented_sort_oversampling = 16;
+
+        // A sorted run of elements stored in one partition
+        template <typename LocalIter>
+        struct segmented_sort_run
+        {
+            id_type id_;
+            LocalIter first_;
+            LocalIter last_;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                // clang-format off
+                ar & id_ & first_ & last_;
+                // clang-format on
+            }
+        };
+
+        // A part of the final position of a bucket, stored in one partition
+        template <typename LocalIter>
+        struct segmented_sort_target
+        {
+            id_type id_;
+            LocalIter first_;
+            std::size_t count_;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                // clang-format off
+                ar & id_ & first_ & count_;
+                // clang-format on
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Sorts the part of the sequence stored in the partition it is
+        // executed on, returns evenly spaced samples of the sorted part.
+        template <typename T>
+        struct segmented_sort_local
+          : public algorithm<segmented_sort_local<T>, std::vector<T>>
+        {
+            segmented_sort_local()
+              : segmented_sort_local::algorithm("segmented_sort_local")
+            {
+            }
+
+            template <typename RandomIt>
+            static std::vector<T> get_samples(
+                RandomIt first, RandomIt last, std::size_t num_samples)
+            {
+                std::vector<T> samples;
+
+                std::size_t const size = std::distance(first, last);
+                num_samples = (std::min)(num_samples, size);
+                samples.reserve(num_samples);
+
+                for (std::size_t i = 0; i != num_samples; ++i)
+                {
+                    samples.push_back(
+                        *std::next(first, (i * size) / num_samples));
+                }
+                return samples;
+            }
+
+            template <typename ExPolicy, typename RandomIt, typename Compare,
+                typename Proj>
+            static std::vector<T> sequential(ExPolicy, RandomIt first,
+                RandomIt last, Compare const& comp, Proj const& proj,
+                std::size_t num_samples)
+            {
+                std::sort(first, last,
+                    util::compare_projected<Compare const&, Proj const&>(
+                        comp, proj));
+                return get_samples(first, last, num_samples);
+            }
+
+            template <typename ExPolicy, typename RandomIt, typename Compare,
+                typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                std::vector<T>>::type
+            parallel(ExPolicy&& policy, RandomIt first, RandomIt last,
+                Compare const& comp, Proj const& proj, std::size_t num_samples)
+            {
+                sort<RandomIt>().call(std::forward<ExPolicy>(policy),
+                    std::false_type(), first, last, comp, proj);
+
+                return util::detail::algorithm_result<ExPolicy,
+                    std::vector<T>>::get(get_samples(first, last, num_samples));
+            }
+        };
+
+        // Returns the offsets of the buckets defined by the given splitters
+        // inside of the sorted part of the sequence stored in the partition
+        // it is executed on.
+        template <typename T>
+        struct segmented_sort_buckets
+          : public algorithm<segmented_sort_buckets<T>,
+                std::vector<std::size_t>>
+        {
+            segmented_sort_buckets()
+              : segmented_sort_buckets::algorithm("segmented_sort_buckets")
+            {
+            }
+
+            template <typename ExPolicy, typename RandomIt, typename Compare,
+                typename Proj>
+            static std::vector<std::size_t> sequential(ExPolicy,
+                RandomIt first, RandomIt last, std::vector<T> const& splitters,
+                Compare const& comp, Proj const& proj)
+            {
+                std::vector<std::size_t> offsets;
+                offsets.reserve(splitters.size() + 2);
+                offsets.push_back(0);
+
+                // an element belongs to the first bucket whose splitter is
+                // not less than the element
+                auto less = util::compare_projected<Compare const&,
+                    Proj const&>(comp, proj);
+
+                RandomIt it = first;
+                for (T const& splitter : splitters)
+                {
+                    it = std::upper_bound(it, last, splitter, less);
+                    offsets.push_back(std::distance(first, it));
+                }
+
+                offsets.push_back(std::distance(first, last));
+                return offsets;
+            }
+
+            template <typename ExPolicy, typename RandomIt, typename Compare,
+                typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                std::vector<std::size_t>>::type
+            parallel(ExPolicy&& policy, RandomIt first, RandomIt last,
+                std::vector<T> const& splitters, Compare const& comp,
+                Proj const& proj)
+            {
+                return util::detail::algorithm_result<ExPolicy,
+                    std::vector<std::size_t>>::get(sequential(policy, first,
+                    last, splitters, comp, proj));
+            }
+        };
+
+        // Reads the given part of the partition it is executed on.
+        template <typename T>
+        struct segmented_sort_read
+          : public algorithm<segmented_sort_read<T>, std::vector<T>>
+        {
+            segmented_sort_read()
+              : segmented_sort_read::algorithm("segmented_sort_read")
+            {
+            }
+
+            template <typename ExPolicy, typename InIter>
+            static std::vector<T> sequential(
+                ExPolicy, InIter first, InIter last)
+            {
+                return std::vector<T>(first, last);
+            }
+
+            template <typename ExPolicy, typename InIter>
+            static typename util::detail::algorithm_result<ExPolicy,
+                std::vector<T>>::type
+            parallel(ExPolicy&& policy, InIter first, InIter last)
+            {
+                return util::detail::algorithm_result<ExPolicy,
+                    std::vector<T>>::get(sequential(policy, first, last));
+            }
+        };
+
+        // Collects the runs making up one bucket and merges them. The merged
+        // bucket is written to its final position only after the returned
+        // LCO was triggered, which allows to delay overwriting the sequence
+        // until all buckets have been collected. The LCO referred to by
+        // 'done' is triggered once the bucket has been written.
+        template <typename T>
+        struct segmented_sort_merge
+          : public algorithm<segmented_sort_merge<T>, id_type>
+        {
+            segmented_sort_merge()
+              : segmented_sort_merge::algorithm("segmented_sort_merge")
+            {
+            }
+
+            template <typename LocalIter>
+            static void write_bucket(std::vector<T>& bucket,
+                std::vector<segmented_sort_target<LocalIter>> const& targets)
+            {
+                std::vector<future<void>> written;
+                written.reserve(targets.size());
+
+                auto it = bucket.begin();
+                for (auto const& target : targets)
+                {
+                    auto next = std::next(it, target.count_);
+                    written.push_back(dispatch_async(target.id_,
+                        transfer_receive(), execution::seq, std::true_type(),
+                        std::vector<T>(std::make_move_iterator(it),
+                            std::make_move_iterator(next)),
+                        target.first_));
+                    it = next;
+                }
+                HPX_ASSERT(it == bucket.end());
+
+                hpx::wait_all(written);
+
+                std::list<std::exception_ptr> errors;
+                util::detail::handle_remote_exceptions<
+                    execution::sequenced_policy>::call(written, errors);
+            }
+
+            template <typename ExPolicy, typename LocalIter, typename Compare,
+                typename Proj>
+            static id_type sequential(ExPolicy,
+                std::vector<segmented_sort_run<LocalIter>> const& runs,
+                std::vector<segmented_sort_target<LocalIter>> const& targets,
+                Compare const& comp, Proj const& proj, id_type const& done)
+            {
+                std::vector<future<std::vector<T>>> parts;
+                parts.reserve(runs.size());
+                for (auto const& run : runs)
+                {
+                    parts.push_back(dispatch_async(run.id_,
+                        segmented_sort_read<T>(), execution::seq,
+                        std::true_type(), run.first_, run.last_));
+                }
+                hpx::wait_all(parts);
+
+                std::list<std::exception_ptr> errors;
+                util::detail::handle_remote_exceptions<
+                    execution::sequenced_policy>::call(parts, errors);
+
+                // merge the sorted runs
+                auto less = util::compare_projected<Compare const&,
+                    Proj const&>(comp, proj);
+
+                std::vector<T> bucket;
+                for (future<std::vector<T>>& f : parts)
+                {
+                    std::vector<T> part = f.get();
+                    std::size_t const middle = bucket.size();
+                    bucket.insert(bucket.end(),
+                        std::make_move_iterator(part.begin()),
+                        std::make_move_iterator(part.end()));
+                    std::inplace_merge(bucket.begin(),
+                        bucket.begin() + middle, bucket.end(), less);
+                }
+
+                // wait for the signal to write the bucket
+                auto go = std::make_shared<lcos::promise<void>>();
+                future<void> signal = go->get_future();
+                id_type id = go->get_id();
+
+                signal.then(launch::async,
+                    [go, done, targets, bucket = std::move(bucket)](
+                        future<void>&& f) mutable {
+                        try
+                        {
+                            // an error means the sort was abandoned
+                            if (!f.has_exception())
+                                write_bucket(bucket, targets);
+                            hpx::trigger_lco_event(done);
+                        }
+                        catch (...)
+                        {
+                            hpx::set_lco_error(done, std::current_exception());
+                        }
+                    });
+
+                return id;
+            }
+
+            template <typename ExPolicy, typename LocalIter, typename Compare,
+                typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                id_type>::type
+            parallel(ExPolicy&& policy,
+                std::vector<segmented_sort_run<LocalIter>> const& runs,
+                std::vector<segmented_sort_target<LocalIter>> const& targets,
+                Compare const& comp, Proj const& proj, id_type const& done)
+            {
+                return util::detail::algorithm_result<ExPolicy,
+                    id_type>::get(sequential(policy, runs, targets, comp, proj,
+                    done));
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Distributed sample sort: each part of the sequence is sorted on the
+        // locality of its partition, the samples drawn from the sorted parts
+        // define the splitters partitioning the elements into one bucket per
+        // part. Each bucket is collected and merged on the locality where it
+        // ends up (mostly) and is finally written to its position in the
+        // sorted sequence.
+        template <typename LocalPolicy, typename SegIter, typename Compare,
+            typename Proj>
+        SegIter segmented_sort(
+            SegIter first, SegIter last, Compare const& comp, Proj const& proj)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::segment_iterator segment_iterator;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef typename std::iterator_traits<SegIter>::value_type
+                value_type;
+
+            typedef segmented_sort_run<local_iterator_type> run_type;
+            typedef segmented_sort_target<local_iterator_type> target_type;
+
+            typedef typename execution::is_sequenced_execution_policy<
+                LocalPolicy>::type is_seq;
+
+            // collect the parts of the sequence stored in each partition
+            std::vector<run_type> parts;
+            {
+                segment_iterator sit = traits::segment(first);
+                segment_iterator send = traits::segment(last);
+
+                local_iterator_type beg = traits::local(first);
+                while (true)
+                {
+                    local_iterator_type end =
+                        sit == send ? traits::local(last) : traits::end(sit);
+                    if (beg != end)
+                        parts.push_back(run_type{traits::get_id(sit), beg, end});
+
+                    if (sit == send)
+                        break;
+
+                    beg = traits::begin(++sit);
+                }
+            }
+
+            std::size_t const num_parts = parts.size();
+            if (num_parts == 0)
+                return last;
+
+            std::list<std::exception_ptr> errors;
+
+            // sort all parts and draw the samples
+            std::size_t const num_samples =
+                num_parts == 1 ? 0 : segmented_sort_oversampling * num_parts;
+
+            std::vector<future<std::vector<value_type>>> sampled;
+            sampled.reserve(num_parts);
+            for (run_type const& part : parts)
+            {
+                sampled.push_back(dispatch_async(part.id_,
+                    segmented_sort_local<value_type>(), LocalPolicy(), is_seq(),
+                    part.first_, part.last_, comp, proj, num_samples));
+            }
+            hpx::wait_all(sampled);
+            util::detail::handle_remote_exceptions<LocalPolicy>::call(
+                sampled, errors);
+
+            if (num_parts == 1)
+                return last;
+
+            // select the splitters from the samples
+            auto less =
+                util::compare_projected<Compare const&, Proj const&>(comp, proj);
+
+            std::vector<value_type> samples;
+            for (future<std::vector<value_type>>& f : sampled)
+            {
+                std::vector<value_type> s = f.get();
+                samples.insert(samples.end(), std::make_move_iterator(s.begin()),
+                    std::make_move_iterator(s.end()));
+            }
+            std::sort(samples.begin(), samples.end(), less);
+
+            std::vector<value_type> splitters;
+            splitters.reserve(num_parts - 1);
+            for (std::size_t i = 1; i != num_parts; ++i)
+            {
+                splitters.push_back(
+                    samples[(i * samples.size()) / num_parts]);
+            }
+
+            // determine the buckets in each of the sorted parts
+            std::vector<future<std::vector<std::size_t>>> bucketed;
+            bucketed.reserve(num_parts);
+            for (run_type const& part : parts)
+            {
+                bucketed.push_back(dispatch_async(part.id_,
+                    segmented_sort_buckets<value_type>(), execution::seq,
+                    std::true_type(), part.first_, part.last_, splitters, comp,
+                    proj));
+            }
+            hpx::wait_all(bucketed);
+            util::detail::handle_remote_exceptions<LocalPolicy>::call(
+                bucketed, errors);
+
+            std::vector<std::vector<std::size_t>> offsets;
+            offsets.reserve(num_parts);
+            for (future<std::vector<std::size_t>>& f : bucketed)
+                offsets.push_back(f.get());
+
+            // collect and merge each bucket on the locality it starts on
+            std::vector<future<id_type>> merged;
+            std::vector<std::shared_ptr<lcos::promise<void>>> done;
+            std::vector<future<void>> written;
+
+            std::size_t part = 0;          // part the current bucket starts in
+            std::size_t part_offset = 0;    // offset inside of that part
+
+            for (std::size_t bucket = 0; bucket != num_parts; ++bucket)
+            {
+                std::vector<run_type> runs;
+                std::size_t size = 0;
+                for (std::size_t i = 0; i != num_parts; ++i)
+                {
+                    std::size_t const begin = offsets[i][bucket];
+                    std::size_t const end = offsets[i][bucket + 1];
+                    if (begin != end)
+                    {
+                        runs.push_back(run_type{parts[i].id_,
+                            std::next(parts[i].first_, begin),
+                            std::next(parts[i].first_, end)});
+                        size += end - begin;
+                    }
+                }
+
+                if (size == 0)
+                    continue;
+
+                // the final position of the bucket may span several parts
+                std::vector<target_type> targets;
+                id_type owner;
+                while (size != 0)
+                {
+                    std::size_t const part_size =
+                        std::distance(parts[part].first_, parts[part].last_);
+                    std::size_t const count =
+                        (std::min)(size, part_size - part_offset);
+
+                    if (!owner)
+                        owner = parts[part].id_;
+
+                    targets.push_back(target_type{parts[part].id_,
+                        std::next(parts[part].first_, part_offset), count});
+
+                    size -= count;
+                    part_offset += count;
+                    if (part_offset == part_size)
+                    {
+                        ++part;
+                        part_offset = 0;
+                    }
+                }
+
+                done.push_back(std::make_shared<lcos::promise<void>>());
+                written.push_back(done.back()->get_future());
+
+                merged.push_back(dispatch_async(owner,
+                    segmented_sort_merge<value_type>(), execution::seq,
+                    std::true_type(), std::move(runs), std::move(targets),
+                    comp, proj, done.back()->get_id()));
+            }
+            hpx::wait_all(merged);
+
+            // all buckets have been collected at this point (or the sort
+            // failed), let the buckets be written or abandoned
+            bool const failed =
+                std::any_of(merged.begin(), merged.end(),
+                    [](future<id_type> const& f) { return f.has_exception(); });
+
+            std::vector<future<void>> pending;
+            for (std::size_t i = 0; i != merged.size(); ++i)
+            {
+                if (merged[i].has_exception())
+                    continue;
+
+                id_type go = merged[i].get();
+                if (failed)
+                {
+                    hpx::set_lco_error(go,
+                        HPX_GET_EXCEPTION(hpx::no_success,
+                            "hpx::parallel::v1::detail::segmented_sort",
+                            "sorting the partitions failed"));
+                }
+                else
+                {
+                    hpx::trigger_lco_event(go);
+                }
+                pending.push_back(std::move(written[i]));
+            }
+            hpx::wait_all(pending);
+
+            util::detail::handle_remote_exceptions<LocalPolicy>::call(
+                merged, errors);
+            util::detail::handle_remote_exceptions<LocalPolicy>::call(
+                pending, errors);
+
+            return last;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+        sort_(ExPolicy&& policy, RandomIt first, RandomIt last, Compare&& comp,
+            Proj&& proj, std::true_type)
+        {
+            typedef util::detail::algorithm_result<ExPolicy, RandomIt> result;
+
+            typedef typename std::conditional<
+                execution::is_sequenced_execution_policy<ExPolicy>::value,
+                execution::sequenced_policy,
+                execution::parallel_policy>::type local_policy_type;
+
+            typedef typename std::decay<Compare>::type compare_type;
+            typedef typename std::decay<Proj>::type proj_type;
+
+            if (first == last)
+                return result::get(std::move(last));
+
+            if (execution::is_async_execution_policy<ExPolicy>::value)
+            {
+                return result::get(hpx::async(
+                    [first, last, comp = compare_type(comp),
+                        proj = proj_type(proj)]() -> RandomIt {
+                        return segmented_sort<local_policy_type>(
+                            first, last, comp, proj);
+                    }));
+            }
+
+            return result::get(
+                segmented_sort<local_policy_type>(first, last, comp, proj));
+        }
+
+        // forward declare the non-segmented version of this algorithm
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+        sort_(ExPolicy&& policy, RandomIt first, RandomIt last, Compare&& comp,
+            Proj&& proj, std::false_type);
+
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+#endif
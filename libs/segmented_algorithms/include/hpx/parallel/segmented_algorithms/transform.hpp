@@ -17,6 +17,7 @@
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/transform.hpp>
 #include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/transfer.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
 
@@ -37,180 +38,18 @@ namespace hpx { namespace parallel { inline namespace v1 {
         ///////////////////////////////////////////////////////////////////////
         /// \cond NOINTERNAL
 
-        // sequential remote implementation
-        template <typename Algo, typename ExPolicy, typename SegIter,
-            typename OutIter, typename F, typename Proj>
-        static typename util::detail::algorithm_result<ExPolicy,
-            std::pair<SegIter, OutIter>>::type
-        segmented_transform(Algo&& algo, ExPolicy const& policy, SegIter first,
-            SegIter last, OutIter dest, F&& f, Proj&& proj, std::true_type)
-        {
-            typedef hpx::traits::segmented_iterator_traits<SegIter> traits1;
-            typedef hpx::traits::segmented_iterator_traits<OutIter> traits2;
-            typedef typename traits1::segment_iterator segment_iterator1;
-            typedef typename traits1::local_iterator local_iterator_type1;
-            typedef typename traits2::segment_iterator segment_iterator2;
-            typedef typename traits2::local_iterator local_iterator_type2;
-
-            typedef util::detail::algorithm_result<ExPolicy,
-                std::pair<SegIter, OutIter>>
-                result;
-
-            segment_iterator1 sit = traits1::segment(first);
-            segment_iterator1 send = traits1::segment(last);
-            segment_iterator2 sdest = traits2::segment(dest);
-
-            if (sit == send)
-            {
-                // all elements are on the same partition
-                local_iterator_type1 beg = traits1::local(first);
-                local_iterator_type1 end = traits1::end(sit);
-                local_iterator_type2 ldest = traits2::begin(sdest);
-                if (beg != end)
-                {
-                    std::pair<local_iterator_type1, local_iterator_type2> out =
-                        dispatch(traits2::get_id(sdest), algo, policy,
-                            std::true_type(), beg, end, ldest, f, proj);
-                    last = traits1::compose(send, std::get<0>(out));
-                    dest = traits2::compose(sdest, std::get<1>(out));
-                }
-            }
-            else
-            {
-                // handle the remaining part of the first partition
-                local_iterator_type1 beg = traits1::local(first);
-                local_iterator_type1 end = traits1::end(sit);
-                local_iterator_type2 ldest = traits2::begin(sdest);
-                std::pair<local_iterator_type1, local_iterator_type2> out;
-                if (beg != end)
-                {
-                    out = dispatch(traits2::get_id(sdest), algo, policy,
-                        std::true_type(), beg, end, ldest, f, proj);
-                }
-
-                // handle all of the full partitions
-                for (++sit, ++sdest; sit != send; ++sit, ++sdest)
-                {
-                    beg = traits1::begin(sit);
-                    end = traits1::end(sit);
-                    ldest = traits2::begin(sdest);
-                    if (beg != end)
-                    {
-                        out = dispatch(traits2::get_id(sdest), algo, policy,
-                            std::true_type(), beg, end, ldest, f, proj);
-                    }
-                }
-
-                // handle the beginning of the last partition
-                beg = traits1::begin(sit);
-                end = traits1::local(last);
-                ldest = traits2::begin(sdest);
-                if (beg != end)
-                {
-                    out = dispatch(traits2::get_id(sdest), algo, policy,
-                        std::true_type(), beg, end, ldest, f, proj);
-                }
-                last = traits1::compose(send, std::get<0>(out));
-                dest = traits2::compose(sdest, std::get<1>(out));
-            }
-            return result::get(
-                std::make_pair(std::move(last), std::move(dest)));
-        }
-
-        // parallel remote implementation
+        // The transformed elements are computed on the locality of the
+        // source partition and sent to the destination partition, which may
+        // be partitioned differently.
         template <typename Algo, typename ExPolicy, typename SegIter,
-            typename OutIter, typename F, typename Proj>
+            typename OutIter, typename F, typename Proj, typename IsSeq>
         static typename util::detail::algorithm_result<ExPolicy,
             std::pair<SegIter, OutIter>>::type
         segmented_transform(Algo&& algo, ExPolicy const& policy, SegIter first,
-            SegIter last, OutIter dest, F&& f, Proj&& proj, std::false_type)
+            SegIter last, OutIter dest, F&& f, Proj&& proj, IsSeq is_seq)
         {
-            typedef hpx::traits::segmented_iterator_traits<SegIter> traits1;
-            typedef hpx::traits::segmented_iterator_traits<OutIter> traits2;
-            typedef typename traits1::segment_iterator segment_iterator1;
-            typedef typename traits1::local_iterator local_iterator_type1;
-            typedef typename traits2::segment_iterator segment_iterator2;
-            typedef typename traits2::local_iterator local_iterator_type2;
-
-            typedef util::detail::algorithm_result<ExPolicy,
-                std::pair<SegIter, OutIter>>
-                result;
-
-            typedef std::integral_constant<bool,
-                !hpx::traits::is_forward_iterator<SegIter>::value>
-                forced_seq;
-
-            segment_iterator1 sit = traits1::segment(first);
-            segment_iterator1 send = traits1::segment(last);
-            segment_iterator2 sdest = traits2::segment(dest);
-
-            typedef std::vector<
-                future<std::pair<local_iterator_type1, local_iterator_type2>>>
-                segment_type;
-            segment_type segments;
-            segments.reserve(std::distance(sit, send));
-
-            if (sit == send)
-            {
-                // all elements are on the same partition
-                local_iterator_type1 beg = traits1::local(first);
-                local_iterator_type1 end = traits1::local(last);
-                local_iterator_type2 ldest = traits2::begin(sdest);
-                if (beg != end)
-                {
-                    segments.push_back(dispatch_async(traits2::get_id(sdest),
-                        algo, policy, forced_seq(), beg, end, ldest, f, proj));
-                }
-            }
-            else
-            {
-                // handle the remaining part of the first partition
-                local_iterator_type1 beg = traits1::local(first);
-                local_iterator_type1 end = traits1::end(sit);
-                local_iterator_type2 ldest = traits2::begin(sdest);
-                if (beg != end)
-                {
-                    segments.push_back(dispatch_async(traits2::get_id(sdest),
-                        algo, policy, forced_seq(), beg, end, ldest, f, proj));
-                }
-
-                // handle all of the full partitions
-                for (++sit, ++sdest; sit != send; ++sit, ++sdest)
-                {
-                    beg = traits1::begin(sit);
-                    end = traits1::end(sit);
-                    ldest = traits2::begin(sdest);
-                    if (beg != end)
-                    {
-                        segments.push_back(
-                            dispatch_async(traits2::get_id(sdest), algo, policy,
-                                forced_seq(), beg, end, ldest, f, proj));
-                    }
-                }
-
-                // handle the beginning of the last partition
-                beg = traits1::begin(sit);
-                end = traits1::local(last);
-                ldest = traits2::begin(sdest);
-                if (beg != end)
-                {
-                    segments.push_back(dispatch_async(traits2::get_id(sdest),
-                        algo, policy, forced_seq(), beg, end, ldest, f, proj));
-                }
-            }
-
-            return result::get(dataflow(
-                [=](segment_type&& r) -> std::pair<SegIter, OutIter> {
-                    // handle any remote exceptions, will throw on error
-                    std::list<std::exception_ptr> errors;
-                    parallel::util::detail::handle_remote_exceptions<
-                        ExPolicy>::call(r, errors);
-                    auto ft = r.back().get();
-                    auto olast = traits1::compose(send, std::get<0>(ft));
-                    auto odest = traits2::compose(sdest, std::get<1>(ft));
-                    return std::make_pair(olast, odest);
-                },
-                std::move(segments)));
+            return segmented_transfer(std::forward<Algo>(algo), policy, is_seq,
+                first, last, dest, f, proj);
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -100,6 +100,36 @@ void copy_algo_tests_with_policy_async(std::size_t size, std::size_t localities,
     compare_vectors(v1, v2);
 }
 
+// copy between vectors whose partitions don't line up
+template <typename T, typename DistPolicy1, typename DistPolicy2,
+    typename ExPolicy>
+void copy_algo_tests_with_policies(std::size_t size, DistPolicy1 const& policy1,
+    DistPolicy2 const& policy2, ExPolicy const& copy_policy)
+{
+    hpx::partitioned_vector<T> v1(size, policy1);
+
+    T val = T(0);
+    for (auto it = v1.begin(); it != v1.end(); ++it)
+        *it = val++;
+
+    hpx::partitioned_vector<T> v2(size, policy2);
+    auto p = hpx::parallel::copy(copy_policy, v1.begin(), v1.end(), v2.begin());
+    HPX_TEST(p.out() == v2.end());
+    compare_vectors(v1, v2);
+}
+
+template <typename T, typename DistPolicy1, typename DistPolicy2>
+void copy_tests_with_policies(
+    std::size_t size, DistPolicy1 const& policy1, DistPolicy2 const& policy2)
+{
+    using namespace hpx::parallel::execution;
+
+    copy_algo_tests_with_policies<T>(size, policy1, policy2, seq);
+    copy_algo_tests_with_policies<T>(size, policy1, policy2, par);
+    copy_algo_tests_with_policies<T>(size, policy2, policy1, seq);
+    copy_algo_tests_with_policies<T>(size, policy2, policy1, par);
+}
+
 template <typename T, typename DistPolicy>
 void copy_tests_with_policy(
     std::size_t size, std::size_t localities, DistPolicy const& policy)
@@ -155,6 +185,11 @@ void copy_tests()
     copy_tests_with_policy<T>(length, 3, hpx::container_layout(3, localities));
     copy_tests_with_policy<T>(
         length, localities.size(), hpx::container_layout(localities));
+
+    copy_tests_with_policies<T>(
+        length, hpx::container_layout(3), hpx::container_layout(5));
+    copy_tests_with_policies<T>(length, hpx::container_layout(2, localities),
+        hpx::container_layout(5, localities));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
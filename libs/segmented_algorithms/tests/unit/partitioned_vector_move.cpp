@@ -119,6 +119,36 @@ void move_algo_tests_with_policy_async(std::size_t size, std::size_t localities,
     compare_vectors(v1, v3);
 }
 
+// move between vectors whose partitions don't line up
+template <typename T, typename DistPolicy1, typename DistPolicy2,
+    typename ExPolicy>
+void move_algo_tests_with_policies(std::size_t size, DistPolicy1 const& policy1,
+    DistPolicy2 const& policy2, ExPolicy const& move_policy, T value)
+{
+    hpx::partitioned_vector<T> v1(size, policy1);
+    fill_vector(v1, T(value));
+
+    hpx::partitioned_vector<T> v2(v1);
+    compare_vectors(v1, v2);
+
+    hpx::partitioned_vector<T> v3(size, policy2);
+    auto p = hpx::parallel::move(move_policy, v2.begin(), v2.end(), v3.begin());
+    HPX_TEST(p.out() == v3.end());
+    compare_vectors(v1, v3);
+}
+
+template <typename T, typename DistPolicy1, typename DistPolicy2>
+void move_tests_with_policies(std::size_t size, DistPolicy1 const& policy1,
+    DistPolicy2 const& policy2, T value)
+{
+    using namespace hpx::parallel::execution;
+
+    move_algo_tests_with_policies<T>(size, policy1, policy2, seq, value);
+    move_algo_tests_with_policies<T>(size, policy1, policy2, par, value);
+    move_algo_tests_with_policies<T>(size, policy2, policy1, seq, value);
+    move_algo_tests_with_policies<T>(size, policy2, policy1, par, value);
+}
+
 template <typename T, typename DistPolicy>
 void move_tests_with_policy(
     std::size_t size, std::size_t localities, DistPolicy const& policy, T value)
@@ -182,6 +212,11 @@ void move_tests(T value, T other_value)
         length, 3, hpx::container_layout(3, localities), value);
     move_tests_with_policy<T>(
         length, localities.size(), hpx::container_layout(localities), value);
+
+    move_tests_with_policies<T>(
+        length, hpx::container_layout(3), hpx::container_layout(5), value);
+    move_tests_with_policies<T>(length, hpx::container_layout(2, localities),
+        hpx::container_layout(5, localities), value);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,144 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+
+#include <hpx/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> random_vector(std::size_t size, std::size_t range)
+{
+    std::mt19937 gen(static_cast<unsigned>(size + range));
+    std::uniform_int_distribution<int> dist(0, static_cast<int>(range));
+
+    std::vector<T> v(size);
+    for (T& val : v)
+        val = T(dist(gen));
+    return v;
+}
+
+template <typename T>
+void fill_vector(hpx::partitioned_vector<T>& v, std::vector<T> const& values)
+{
+    typename hpx::partitioned_vector<T>::iterator it = v.begin();
+    for (T const& val : values)
+        *it++ = val;
+}
+
+template <typename T>
+void verify_vector(
+    hpx::partitioned_vector<T> const& v, std::vector<T> const& expected)
+{
+    typedef typename hpx::partitioned_vector<T>::const_iterator const_iterator;
+
+    HPX_TEST_EQ(v.size(), expected.size());
+
+    std::size_t i = 0;
+    const_iterator end = v.end();
+    for (const_iterator it = v.begin(); it != end; ++it, ++i)
+    {
+        HPX_TEST_EQ(*it, expected[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void sort_algo_tests_with_policy(std::size_t size, std::size_t range,
+    DistPolicy const& policy, ExPolicy const& sort_policy)
+{
+    std::vector<T> values = random_vector<T>(size, range);
+
+    hpx::partitioned_vector<T> v(size, policy);
+    fill_vector(v, values);
+
+    auto result = hpx::parallel::sort(sort_policy, v.begin(), v.end());
+    HPX_TEST(result == v.end());
+
+    std::sort(values.begin(), values.end());
+    verify_vector(v, values);
+
+    // sort in descending order
+    fill_vector(v, values);
+    hpx::parallel::sort(sort_policy, v.begin(), v.end(), std::greater<T>());
+
+    std::sort(values.begin(), values.end(), std::greater<T>());
+    verify_vector(v, values);
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void sort_algo_tests_with_policy_async(std::size_t size, std::size_t range,
+    DistPolicy const& policy, ExPolicy const& sort_policy)
+{
+    std::vector<T> values = random_vector<T>(size, range);
+
+    hpx::partitioned_vector<T> v(size, policy);
+    fill_vector(v, values);
+
+    using hpx::parallel::execution::task;
+
+    auto f = hpx::parallel::sort(sort_policy(task), v.begin(), v.end());
+    HPX_TEST(f.get() == v.end());
+
+    std::sort(values.begin(), values.end());
+    verify_vector(v, values);
+}
+
+template <typename T, typename DistPolicy>
+void sort_tests_with_policy(
+    std::size_t size, std::size_t range, DistPolicy const& policy)
+{
+    using namespace hpx::parallel::execution;
+
+    sort_algo_tests_with_policy<T>(size, range, policy, seq);
+    sort_algo_tests_with_policy<T>(size, range, policy, par);
+
+    sort_algo_tests_with_policy_async<T>(size, range, policy, seq);
+    sort_algo_tests_with_policy_async<T>(size, range, policy, par);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void sort_tests()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    for (std::size_t length : {0, 1, 13, 1007})
+    {
+        // many duplicates and mostly distinct values
+        for (std::size_t range : {3, 100000})
+        {
+            sort_tests_with_policy<T>(length, range, hpx::container_layout);
+            sort_tests_with_policy<T>(length, range, hpx::container_layout(3));
+            sort_tests_with_policy<T>(
+                length, range, hpx::container_layout(3, localities));
+            sort_tests_with_policy<T>(
+                length, range, hpx::container_layout(localities));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    sort_tests<double>();
+    sort_tests<int>();
+
+    return 0;
+}
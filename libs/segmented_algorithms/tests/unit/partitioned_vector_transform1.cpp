@@ -25,6 +25,17 @@ struct pfo
     }
 };
 
+// the results can't be represented by the source element type
+template <typename U>
+struct half
+{
+    template <typename T>
+    U operator()(T const& val) const
+    {
+        return U(val) * U(0.5);
+    }
+};
+
 template <typename U>
 struct add
 {
@@ -165,6 +176,45 @@ void transform_tests(std::vector<hpx::id_type>& localities)
             hpx::parallel::execution::par(hpx::parallel::execution::task), v, w,
             U(1));
     }
+
+    // the destination is partitioned differently
+    {
+        hpx::partitioned_vector<T> v(
+            length, T(1), hpx::container_layout(localities));
+        hpx::partitioned_vector<U> w(
+            length, hpx::container_layout(5, localities));
+        test_transform(hpx::parallel::execution::seq, v, w, U(1));
+        test_transform(hpx::parallel::execution::par, v, w, U(1));
+        test_transform_async(
+            hpx::parallel::execution::seq(hpx::parallel::execution::task), v, w,
+            U(1));
+        test_transform_async(
+            hpx::parallel::execution::par(hpx::parallel::execution::task), v, w,
+            U(1));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T, typename U>
+void test_transform_half(ExPolicy&& policy, hpx::partitioned_vector<T>& v,
+    hpx::partitioned_vector<U>& w)
+{
+    hpx::parallel::transform(policy, v.begin(), v.end(), w.begin(), half<U>());
+    verify_values(policy, w, U(0.5));
+}
+
+template <typename T, typename U>
+void transform_half_tests(std::vector<hpx::id_type>& localities)
+{
+    std::size_t const length = 12;
+
+    // the destination is partitioned differently, the results are sent to
+    // the destination partitions
+    hpx::partitioned_vector<T> v(
+        length, T(1), hpx::container_layout(localities));
+    hpx::partitioned_vector<U> w(length, hpx::container_layout(5, localities));
+    test_transform_half(hpx::parallel::execution::seq, v, w);
+    test_transform_half(hpx::parallel::execution::par, v, w);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -173,6 +223,8 @@ int main()
     std::vector<hpx::id_type> localities = hpx::find_all_localities();
 
     transform_tests<int, int>(localities);
+    transform_tests<int, double>(localities);
+    transform_half_tests<int, double>(localities);
 
     return hpx::util::report_errors();
 }
@@ -30,6 +30,14 @@ namespace hpx { namespace serialization {
             char const* buffer, std::size_t size, std::size_t buffer_size) = 0;
         virtual void load(void* dst, std::size_t dst_count) = 0;
 
+        // Return whether the filtered data records the size of the
+        // unfiltered data, i.e. whether init_data can be called without
+        // knowing that size beforehand.
+        virtual bool records_data_size() const
+        {
+            return false;
+        }
+
         template <class T>
         void serialize(T& /*ar*/, unsigned)
         {
@@ -13,6 +13,7 @@
 #include <hpx/serialization/binary_filter.hpp>
 
 #include <cstddef>
+#include <memory>
 
 namespace hpx { namespace serialization {
 
@@ -44,6 +45,15 @@ namespace hpx { namespace serialization {
         virtual void set_filter(binary_filter* filter) = 0;
         virtual void load_binary(void* address, std::size_t count) = 0;
         virtual void load_binary_chunk(void* address, std::size_t count) = 0;
+
+        // Give access to the data of the next zero-copy chunk without copying
+        // it, 'owner' keeps the memory alive afterwards. Returns nullptr if
+        // the data has to be loaded using load_binary_chunk instead.
+        virtual void const* borrow_binary_chunk(std::size_t /* count */,
+            std::size_t /* alignment */, std::shared_ptr<void>& /* owner */)
+        {
+            return nullptr;
+        }
     };
 }}    // namespace hpx::serialization
 
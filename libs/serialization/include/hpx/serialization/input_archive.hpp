@@ -33,12 +33,17 @@ namespace hpx { namespace serialization {
     {
         using base_type = basic_archive<input_archive>;
 
+        // If chunk_owners is given, it holds the owner of the memory of each
+        // of the pointer chunks (or nullptr), this allows to alias the chunk
+        // data instead of copying it (see borrow_binary_chunk).
         template <typename Container>
         input_archive(Container& buffer, std::size_t inbound_data_size = 0,
-            const std::vector<serialization_chunk>* chunks = nullptr)
+            const std::vector<serialization_chunk>* chunks = nullptr,
+            const std::vector<std::shared_ptr<void>>* chunk_owners = nullptr)
           : base_type(0U)
           , buffer_(new input_container<Container>(
-                buffer, chunks, inbound_data_size))
+                buffer, chunks, inbound_data_size, chunk_owners))
+          , is_vector_(std::is_same<Container, std::vector<char>>::value)
         {
             // endianness needs to be saves separately as it is needed to
             // properly interpret the flags
@@ -122,6 +127,33 @@ namespace hpx { namespace serialization {
             return basic_archive<input_archive>::current_pos();
         }
 
+        // Give access to the next count bytes of bitwise serialized data
+        // without copying them, if these were received as a separate
+        // zero-copy chunk whose memory can be shared. The returned memory
+        // is suitably aligned and stays valid for as long as 'owner' is
+        // kept alive. Returns nullptr if the data has to be loaded using
+        // load_binary_chunk (i.e. hpx::serialization::make_array) instead.
+        void const* borrow_binary_chunk(std::size_t count,
+            std::size_t alignment, std::shared_ptr<void>& owner)
+        {
+#if BOOST_ENDIAN_BIG_BYTE
+            bool archive_endianess_differs = endian_little();
+#else
+            bool archive_endianess_differs = endian_big();
+#endif
+            if (0 == count || archive_endianess_differs ||
+                disable_array_optimization() || disable_data_chunking())
+            {
+                return nullptr;
+            }
+
+            void const* data =
+                buffer_->borrow_binary_chunk(count, alignment, owner);
+            if (data != nullptr)
+                size_ += count;
+            return data;
+        }
+
     private:
         friend struct basic_archive<input_archive>;
 
@@ -198,18 +230,35 @@ namespace hpx { namespace serialization {
             if (0 == count)
                 return;
 
-            buffer_->load_binary(address, count);
+            load_binary_impl(address, count);
 
             size_ += count;
         }
 
+        // The input container for std::vector<char> is accessed directly,
+        // bypassing the virtual function dispatch.
+        void load_binary_impl(void* address, std::size_t count)
+        {
+            using vector_container = input_container<std::vector<char>>;
+
+            if (is_vector_)
+            {
+                static_cast<vector_container*>(buffer_.get())
+                    ->vector_container::load_binary(address, count);
+            }
+            else
+            {
+                buffer_->load_binary(address, count);
+            }
+        }
+
         void load_binary_chunk(void* address, std::size_t count)
         {
             if (0 == count)
                 return;
 
             if (disable_data_chunking())
-                buffer_->load_binary(address, count);
+                load_binary_impl(address, count);
             else
                 buffer_->load_binary_chunk(address, count);
 
@@ -217,6 +266,7 @@ namespace hpx { namespace serialization {
         }
 
         std::unique_ptr<erased_input_container> buffer_;
+        bool is_vector_;
     };
 
     //
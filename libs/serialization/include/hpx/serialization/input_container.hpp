@@ -64,12 +64,14 @@ namespace hpx { namespace serialization {
 
         input_container(Container const& cont,
             std::vector<serialization_chunk> const* chunks,
-            std::size_t inbound_data_size)
+            std::size_t inbound_data_size,
+            std::vector<std::shared_ptr<void>> const* chunk_owners = nullptr)
           : cont_(cont)
           , current_(0)
           , filter_()
           , decompressed_size_(inbound_data_size)
           , chunks_(nullptr)
+          , chunk_owners_(nullptr)
           , current_chunk_(std::size_t(-1))
           , current_chunk_size_(0)
         {
@@ -77,6 +79,12 @@ namespace hpx { namespace serialization {
             {
                 chunks_ = chunks;
                 current_chunk_ = 0;
+
+                if (chunk_owners)
+                {
+                    HPX_ASSERT(chunk_owners->size() == chunks->size());
+                    chunk_owners_ = chunk_owners;
+                }
             }
         }
 
@@ -88,7 +96,9 @@ namespace hpx { namespace serialization {
                 current_ = access_traits::init_data(
                     cont_, filter_.get(), current_, decompressed_size_);
 
-                if (decompressed_size_ < current_)
+                // a decompressed size of zero means that the size is not
+                // known beforehand (the filter has to determine it)
+                if (decompressed_size_ != 0 && decompressed_size_ < current_)
                 {
                     HPX_THROW_EXCEPTION(serialization_error,
                         "input_container::set_filter",
@@ -178,12 +188,41 @@ namespace hpx { namespace serialization {
             }
         }
 
+        // The receiving end can alias the memory of a zero-copy chunk if
+        // the parcelport handed over the ownership of the chunks.
+        void const* borrow_binary_chunk(std::size_t count,
+            std::size_t alignment, std::shared_ptr<void>& owner)    // override
+        {
+            if (chunk_owners_ == nullptr ||
+                count < HPX_ZERO_COPY_SERIALIZATION_THRESHOLD || filter_)
+            {
+                return nullptr;
+            }
+
+            HPX_ASSERT(current_chunk_ != std::size_t(-1));
+            if (get_chunk_type(current_chunk_) != chunk_type_pointer ||
+                get_chunk_size(current_chunk_) != count ||
+                !(*chunk_owners_)[current_chunk_])
+            {
+                return nullptr;
+            }
+
+            void const* data = get_chunk_data(current_chunk_).cpos_;
+            if (reinterpret_cast<std::uintptr_t>(data) % alignment != 0)
+                return nullptr;
+
+            owner = (*chunk_owners_)[current_chunk_];
+            ++current_chunk_;
+            return data;
+        }
+
         Container const& cont_;
         std::size_t current_;
         std::unique_ptr<binary_filter> filter_;
         std::size_t decompressed_size_;
 
         std::vector<serialization_chunk> const* chunks_;
+        std::vector<std::shared_ptr<void>> const* chunk_owners_;
         std::size_t current_chunk_;
         std::size_t current_chunk_size_;
     };
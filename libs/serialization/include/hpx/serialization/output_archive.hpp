@@ -87,6 +87,38 @@ namespace hpx { namespace serialization {
             }
             return res;
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The output containers the archive knows the exact type of. Those are
+        // accessed directly, which allows to inline the copying of the data
+        // instead of going through the virtual interface for each value.
+        enum class output_container_kind : std::uint8_t
+        {
+            erased = 0,
+            vector_basic = 1,      // std::vector<char>, no chunking
+            vector_chunked = 2     // std::vector<char>, zero-copy chunking
+        };
+
+        template <typename Container>
+        constexpr output_container_kind get_output_container_kind(
+            Container const&, std::vector<serialization_chunk>*,
+            binary_filter*)
+        {
+            return output_container_kind::erased;
+        }
+
+        inline output_container_kind get_output_container_kind(
+            std::vector<char> const&, std::vector<serialization_chunk>* chunks,
+            binary_filter* filter)
+        {
+            // the filtered containers are derived from output_container, but
+            // they have to be accessed through the virtual interface
+            if (filter != nullptr)
+                return output_container_kind::erased;
+
+            return chunks == nullptr ? output_container_kind::vector_basic :
+                                       output_container_kind::vector_chunked;
+        }
     }    // namespace detail
 
     ////////////////////////////////////////////////////////////////////////////
@@ -112,6 +144,7 @@ namespace hpx { namespace serialization {
           , buffer_(detail::create_output_container(buffer, chunks, filter,
                 typename traits::serialization_access_data<
                     Container>::preprocessing_only()))
+          , kind_(detail::get_output_container_kind(buffer, chunks, filter))
         {
             // endianness needs to be saved separately as it is needed to
             // properly interpret the flags
@@ -287,7 +320,33 @@ namespace hpx { namespace serialization {
             if (count == 0)
                 return;
             size_ += count;
-            buffer_->save_binary(address, count);
+            save_binary_impl(address, count);
+        }
+
+        // the qualified calls below bypass the virtual function dispatch
+        void save_binary_impl(void const* address, std::size_t count)
+        {
+            using vector_basic_container =
+                output_container<std::vector<char>, detail::basic_chunker>;
+            using vector_chunked_container =
+                output_container<std::vector<char>, detail::vector_chunker>;
+
+            switch (kind_)
+            {
+            case detail::output_container_kind::vector_basic:
+                static_cast<vector_basic_container*>(buffer_.get())
+                    ->vector_basic_container::save_binary(address, count);
+                break;
+
+            case detail::output_container_kind::vector_chunked:
+                static_cast<vector_chunked_container*>(buffer_.get())
+                    ->vector_chunked_container::save_binary(address, count);
+                break;
+
+            default:
+                buffer_->save_binary(address, count);
+                break;
+            }
         }
 
         void save_binary_chunk(void const* address, std::size_t count)
@@ -297,7 +356,7 @@ namespace hpx { namespace serialization {
             if (disable_data_chunking())
             {
                 size_ += count;
-                buffer_->save_binary(address, count);
+                save_binary_impl(address, count);
             }
             else
             {
@@ -307,6 +366,7 @@ namespace hpx { namespace serialization {
         }
 
         std::unique_ptr<erased_output_container> buffer_;
+        detail::output_container_kind kind_;
     };
 }}    // namespace hpx::serialization
 
@@ -294,8 +294,10 @@ namespace hpx { namespace serialization {
         {
             std::size_t written = 0;
 
-            if (access_traits::size(this->cont_) < this->current_)
-                access_traits::resize(this->cont_, this->current_);
+            // the container grows by the given amount of bytes
+            std::size_t const size = access_traits::size(this->cont_);
+            if (size < this->current_)
+                access_traits::resize(this->cont_, this->current_ - size);
 
             this->current_ = start_compressing_at_;
 
@@ -309,14 +311,14 @@ namespace hpx { namespace serialization {
                 if (flushed)
                     break;
 
-                // resize container
-                std::size_t size = access_traits::size(this->cont_);
-                access_traits::resize(this->cont_, 2 * size);
+                // double the size of the container
+                access_traits::resize(
+                    this->cont_, access_traits::size(this->cont_));
 
             } while (true);
 
             // truncate container
-            access_traits::resize(this->cont_, this->current_);
+            access_traits::truncate(this->cont_, this->current_);
         }
 
         void set_filter(binary_filter* filter)    // override
@@ -332,27 +334,27 @@ namespace hpx { namespace serialization {
         {
             HPX_ASSERT(count != 0);
 
-            // during construction the filter may not have been set yet
-            if (filter_ != nullptr)
-                filter_->save(address, count);
+            // during construction the filter may not have been set yet, the
+            // data written up to then (the archive header) is stored as is
+            if (filter_ == nullptr)
+            {
+                this->base_type::save_binary(address, count);
+                return;
+            }
+
+            filter_->save(address, count);
             this->current_ += count;
         }
 
         std::size_t save_binary_chunk(
             void const* address, std::size_t count)    // override
         {
-            if (count < HPX_ZERO_COPY_SERIALIZATION_THRESHOLD)
-            {
-                // fall back to serialization_chunk-less archive
-                HPX_ASSERT(count != 0);
-                filter_->save(address, count);
-                this->current_ += count;
-                return count;
-            }
-            else
-            {
-                return this->base_type::save_binary_chunk(address, count);
-            }
+            // all data is passed through the filter, the receiving end reads
+            // large chunks from the filter as well
+            HPX_ASSERT(count != 0);
+            filter_->save(address, count);
+            this->current_ += count;
+            return count;
         }
 
     protected:
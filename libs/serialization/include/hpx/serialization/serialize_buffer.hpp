@@ -15,12 +15,15 @@
 #include <hpx/serialization/array.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
 
 #include <boost/shared_array.hpp>
 
 #include <algorithm>
 #include <cstddef>
+#include <memory>
 #include <type_traits>
+#include <utility>
 
 namespace hpx { namespace serialization {
 
@@ -292,6 +295,9 @@ namespace hpx { namespace serialization {
             ar >> size_ >> alloc_;
             // -V128
 
+            if (load_zero_copy(ar, can_alias_received_data()))
+                return;
+
             data_.reset(alloc_.allocate(size_), [this](T* p) {
                 serialize_buffer::deleter<allocator_type>(p, alloc_, size_);
             });
@@ -302,6 +308,36 @@ namespace hpx { namespace serialization {
             }
         }
 
+        // The received data can be aliased only if it does not have to be
+        // converted and if it does not need to be allocated with a special
+        // allocator.
+        using can_alias_received_data = std::integral_constant<bool,
+            hpx::traits::is_bitwise_serializable<T>::value &&
+                std::is_same<Allocator, std::allocator<T>>::value>;
+
+        template <typename Archive>
+        bool load_zero_copy(Archive&, std::false_type)
+        {
+            return false;
+        }
+
+        // Refer to the memory of the received zero-copy chunk directly, the
+        // buffer shares the ownership of the chunk.
+        template <typename Archive>
+        bool load_zero_copy(Archive& ar, std::true_type)
+        {
+            std::shared_ptr<void> owner;
+            void const* data =
+                ar.borrow_binary_chunk(size_ * sizeof(T), alignof(T), owner);
+            if (data == nullptr)
+                return false;
+
+            data_ = boost::shared_array<T>(
+                static_cast<T*>(const_cast<void*>(data)),
+                [owner = std::move(owner)](T*) mutable { owner.reset(); });
+            return true;
+        }
+
         HPX_SERIALIZATION_SPLIT_MEMBER()
 
         // this is needed for util::any
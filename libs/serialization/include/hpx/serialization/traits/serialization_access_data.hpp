@@ -55,6 +55,8 @@ namespace hpx { namespace traits {
             return decompressed_size;
         }
 
+        static constexpr void truncate(Container& cont, std::size_t count) {}
+
         static constexpr void reset(Container& cont) {}
     };
 
@@ -73,6 +75,11 @@ namespace hpx { namespace traits {
             return cont.resize(cont.size() + count);
         }
 
+        static void truncate(Container& cont, std::size_t count)
+        {
+            cont.resize(count);
+        }
+
         static void write(Container& cont, std::size_t count,
             std::size_t current, void const* address)
         {
@@ -20,6 +20,7 @@
 
 #include <boost/predef/other/endian.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -343,6 +344,66 @@ void test_zero_copy_serialization(
     test_parcel_serialization(std::move(outp), out_archive_flags, true);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// The receiving end aliases zero-copy chunks if it owns their memory
+template <typename T>
+void test_zero_copy_receive(std::size_t size)
+{
+    std::vector<T> data(size, T(42));
+    hpx::serialization::serialize_buffer<T> outb(data.data(), data.size(),
+        hpx::serialization::serialize_buffer<T>::reference);
+
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    std::vector<char> buffer;
+
+    {
+        hpx::serialization::output_archive archive(buffer, 0U, &chunks);
+        archive << outb;
+    }
+
+    // simulate receiving the zero-copy chunks into separate buffers
+    std::vector<std::shared_ptr<void>> owners(chunks.size());
+    for (std::size_t i = 0; i != chunks.size(); ++i)
+    {
+        if (chunks[i].type_ != hpx::serialization::chunk_type_pointer)
+            continue;
+
+        char const* p = static_cast<char const*>(chunks[i].data_.cpos_);
+        auto received =
+            std::make_shared<std::vector<char>>(p, p + chunks[i].size_);
+        chunks[i] = hpx::serialization::create_pointer_chunk(
+            received->data(), received->size());
+        owners[i] = std::move(received);
+    }
+
+    hpx::serialization::serialize_buffer<T> inb;
+    {
+        hpx::serialization::input_archive archive(
+            buffer, buffer.size(), &chunks, &owners);
+        archive >> inb;
+    }
+
+    // large arrays are sent as pointer chunks, those are not copied
+    bool const is_zero_copy =
+        size * sizeof(T) >= HPX_ZERO_COPY_SERIALIZATION_THRESHOLD;
+    bool aliased = false;
+    for (auto const& c : chunks)
+    {
+        if (c.type_ == hpx::serialization::chunk_type_pointer &&
+            c.data_.cpos_ == static_cast<void const*>(inb.data()))
+        {
+            aliased = true;
+        }
+    }
+    HPX_TEST_EQ(is_zero_copy, aliased);
+
+    // the buffer keeps the received data alive
+    owners.clear();
+
+    HPX_TEST_EQ(inb.size(), size);
+    HPX_TEST(std::equal(inb.begin(), inb.end(), data.begin()));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -374,6 +435,9 @@ int hpx_main(hpx::program_options::variables_map& vm)
         data_buffer<double> buffer3(size << i);
         test_normal_serialization<test_action4>(buffer3);
         test_zero_copy_serialization<test_action4>(buffer3);
+
+        test_zero_copy_receive<double>(size << i);
+        test_zero_copy_receive<char>(size << i);
     }
 
     return hpx::finalize();
@@ -13,9 +13,11 @@
 #include <hpx/assertion.hpp>
 #include <hpx/concurrency.hpp>
 #include <hpx/errors.hpp>
+#include <hpx/synchronization/detail/channel_waiters.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/thread_support.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <mutex>
@@ -28,6 +30,10 @@ namespace hpx { namespace lcos { namespace local {
     // This channel is bounded to a size given at construction time and supports
     // multiple producers and multiple consumers. The data is stored in a
     // ring-buffer.
+    //
+    // The blocking operations suspend the calling HPX thread while the
+    // channel is empty (or full). The peers wake it up without taking an
+    // additional lock if no thread is waiting.
     template <typename T, typename Mutex = util::spinlock>
     class bounded_channel
     {
@@ -49,6 +55,13 @@ namespace hpx { namespace lcos { namespace local {
             return head == tail_.data_;
         }
 
+        std::size_t num_items() const noexcept
+        {
+            std::size_t head = head_.data_;
+            std::size_t tail = tail_.data_;
+            return tail >= head ? tail - head : size_ - head + tail;
+        }
+
     public:
         explicit bounded_channel(std::size_t size)
           : size_(size + 1)
@@ -132,6 +145,9 @@ namespace hpx { namespace lcos { namespace local {
             }
             head_.data_ = head;
 
+            l.unlock();
+            not_full_.notify_all();
+
             return true;
         }
 
@@ -157,13 +173,134 @@ namespace hpx { namespace lcos { namespace local {
             }
             tail_.data_ = tail;
 
+            l.unlock();
+            not_empty_.notify_all();
+
             return true;
         }
 
-        std::size_t close()
+        // Retrieve up to n items, return the number of retrieved items.
+        std::size_t get_n(T* vals, std::size_t n) const noexcept
         {
             std::unique_lock<mutex_type> l(mtx_.data_);
-            return close(l);
+            if (closed_)
+            {
+                return 0;
+            }
+
+            std::size_t count = (std::min)(n, num_items());
+            if (count == 0)
+            {
+                return 0;
+            }
+
+            std::size_t head = head_.data_;
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                vals[i] = std::move(buffer_[head]);
+                if (++head >= size_)
+                {
+                    head = 0;
+                }
+            }
+            head_.data_ = head;
+
+            l.unlock();
+            not_full_.notify_all();
+
+            return count;
+        }
+
+        // Store up to n items, return the number of stored items.
+        std::size_t set_n(T* vals, std::size_t n) noexcept
+        {
+            std::unique_lock<mutex_type> l(mtx_.data_);
+            if (closed_)
+            {
+                return 0;
+            }
+
+            std::size_t count = (std::min)(n, size_ - 1 - num_items());
+            if (count == 0)
+            {
+                return 0;
+            }
+
+            std::size_t tail = tail_.data_;
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                buffer_[tail] = std::move(vals[i]);
+                if (++tail >= size_)
+                {
+                    tail = 0;
+                }
+            }
+            tail_.data_ = tail;
+
+            l.unlock();
+            not_empty_.notify_all();
+
+            return count;
+        }
+
+        // Retrieve the next item, suspending the calling HPX thread while
+        // the channel is empty. Return false if the channel was closed.
+        bool get_blocking(T* val = nullptr) const
+        {
+            bool closed = false;
+            while (!get(val))
+            {
+                not_empty_.wait(
+                    [&, this]() {
+                        std::unique_lock<mutex_type> l(mtx_.data_);
+                        closed = closed_;
+                        return closed || !is_empty(head_.data_);
+                    },
+                    "hpx::lcos::local::bounded_channel::get_blocking");
+
+                if (closed)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Store the given item, suspending the calling HPX thread while the
+        // channel is full. Return false if the channel was closed.
+        bool set_blocking(T&& t)
+        {
+            bool closed = false;
+            while (!set(std::move(t)))
+            {
+                not_full_.wait(
+                    [&, this]() {
+                        std::unique_lock<mutex_type> l(mtx_.data_);
+                        closed = closed_;
+                        return closed || !is_full(tail_.data_);
+                    },
+                    "hpx::lcos::local::bounded_channel::set_blocking");
+
+                if (closed)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        std::size_t close()
+        {
+            std::size_t result = 0;
+
+            {
+                std::unique_lock<mutex_type> l(mtx_.data_);
+                result = close(l);
+            }
+
+            not_empty_.notify_all();
+            not_full_.notify_all();
+            return result;
         }
 
         std::size_t capacity() const
@@ -203,6 +340,10 @@ namespace hpx { namespace lcos { namespace local {
 
         // this channel was closed, i.e. no further operations are possible
         bool closed_;
+
+        // threads waiting for the channel to become non-empty or non-full
+        mutable detail::channel_waiters not_empty_;
+        mutable detail::channel_waiters not_full_;
     };
 
     ////////////////////////////////////////////////////////////////////////////
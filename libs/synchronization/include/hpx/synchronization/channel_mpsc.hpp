@@ -13,9 +13,11 @@
 #include <hpx/assertion.hpp>
 #include <hpx/concurrency.hpp>
 #include <hpx/errors.hpp>
+#include <hpx/synchronization/detail/channel_waiters.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/thread_support.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <memory>
@@ -29,6 +31,10 @@ namespace hpx { namespace lcos { namespace local {
     // This channel is bounded to a size given at construction time and supports
     // a multiple producers and a single consumer. The data is stored in a
     // ring-buffer.
+    //
+    // The blocking operations suspend the calling HPX thread while the
+    // channel is empty (or full). The peers wake it up without taking a lock
+    // if no thread is waiting.
     template <typename T, typename Mutex = util::spinlock>
     class base_channel_mpsc
     {
@@ -38,7 +44,7 @@ namespace hpx { namespace lcos { namespace local {
         bool is_full(std::size_t tail) const noexcept
         {
             std::size_t numitems =
-                size_ + tail - head_.data_.load(std::memory_order_relaxed);
+                size_ + tail - head_.data_.load(std::memory_order_acquire);
 
             if (numitems < size_)
             {
@@ -49,7 +55,13 @@ namespace hpx { namespace lcos { namespace local {
 
         bool is_empty(std::size_t head) const noexcept
         {
-            return head == tail_.data_.tail_.load(std::memory_order_relaxed);
+            return head == tail_.data_.tail_.load(std::memory_order_acquire);
+        }
+
+        std::size_t num_items(std::size_t head, std::size_t tail) const
+            noexcept
+        {
+            return tail >= head ? tail - head : size_ - head + tail;
         }
 
     public:
@@ -142,6 +154,7 @@ namespace hpx { namespace lcos { namespace local {
                 head = 0;
             }
             head_.data_.store(head, std::memory_order_release);
+            not_full_.notify_all();
 
             return true;
         }
@@ -153,23 +166,142 @@ namespace hpx { namespace lcos { namespace local {
                 return false;
             }
 
-            std::unique_lock<mutex_type> l(tail_.data_.mtx_);
+            {
+                std::unique_lock<mutex_type> l(tail_.data_.mtx_);
+
+                std::size_t tail =
+                    tail_.data_.tail_.load(std::memory_order_acquire);
+
+                if (is_full(tail))
+                {
+                    return false;
+                }
+
+                buffer_[tail] = std::move(t);
+                if (++tail >= size_)
+                {
+                    tail = 0;
+                }
+                tail_.data_.tail_.store(tail, std::memory_order_release);
+            }
 
-            std::size_t tail =
-                tail_.data_.tail_.load(std::memory_order_acquire);
+            not_empty_.notify_all();
+            return true;
+        }
 
-            if (is_full(tail))
+        // Retrieve up to n items, return the number of retrieved items.
+        std::size_t get_n(T* vals, std::size_t n) const noexcept
+        {
+            if (closed_.load(std::memory_order_relaxed))
             {
-                return false;
+                return 0;
+            }
+
+            std::size_t head = head_.data_.load(std::memory_order_relaxed);
+            std::size_t count = (std::min)(n,
+                num_items(
+                    head, tail_.data_.tail_.load(std::memory_order_acquire)));
+
+            if (count == 0)
+            {
+                return 0;
+            }
+
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                vals[i] = std::move(buffer_[head]);
+                if (++head >= size_)
+                {
+                    head = 0;
+                }
+            }
+            head_.data_.store(head, std::memory_order_release);
+            not_full_.notify_all();
+
+            return count;
+        }
+
+        // Store up to n items, return the number of stored items.
+        std::size_t set_n(T* vals, std::size_t n) noexcept
+        {
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                return 0;
+            }
+
+            std::size_t count = 0;
+
+            {
+                std::unique_lock<mutex_type> l(tail_.data_.mtx_);
+
+                std::size_t tail =
+                    tail_.data_.tail_.load(std::memory_order_acquire);
+                count = (std::min)(n,
+                    size_ - 1 -
+                        num_items(head_.data_.load(std::memory_order_acquire),
+                            tail));
+
+                if (count == 0)
+                {
+                    return 0;
+                }
+
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    buffer_[tail] = std::move(vals[i]);
+                    if (++tail >= size_)
+                    {
+                        tail = 0;
+                    }
+                }
+                tail_.data_.tail_.store(tail, std::memory_order_release);
             }
 
-            buffer_[tail] = std::move(t);
-            if (++tail >= size_)
+            not_empty_.notify_all();
+            return count;
+        }
+
+        // Retrieve the next item, suspending the calling HPX thread while
+        // the channel is empty. Return false if the channel was closed.
+        bool get_blocking(T* val = nullptr) const
+        {
+            while (!get(val))
             {
-                tail = 0;
+                if (closed_.load(std::memory_order_relaxed))
+                {
+                    return false;
+                }
+
+                not_empty_.wait(
+                    [this]() {
+                        return closed_.load(std::memory_order_relaxed) ||
+                            !is_empty(
+                                head_.data_.load(std::memory_order_relaxed));
+                    },
+                    "hpx::lcos::local::base_channel_mpsc::get_blocking");
             }
-            tail_.data_.tail_.store(tail, std::memory_order_relaxed);
+            return true;
+        }
 
+        // Store the given item, suspending the calling HPX thread while the
+        // channel is full. Return false if the channel was closed.
+        bool set_blocking(T&& t)
+        {
+            while (!set(std::move(t)))
+            {
+                if (closed_.load(std::memory_order_relaxed))
+                {
+                    return false;
+                }
+
+                not_full_.wait(
+                    [this]() {
+                        return closed_.load(std::memory_order_relaxed) ||
+                            !is_full(tail_.data_.tail_.load(
+                                std::memory_order_relaxed));
+                    },
+                    "hpx::lcos::local::base_channel_mpsc::set_blocking");
+            }
             return true;
         }
 
@@ -182,6 +314,9 @@ namespace hpx { namespace lcos { namespace local {
                     "hpx::lcos::local::base_channel_mpsc::close",
                     "attempting to close an already closed channel");
             }
+
+            not_empty_.notify_all();
+            not_full_.notify_all();
             return 0;
         }
 
@@ -210,6 +345,10 @@ namespace hpx { namespace lcos { namespace local {
 
         // this channel was closed, i.e. no further operations are possible
         std::atomic<bool> closed_;
+
+        // threads waiting for the channel to become non-empty or non-full
+        mutable detail::channel_waiters not_empty_;
+        mutable detail::channel_waiters not_full_;
     };
 
     ////////////////////////////////////////////////////////////////////////////
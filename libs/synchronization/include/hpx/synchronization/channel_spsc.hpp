@@ -13,7 +13,9 @@
 #include <hpx/assertion.hpp>
 #include <hpx/concurrency.hpp>
 #include <hpx/errors.hpp>
+#include <hpx/synchronization/detail/channel_waiters.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <memory>
@@ -26,6 +28,10 @@ namespace hpx { namespace lcos { namespace local {
     // This channel is bounded to a size given at construction time and supports
     // a single producer and a single consumer. The data is stored in a
     // ring-buffer.
+    //
+    // The blocking operations suspend the calling HPX thread while the
+    // channel is empty (or full). The peer wakes it up without taking a lock
+    // if no thread is waiting.
     template <typename T>
     class channel_spsc
     {
@@ -47,6 +53,12 @@ namespace hpx { namespace lcos { namespace local {
             return head == tail_.data_.load(std::memory_order_acquire);
         }
 
+        std::size_t num_items(std::size_t head, std::size_t tail) const
+            noexcept
+        {
+            return tail >= head ? tail - head : size_ - head + tail;
+        }
+
     public:
         explicit channel_spsc(std::size_t size)
           : size_(size + 1)
@@ -135,6 +147,7 @@ namespace hpx { namespace lcos { namespace local {
                 head = 0;
             }
             head_.data_.store(head, std::memory_order_release);
+            not_full_.notify_all();
 
             return true;
         }
@@ -159,10 +172,119 @@ namespace hpx { namespace lcos { namespace local {
                 tail = 0;
             }
             tail_.data_.store(tail, std::memory_order_release);
+            not_empty_.notify_all();
 
             return true;
         }
 
+        // Retrieve up to n items, return the number of retrieved items.
+        std::size_t get_n(T* vals, std::size_t n) const noexcept
+        {
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                return 0;
+            }
+
+            std::size_t head = head_.data_.load(std::memory_order_relaxed);
+            std::size_t count = (std::min)(n,
+                num_items(head, tail_.data_.load(std::memory_order_acquire)));
+
+            if (count == 0)
+            {
+                return 0;
+            }
+
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                vals[i] = std::move(buffer_[head]);
+                if (++head >= size_)
+                {
+                    head = 0;
+                }
+            }
+            head_.data_.store(head, std::memory_order_release);
+            not_full_.notify_all();
+
+            return count;
+        }
+
+        // Store up to n items, return the number of stored items.
+        std::size_t set_n(T* vals, std::size_t n) noexcept
+        {
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                return 0;
+            }
+
+            std::size_t tail = tail_.data_.load(std::memory_order_relaxed);
+            std::size_t count = (std::min)(n,
+                size_ - 1 -
+                    num_items(
+                        head_.data_.load(std::memory_order_acquire), tail));
+
+            if (count == 0)
+            {
+                return 0;
+            }
+
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                buffer_[tail] = std::move(vals[i]);
+                if (++tail >= size_)
+                {
+                    tail = 0;
+                }
+            }
+            tail_.data_.store(tail, std::memory_order_release);
+            not_empty_.notify_all();
+
+            return count;
+        }
+
+        // Retrieve the next item, suspending the calling HPX thread while
+        // the channel is empty. Return false if the channel was closed.
+        bool get_blocking(T* val = nullptr) const
+        {
+            while (!get(val))
+            {
+                if (closed_.load(std::memory_order_relaxed))
+                {
+                    return false;
+                }
+
+                not_empty_.wait(
+                    [this]() {
+                        return closed_.load(std::memory_order_relaxed) ||
+                            !is_empty(
+                                head_.data_.load(std::memory_order_relaxed));
+                    },
+                    "hpx::lcos::local::channel_spsc::get_blocking");
+            }
+            return true;
+        }
+
+        // Store the given item, suspending the calling HPX thread while the
+        // channel is full. Return false if the channel was closed.
+        bool set_blocking(T&& t)
+        {
+            while (!set(std::move(t)))
+            {
+                if (closed_.load(std::memory_order_relaxed))
+                {
+                    return false;
+                }
+
+                not_full_.wait(
+                    [this]() {
+                        return closed_.load(std::memory_order_relaxed) ||
+                            !is_full(
+                                tail_.data_.load(std::memory_order_relaxed));
+                    },
+                    "hpx::lcos::local::channel_spsc::set_blocking");
+            }
+            return true;
+        }
+
         std::size_t close()
         {
             bool expected = false;
@@ -172,6 +294,9 @@ namespace hpx { namespace lcos { namespace local {
                     "hpx::lcos::local::channel_spsc::close",
                     "attempting to close an already closed channel");
             }
+
+            not_empty_.notify_all();
+            not_full_.notify_all();
             return 0;
         }
 
@@ -194,6 +319,10 @@ namespace hpx { namespace lcos { namespace local {
 
         // this channel was closed, i.e. no further operations are possible
         std::atomic<bool> closed_;
+
+        // threads waiting for the channel to become non-empty or non-full
+        mutable detail::channel_waiters not_empty_;
+        mutable detail::channel_waiters not_full_;
     };
 }}}    // namespace hpx::lcos::local
 
@@ -0,0 +1,89 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_LOCAL_DETAIL_CHANNEL_WAITERS_HPP)
+#define HPX_LCOS_LOCAL_DETAIL_CHANNEL_WAITERS_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/synchronization/detail/condition_variable.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <utility>
+
+namespace hpx { namespace lcos { namespace local { namespace detail {
+    // HPX threads waiting for a ring buffer channel to become non-empty (or
+    // non-full). The waiters announce themselves before re-checking the
+    // channel, which allows the peer to skip taking the lock if nobody is
+    // waiting.
+    class channel_waiters
+    {
+    private:
+        using mutex_type = lcos::local::spinlock;
+
+        struct register_waiter
+        {
+            explicit register_waiter(std::atomic<std::size_t>& waiting)
+              : waiting_(waiting)
+            {
+                waiting_.fetch_add(1, std::memory_order_relaxed);
+
+                // pairs with the fence in notify_all
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+
+            ~register_waiter()
+            {
+                waiting_.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            std::atomic<std::size_t>& waiting_;
+        };
+
+    public:
+        channel_waiters()
+          : waiting_(0)
+        {
+        }
+
+        // Suspend the calling HPX thread until ready() returns true. ready()
+        // is invoked with the internal lock held.
+        template <typename F>
+        void wait(F&& ready, char const* description)
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            register_waiter r(waiting_);
+
+            while (!ready())
+            {
+                cond_.wait(l, description);
+            }
+        }
+
+        // Wake up all waiting threads. This has to be called after the
+        // change to the channel was published.
+        void notify_all()
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (waiting_.load(std::memory_order_relaxed) == 0)
+            {
+                return;
+            }
+
+            std::unique_lock<mutex_type> l(mtx_);
+            cond_.notify_all(std::move(l));
+        }
+
+    private:
+        mutex_type mtx_;
+        condition_variable cond_;
+        std::atomic<std::size_t> waiting_;
+    };
+}}}}    // namespace hpx::lcos::local::detail
+
+#endif
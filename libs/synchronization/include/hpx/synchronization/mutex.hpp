@@ -17,6 +17,9 @@
 #include <hpx/threading_base.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
+#include <cstddef>
+#include <cstdint>
+
 namespace hpx { namespace threads {
 
     using thread_id_type = thread_id;
@@ -32,6 +35,14 @@ namespace hpx { namespace threads {
 
 namespace hpx { namespace lcos { namespace local {
     ///////////////////////////////////////////////////////////////////////////
+    /// A mutex suspending the calling HPX thread if the lock is not available.
+    ///
+    /// A thread trying to acquire a locked mutex spins for a short while as
+    /// long as the owner of the lock is running, it is suspended only after
+    /// that. Unlocking the mutex resumes the longest waiting thread and hands
+    /// the lock directly to it. Setting a fairness bound allows spinning
+    /// threads to acquire the lock ahead of suspended ones at most that many
+    /// times in a row before the lock is handed off again.
     class mutex
     {
     public:
@@ -62,10 +73,42 @@ namespace hpx { namespace lcos { namespace local {
 
         HPX_EXPORT void unlock(error_code& ec = throws);
 
+        /// Set the number of times threads not suspended on this mutex may
+        /// acquire it while other threads are suspended waiting for it. The
+        /// default of zero hands the lock to the longest waiting thread on
+        /// each contended unlock.
+        HPX_EXPORT void set_fairness_bound(std::size_t bound);
+
+        /// Return the number of lock acquisitions which found the mutex
+        /// locked.
+        HPX_EXPORT std::int64_t get_contention_count(bool reset = false);
+
+        /// Return the number of times the lock was handed directly to a
+        /// waiting thread.
+        HPX_EXPORT std::int64_t get_handoff_count(bool reset = false);
+
     protected:
+        bool is_available() const
+        {
+            return owner_id_ == threads::invalid_thread_id && !handoff_pending_;
+        }
+
+        bool owner_is_running() const;
+
+        // acquire the lock for the calling thread, mtx_ has to be held
+        void acquire(std::unique_lock<mutex_type> const& l,
+            threads::thread_id_type const& self_id);
+
         mutable mutex_type mtx_;
         threads::thread_id_type owner_id_;
         detail::condition_variable cond_;
+
+        std::size_t fairness_bound_;
+        std::size_t bypass_count_;
+        bool handoff_pending_;
+
+        std::int64_t contention_count_;
+        std::int64_t handoff_count_;
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -83,6 +126,10 @@ namespace hpx { namespace lcos { namespace local {
         using mutex::try_lock;
         using mutex::unlock;
 
+        using mutex::get_contention_count;
+        using mutex::get_handoff_count;
+        using mutex::set_fairness_bound;
+
         HPX_EXPORT bool try_lock_until(util::steady_time_point const& abs_time,
             char const* description, error_code& ec = throws);
 
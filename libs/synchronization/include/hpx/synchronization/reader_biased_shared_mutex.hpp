@@ -0,0 +1,151 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_LOCAL_READER_BIASED_SHARED_MUTEX_HPP)
+#define HPX_LCOS_LOCAL_READER_BIASED_SHARED_MUTEX_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/basic_execution/this_thread.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/synchronization/mutex.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+namespace hpx { namespace lcos { namespace local {
+    namespace detail {
+        // A shared mutex optimized for read-mostly data. Every worker thread
+        // announces its readers in a separate cache line, so acquiring and
+        // releasing a shared lock touches shared state only while a writer
+        // holds or waits for the lock.
+        //
+        // Writers are serialized through Mutex (suspending the HPX thread if
+        // needed). A writer announces itself, after which new readers block
+        // on Mutex as well, and then waits for the announced readers to
+        // drain.
+        //
+        // An HPX thread holding a shared lock may be resumed on a different
+        // worker thread, so unlock_shared() may release the reader in another
+        // slot than lock_shared() has acquired it. Only the sum over all
+        // slots is meaningful, the individual counters may wrap around.
+        template <typename Mutex = lcos::local::mutex>
+        class reader_biased_shared_mutex
+        {
+        private:
+            typedef Mutex mutex_type;
+            typedef util::cache_line_data<std::atomic<std::size_t>>
+                reader_slot;
+
+            reader_slot& get_slot() noexcept
+            {
+                // get_worker_thread_num() returns std::size_t(-1) for
+                // threads not managed by HPX
+                return readers_[get_worker_thread_num() % num_slots_];
+            }
+
+            bool has_readers() const noexcept
+            {
+                std::size_t readers = 0;
+                for (std::size_t i = 0; i != num_slots_; ++i)
+                {
+                    readers +=
+                        readers_[i].data_.load(std::memory_order_seq_cst);
+                }
+                return readers != 0;
+            }
+
+        public:
+            reader_biased_shared_mutex()
+              : num_slots_((std::max)(
+                    threads::hardware_concurrency(), std::size_t(1)))
+              , readers_(new reader_slot[num_slots_])
+              , writer_(false)
+            {
+                for (std::size_t i = 0; i != num_slots_; ++i)
+                {
+                    readers_[i].data_.store(0, std::memory_order_relaxed);
+                }
+            }
+
+            reader_biased_shared_mutex(
+                reader_biased_shared_mutex const&) = delete;
+            reader_biased_shared_mutex& operator=(
+                reader_biased_shared_mutex const&) = delete;
+
+            bool try_lock_shared()
+            {
+                reader_slot& slot = get_slot();
+
+                slot.data_.fetch_add(1, std::memory_order_seq_cst);
+                if (!writer_.load(std::memory_order_seq_cst))
+                    return true;
+
+                // a writer holds or waits for the lock, back off
+                slot.data_.fetch_sub(1, std::memory_order_release);
+                return false;
+            }
+
+            void lock_shared()
+            {
+                if (try_lock_shared())
+                    return;
+
+                // writers announce themselves only while holding the mutex
+                std::lock_guard<mutex_type> l(mtx_);
+                get_slot().data_.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void unlock_shared()
+            {
+                get_slot().data_.fetch_sub(1, std::memory_order_release);
+            }
+
+            void lock()
+            {
+                mtx_.lock();
+                writer_.store(true, std::memory_order_seq_cst);
+
+                util::yield_while([this]() { return has_readers(); },
+                    "reader_biased_shared_mutex::lock");
+            }
+
+            bool try_lock()
+            {
+                if (!mtx_.try_lock())
+                    return false;
+
+                writer_.store(true, std::memory_order_seq_cst);
+                if (!has_readers())
+                    return true;
+
+                writer_.store(false, std::memory_order_relaxed);
+                mtx_.unlock();
+                return false;
+            }
+
+            void unlock()
+            {
+                writer_.store(false, std::memory_order_release);
+                mtx_.unlock();
+            }
+
+        private:
+            std::size_t const num_slots_;
+            std::unique_ptr<reader_slot[]> readers_;
+            std::atomic<bool> writer_;
+            mutex_type mtx_;
+        };
+    }    // namespace detail
+
+    typedef detail::reader_biased_shared_mutex<> reader_biased_shared_mutex;
+}}}    // namespace hpx::lcos::local
+
+#endif
@@ -17,13 +17,37 @@
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <mutex>
 #include <utility>
 
 namespace hpx { namespace lcos { namespace local {
+    namespace detail {
+        // the number of times a thread trying to acquire a mutex which is
+        // owned by a running thread checks for it to become available before
+        // suspending
+        constexpr std::size_t mutex_spin_count = 16;
+
+        inline void mutex_spin_pause(std::size_t k)
+        {
+            for (std::size_t i = std::size_t(1) << (std::min)(k, std::size_t(6));
+                 i != 0; --i)
+            {
+                HPX_SMT_PAUSE;
+            }
+        }
+    }    // namespace detail
+
     ///////////////////////////////////////////////////////////////////////////
     mutex::mutex(char const* const description)
       : owner_id_(threads::invalid_thread_id)
+      , fairness_bound_(0)
+      , bypass_count_(0)
+      , handoff_pending_(false)
+      , contention_count_(0)
+      , handoff_count_(0)
     {
         HPX_ITT_SYNC_CREATE(this, "lcos::local::mutex", description);
         HPX_ITT_SYNC_RENAME(this, "lcos::local::mutex");
@@ -34,6 +58,25 @@ namespace hpx { namespace lcos { namespace local {
         HPX_ITT_SYNC_DESTROY(this);
     }
 
+    bool mutex::owner_is_running() const
+    {
+        return owner_id_ != threads::invalid_thread_id &&
+            threads::get_thread_id_data(owner_id_)->get_state().state() ==
+            threads::active;
+    }
+
+    void mutex::acquire(std::unique_lock<mutex_type> const& l,
+        threads::thread_id_type const& self_id)
+    {
+        // acquiring an available lock while others are waiting bypasses them
+        if (!cond_.empty(l))
+            ++bypass_count_;
+
+        util::register_lock(this);
+        HPX_ITT_SYNC_ACQUIRED(this);
+        owner_id_ = self_id;
+    }
+
     void mutex::lock(char const* description, error_code& ec)
     {
         HPX_ASSERT(threads::get_self_ptr() != nullptr);
@@ -50,14 +93,47 @@ namespace hpx { namespace lcos { namespace local {
             return;
         }
 
-        while (owner_id_ != threads::invalid_thread_id)
+        if (is_available())
+        {
+            acquire(l, self_id);
+            return;
+        }
+
+        ++contention_count_;
+
+        // spin while the owner is running, unless this would bypass waiting
+        // threads more often than allowed
+        for (std::size_t k = 0; k != detail::mutex_spin_count &&
+             owner_is_running() &&
+             (cond_.empty(l) || bypass_count_ < fairness_bound_);
+             ++k)
+        {
+            l.unlock();
+            detail::mutex_spin_pause(k);
+            l.lock();
+
+            if (is_available())
+            {
+                acquire(l, self_id);
+                return;
+            }
+        }
+
+        while (!is_available())
         {
-            cond_.wait(l, ec);
+            threads::thread_state_ex_enum const reason = cond_.wait(l, ec);
             if (ec)
             {
                 HPX_ITT_SYNC_CANCEL(this);
                 return;
             }
+
+            // the lock may have been handed to this thread by unlock
+            if (reason == threads::wait_signaled && handoff_pending_)
+            {
+                handoff_pending_ = false;
+                break;
+            }
         }
 
         util::register_lock(this);
@@ -72,16 +148,13 @@ namespace hpx { namespace lcos { namespace local {
         HPX_ITT_SYNC_PREPARE(this);
         std::unique_lock<mutex_type> l(mtx_);
 
-        if (owner_id_ != threads::invalid_thread_id)
+        if (!is_available())
         {
             HPX_ITT_SYNC_CANCEL(this);
             return false;
         }
 
-        threads::thread_id_type self_id = threads::get_self_id();
-        util::register_lock(this);
-        HPX_ITT_SYNC_ACQUIRED(this);
-        owner_id_ = self_id;
+        acquire(l, threads::get_self_id());
         return true;
     }
 
@@ -105,12 +178,52 @@ namespace hpx { namespace lcos { namespace local {
         HPX_ITT_SYNC_RELEASED(this);
         owner_id_ = threads::invalid_thread_id;
 
+        if (cond_.empty(l))
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+            return;
+        }
+
+        // hand the lock to the longest waiting thread, unless others may
+        // still acquire it ahead of the waiting threads
+        if (bypass_count_ >= fairness_bound_)
+        {
+            handoff_pending_ = true;
+            bypass_count_ = 0;
+            ++handoff_count_;
+        }
+
         {
             util::ignore_while_checking<std::unique_lock<mutex_type>> il(&l);
             cond_.notify_one(std::move(l), threads::thread_priority_boost, ec);
         }
     }
 
+    void mutex::set_fairness_bound(std::size_t bound)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        fairness_bound_ = bound;
+    }
+
+    std::int64_t mutex::get_contention_count(bool reset)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        std::int64_t const result = contention_count_;
+        if (reset)
+            contention_count_ = 0;
+        return result;
+    }
+
+    std::int64_t mutex::get_handoff_count(bool reset)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        std::int64_t const result = handoff_count_;
+        if (reset)
+            handoff_count_ = 0;
+        return result;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     timed_mutex::timed_mutex(char const* const description)
       : mutex(description)
@@ -128,27 +241,31 @@ namespace hpx { namespace lcos { namespace local {
         std::unique_lock<mutex_type> l(mtx_);
 
         threads::thread_id_type self_id = threads::get_self_id();
-        if (owner_id_ != threads::invalid_thread_id)
+        if (is_available())
         {
-            threads::thread_state_ex_enum const reason =
-                cond_.wait_until(l, abs_time, ec);
-            if (ec)
-            {
-                HPX_ITT_SYNC_CANCEL(this);
-                return false;
-            }
+            acquire(l, self_id);
+            return true;
+        }
 
-            if (reason == threads::wait_timeout)    //-V110
-            {
-                HPX_ITT_SYNC_CANCEL(this);
-                return false;
-            }
+        ++contention_count_;
 
-            if (owner_id_ != threads::invalid_thread_id)    //-V110
-            {
-                HPX_ITT_SYNC_CANCEL(this);
-                return false;
-            }
+        threads::thread_state_ex_enum const reason =
+            cond_.wait_until(l, abs_time, ec);
+        if (ec)
+        {
+            HPX_ITT_SYNC_CANCEL(this);
+            return false;
+        }
+
+        // the lock may have been handed to this thread by unlock
+        if (reason == threads::wait_signaled && handoff_pending_)
+        {
+            handoff_pending_ = false;
+        }
+        else if (reason == threads::wait_timeout || !is_available())    //-V110
+        {
+            HPX_ITT_SYNC_CANCEL(this);
+            return false;
         }
 
         util::register_lock(this);
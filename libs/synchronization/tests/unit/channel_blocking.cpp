@@ -0,0 +1,178 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_main.hpp>
+#include <hpx/synchronization/channel_mpmc.hpp>
+#include <hpx/synchronization/channel_mpsc.hpp>
+#include <hpx/synchronization/channel_spsc.hpp>
+
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+constexpr int NUM_ITEMS = 10000;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Channel>
+void produce(Channel& c, int first, int last)
+{
+    for (int i = first; i != last; ++i)
+    {
+        HPX_TEST(c.set_blocking(int(i)));
+    }
+}
+
+template <typename Channel>
+void consume_in_order(Channel& c)
+{
+    for (int i = 0; i != NUM_ITEMS; ++i)
+    {
+        int val = -1;
+        HPX_TEST(c.get_blocking(&val));
+        HPX_TEST_EQ(val, i);
+    }
+}
+
+// a single producer and a single consumer through a very small ring, both
+// sides have to suspend repeatedly
+template <typename Channel>
+void test_blocking_single()
+{
+    Channel c(2);
+
+    hpx::future<void> producer =
+        hpx::async(&produce<Channel>, std::ref(c), 0, NUM_ITEMS);
+    hpx::future<void> consumer =
+        hpx::async(&consume_in_order<Channel>, std::ref(c));
+
+    hpx::wait_all(producer, consumer);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Channel>
+long long consume_sum(Channel& c, int count)
+{
+    long long sum = 0;
+    for (int i = 0; i != count; ++i)
+    {
+        int val = 0;
+        HPX_TEST(c.get_blocking(&val));
+        sum += val;
+    }
+    return sum;
+}
+
+template <typename Channel>
+void test_blocking_multiple_producers(int num_consumers)
+{
+    constexpr int num_producers = 4;
+    constexpr int items_per_producer = NUM_ITEMS / num_producers;
+
+    Channel c(3);
+
+    std::vector<hpx::future<void>> producers;
+    for (int i = 0; i != num_producers; ++i)
+    {
+        producers.push_back(hpx::async(&produce<Channel>, std::ref(c),
+            i * items_per_producer, (i + 1) * items_per_producer));
+    }
+
+    std::vector<hpx::future<long long>> consumers;
+    for (int i = 0; i != num_consumers; ++i)
+    {
+        consumers.push_back(hpx::async(&consume_sum<Channel>, std::ref(c),
+            num_producers * items_per_producer / num_consumers));
+    }
+
+    hpx::wait_all(producers);
+
+    long long sum = 0;
+    for (auto& f : consumers)
+    {
+        sum += f.get();
+    }
+
+    long long n = num_producers * items_per_producer;
+    HPX_TEST_EQ(sum, n * (n - 1) / 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Channel>
+void test_close_wakes_consumer()
+{
+    Channel c(1);
+
+    hpx::future<bool> consumer =
+        hpx::async([&c]() -> bool { return c.get_blocking(); });
+
+    hpx::this_thread::yield();
+    c.close();
+
+    HPX_TEST(!consumer.get());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Channel>
+void test_batch()
+{
+    Channel c(10);
+
+    std::vector<int> values(15);
+    for (int i = 0; i != 15; ++i)
+    {
+        values[i] = i;
+    }
+
+    // only as many items as fit into the channel are stored
+    HPX_TEST_EQ(c.set_n(values.data(), values.size()), std::size_t(10));
+
+    std::vector<int> result(15, -1);
+    HPX_TEST_EQ(c.get_n(result.data(), 4), std::size_t(4));
+    for (int i = 0; i != 4; ++i)
+    {
+        HPX_TEST_EQ(result[i], i);
+    }
+
+    // the stored items wrap around the end of the ring
+    HPX_TEST_EQ(c.set_n(values.data() + 10, 5), std::size_t(4));
+
+    HPX_TEST_EQ(c.get_n(result.data() + 4, 15), std::size_t(10));
+    for (int i = 4; i != 14; ++i)
+    {
+        HPX_TEST_EQ(result[i], i);
+    }
+
+    HPX_TEST_EQ(c.get_n(result.data(), 15), std::size_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    using hpx::lcos::local::channel_mpmc;
+    using hpx::lcos::local::channel_mpsc;
+    using hpx::lcos::local::channel_spsc;
+
+    test_blocking_single<channel_spsc<int>>();
+    test_blocking_single<channel_mpsc<int>>();
+    test_blocking_single<channel_mpmc<int>>();
+
+    test_blocking_multiple_producers<channel_mpsc<int>>(1);
+    test_blocking_multiple_producers<channel_mpmc<int>>(4);
+
+    test_close_wakes_consumer<channel_spsc<int>>();
+    test_close_wakes_consumer<channel_mpsc<int>>();
+    test_close_wakes_consumer<channel_mpmc<int>>();
+
+    test_batch<channel_spsc<int>>();
+    test_batch<channel_mpsc<int>>();
+    test_batch<channel_mpmc<int>>();
+
+    return hpx::util::report_errors();
+}
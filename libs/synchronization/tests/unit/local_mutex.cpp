@@ -9,6 +9,8 @@
 
 #include <hpx/functional/bind.hpp>
 #include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/lcos/wait_all.hpp>
 #include <hpx/runtime/threads/threadmanager.hpp>
 #include <hpx/synchronization/condition_variable.hpp>
 #include <hpx/synchronization/mutex.hpp>
@@ -16,6 +18,8 @@
 #include <hpx/threading.hpp>
 
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -275,10 +279,61 @@ struct test_recursive_lock
     }
 };
 
+// many threads competing for the same mutex, the lock is held across a
+// yield to force waiting threads to be suspended
+template <typename M>
+void test_contended_lock(std::size_t fairness_bound)
+{
+    typedef M mutex_type;
+
+    std::size_t const num_threads = 16;
+    std::size_t const num_iterations = 100;
+
+    mutex_type mx;
+    mx.set_fairness_bound(fairness_bound);
+
+    std::size_t count = 0;
+
+    std::vector<hpx::future<void>> threads;
+    threads.reserve(num_threads);
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        threads.push_back(hpx::async([&]() {
+            for (std::size_t j = 0; j != num_iterations; ++j)
+            {
+                std::lock_guard<mutex_type> l(mx);
+                std::size_t const value = count;
+                hpx::this_thread::yield();
+                count = value + 1;
+            }
+        }));
+    }
+    hpx::wait_all(threads);
+
+    HPX_TEST_EQ(count, num_threads * num_iterations);
+
+    std::int64_t const contentions = mx.get_contention_count(true);
+    std::int64_t const handoffs = mx.get_handoff_count(true);
+    HPX_TEST_LT(std::int64_t(0), contentions);
+    HPX_TEST_LTE(handoffs, contentions);
+
+    // the lock owner is suspended while holding the lock, so the other
+    // threads have to wait, without bypassing them the lock is handed off
+    if (fairness_bound == 0)
+    {
+        HPX_TEST_LT(std::int64_t(0), handoffs);
+    }
+
+    HPX_TEST_EQ(mx.get_contention_count(), std::int64_t(0));
+    HPX_TEST_EQ(mx.get_handoff_count(), std::int64_t(0));
+}
+
 void test_mutex()
 {
     test_lock<hpx::lcos::local::mutex>()();
     test_trylock<hpx::lcos::local::mutex>()();
+    test_contended_lock<hpx::lcos::local::mutex>(0);
+    test_contended_lock<hpx::lcos::local::mutex>(8);
 }
 
 void test_timed_mutex()
@@ -286,6 +341,7 @@ void test_timed_mutex()
     test_lock<hpx::lcos::local::timed_mutex>()();
     test_trylock<hpx::lcos::local::timed_mutex>()();
     test_timedlock<hpx::lcos::local::timed_mutex>()();
+    test_contended_lock<hpx::lcos::local::timed_mutex>(0);
 }
 
 //void test_recursive_mutex()
@@ -10,6 +10,7 @@
 #include <hpx/hpx_init.hpp>
 #include <hpx/include/lcos.hpp>
 #include <hpx/include/threads.hpp>
+#include <hpx/synchronization/reader_biased_shared_mutex.hpp>
 
 #include <hpx/testing.hpp>
 
@@ -29,16 +30,17 @@
         HPX_TEST_EQ(value, expected_value);                                    \
     }
 
+template <typename SharedMutex>
 void test_multiple_readers()
 {
-    typedef hpx::lcos::local::shared_mutex shared_mutex_type;
+    typedef SharedMutex shared_mutex_type;
     typedef hpx::lcos::local::mutex mutex_type;
 
     unsigned const number_of_threads = 10;
 
     test::thread_group pool;
 
-    hpx::lcos::local::shared_mutex rw_mutex;
+    shared_mutex_type rw_mutex;
     unsigned unblocked_count = 0;
     unsigned simultaneous_running_count = 0;
     unsigned max_simultaneous_running = 0;
@@ -83,16 +85,17 @@ void test_multiple_readers()
         unblocked_count_mutex, max_simultaneous_running, number_of_threads);
 }
 
+template <typename SharedMutex>
 void test_only_one_writer_permitted()
 {
-    typedef hpx::lcos::local::shared_mutex shared_mutex_type;
+    typedef SharedMutex shared_mutex_type;
     typedef hpx::lcos::local::mutex mutex_type;
 
     unsigned const number_of_threads = 10;
 
     test::thread_group pool;
 
-    hpx::lcos::local::shared_mutex rw_mutex;
+    shared_mutex_type rw_mutex;
     unsigned unblocked_count = 0;
     unsigned simultaneous_running_count = 0;
     unsigned max_simultaneous_running = 0;
@@ -132,14 +135,15 @@ void test_only_one_writer_permitted()
         unblocked_count_mutex, max_simultaneous_running, 1u);
 }
 
+template <typename SharedMutex>
 void test_reader_blocks_writer()
 {
-    typedef hpx::lcos::local::shared_mutex shared_mutex_type;
+    typedef SharedMutex shared_mutex_type;
     typedef hpx::lcos::local::mutex mutex_type;
 
     test::thread_group pool;
 
-    hpx::lcos::local::shared_mutex rw_mutex;
+    shared_mutex_type rw_mutex;
     unsigned unblocked_count = 0;
     unsigned simultaneous_running_count = 0;
     unsigned max_simultaneous_running = 0;
@@ -191,15 +195,16 @@ void test_reader_blocks_writer()
         unblocked_count_mutex, max_simultaneous_running, 1u);
 }
 
+template <typename SharedMutex>
 void test_unlocking_writer_unblocks_all_readers()
 {
-    typedef hpx::lcos::local::shared_mutex shared_mutex_type;
+    typedef SharedMutex shared_mutex_type;
     typedef hpx::lcos::local::mutex mutex_type;
 
     test::thread_group pool;
 
-    hpx::lcos::local::shared_mutex rw_mutex;
-    std::unique_lock<hpx::lcos::local::shared_mutex> write_lock(rw_mutex);
+    shared_mutex_type rw_mutex;
+    std::unique_lock<shared_mutex_type> write_lock(rw_mutex);
     unsigned unblocked_count = 0;
     unsigned simultaneous_running_count = 0;
     unsigned max_simultaneous_running = 0;
@@ -252,14 +257,15 @@ void test_unlocking_writer_unblocks_all_readers()
         unblocked_count_mutex, max_simultaneous_running, reader_count);
 }
 
+template <typename SharedMutex>
 void test_unlocking_last_reader_only_unblocks_one_writer()
 {
-    typedef hpx::lcos::local::shared_mutex shared_mutex_type;
+    typedef SharedMutex shared_mutex_type;
     typedef hpx::lcos::local::mutex mutex_type;
 
     test::thread_group pool;
 
-    hpx::lcos::local::shared_mutex rw_mutex;
+    shared_mutex_type rw_mutex;
     unsigned unblocked_count = 0;
     unsigned simultaneous_running_readers = 0;
     unsigned max_simultaneous_readers = 0;
@@ -342,13 +348,20 @@ void test_unlocking_last_reader_only_unblocks_one_writer()
 }
 
 ///////////////////////////////////////////////////////////////////////////////
+template <typename SharedMutex>
+void test_shared_mutex()
+{
+    test_multiple_readers<SharedMutex>();
+    test_only_one_writer_permitted<SharedMutex>();
+    test_reader_blocks_writer<SharedMutex>();
+    test_unlocking_writer_unblocks_all_readers<SharedMutex>();
+    test_unlocking_last_reader_only_unblocks_one_writer<SharedMutex>();
+}
+
 int hpx_main()
 {
-    test_multiple_readers();
-    test_only_one_writer_permitted();
-    test_reader_blocks_writer();
-    test_unlocking_writer_unblocks_all_readers();
-    test_unlocking_last_reader_only_unblocks_one_writer();
+    test_shared_mutex<hpx::lcos::local::shared_mutex>();
+    test_shared_mutex<hpx::lcos::local::reader_biased_shared_mutex>();
 
     return hpx::finalize();
 }
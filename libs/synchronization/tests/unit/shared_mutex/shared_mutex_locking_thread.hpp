@@ -23,7 +23,9 @@ namespace test {
     class locking_thread
     {
     private:
-        hpx::lcos::local::shared_mutex& rw_mutex;
+        typedef typename Lock::mutex_type shared_mutex_type;
+
+        shared_mutex_type& rw_mutex;
         unsigned& unblocked_count;
         hpx::lcos::local::condition_variable& unblocked_condition;
         unsigned& simultaneous_running_count;
@@ -32,7 +34,7 @@ namespace test {
         hpx::lcos::local::mutex& finish_mutex;
 
     public:
-        locking_thread(hpx::lcos::local::shared_mutex& rw_mutex_,
+        locking_thread(shared_mutex_type& rw_mutex_,
             unsigned& unblocked_count_,
             hpx::lcos::local::mutex& unblocked_count_mutex_,
             hpx::lcos::local::condition_variable& unblocked_condition_,
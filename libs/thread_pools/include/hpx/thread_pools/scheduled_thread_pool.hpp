@@ -275,6 +275,13 @@ namespace hpx { namespace threads { namespace detail {
 
         std::int64_t get_idle_loop_count(std::size_t num, bool reset) override;
         std::int64_t get_busy_loop_count(std::size_t num, bool reset) override;
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        std::int64_t get_idle_parked_time(std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_idle_parked_time(num, reset);
+        }
+#endif
         std::int64_t get_scheduler_utilization() const override;
 
 #if defined(HPX_HAVE_THREAD_EXECUTORS_COMPATIBILITY)
@@ -192,7 +192,7 @@ namespace hpx { namespace threads { namespace detail {
             sched_->Scheduler::set_all_states_at_least(state_stopping);
 
             // make sure we're not waiting
-            sched_->Scheduler::do_some_work(std::size_t(-1));
+            sched_->Scheduler::wake_all_idle_threads();
 
             if (blocking)
             {
@@ -205,7 +205,7 @@ namespace hpx { namespace threads { namespace detail {
                     // make sure no OS thread is waiting
                     LTM_(info) << "stop: " << id_.name() << " notify_all";
 
-                    sched_->Scheduler::do_some_work(std::size_t(-1));
+                    sched_->Scheduler::wake_all_idle_threads();
 
                     LTM_(info) << "stop: " << id_.name() << " join:" << i;
 
@@ -1983,6 +1983,9 @@ namespace hpx { namespace threads { namespace detail {
         hpx::state expected = state_running;
         state.compare_exchange_strong(expected, state_pre_sleep);
 
+        // make sure the OS thread is not parked while idling
+        sched_->Scheduler::do_some_work(virt_core);
+
         l.unlock();
 
         HPX_ASSERT(expected == state_running || expected == state_pre_sleep ||
@@ -607,6 +607,12 @@ namespace hpx { namespace threads { namespace detail {
 
         std::size_t added = std::size_t(-1);
         thread_data* next_thrd = nullptr;
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // the current exponent of the spin back-off while idling
+        std::size_t idle_backoff_exponent = 0;
+#endif
+
         while (true)
         {
             thread_data* thrd = next_thrd;
@@ -642,6 +648,9 @@ namespace hpx { namespace threads { namespace detail {
                 ++busy_loop_count;
 
                 may_exit = false;
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+                idle_backoff_exponent = 0;
+#endif
 
                 // Only pending HPX threads will be executed.
                 // Any non-pending HPX threads are leftovers from a set_state()
@@ -936,6 +945,29 @@ namespace hpx { namespace threads { namespace detail {
                     added = std::size_t(-1);
                 }
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+                // Back off exponentially while no work can be found. This
+                // takes pressure off the queues and lets the core's sibling
+                // hardware threads make progress. Each spin counts as an idle
+                // loop, which makes sure the OS thread gets parked in the idle
+                // callback soon if the pool stays idle.
+                if (running && !may_exit &&
+                    scheduler.SchedulingPolicy::has_scheduler_mode(
+                        policies::enable_idle_backoff))
+                {
+                    std::int64_t const spins = std::int64_t(1)
+                        << idle_backoff_exponent;
+                    for (std::int64_t i = 0; i != spins; ++i)
+                    {
+                        HPX_SMT_PAUSE;
+                    }
+                    idle_loop_count -= spins;
+
+                    if (idle_backoff_exponent < 10)
+                        ++idle_backoff_exponent;
+                }
+#endif
+
 #if defined(HPX_HAVE_NETWORKING)
 #if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
     defined(HPX_HAVE_THREAD_IDLE_RATES)
@@ -38,6 +38,12 @@ template class HPX_EXPORT
 template class HPX_EXPORT hpx::threads::detail::scheduled_thread_pool<
     hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
         hpx::threads::policies::lockfree_fifo>>;
+template class HPX_EXPORT
+    hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+        hpx::threads::policies::lockfree_chase_lev>;
+template class HPX_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+        hpx::threads::policies::lockfree_chase_lev>>;
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
 template class HPX_EXPORT
     hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
@@ -68,4 +74,10 @@ template class HPX_EXPORT
     hpx::threads::policies::shared_priority_queue_scheduler<>;
 template class HPX_EXPORT hpx::threads::detail::scheduled_thread_pool<
     hpx::threads::policies::shared_priority_queue_scheduler<>>;
+template class HPX_EXPORT
+    hpx::threads::policies::shared_priority_queue_scheduler<std::mutex,
+        hpx::threads::policies::lockfree_chase_lev>;
+template class HPX_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::shared_priority_queue_scheduler<std::mutex,
+        hpx::threads::policies::lockfree_chase_lev>>;
 #endif
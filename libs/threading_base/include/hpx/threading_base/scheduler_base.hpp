@@ -23,6 +23,7 @@
 #endif
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
@@ -80,12 +81,23 @@ namespace hpx { namespace threads { namespace policies {
             return description_;
         }
 
+        /// This function gets called by the scheduling loop of an OS thread
+        /// which has not found any work for a while. The thread is parked
+        /// until new work is added or an (exponentially growing) timeout
+        /// expires.
         void idle_callback(std::size_t num_thread);
 
         /// This function gets called by the thread-manager whenever new work
-        /// has been added, allowing the scheduler to reactivate one or more of
-        /// possibly idling OS threads
-        void do_some_work(std::size_t);
+        /// has been added, allowing the scheduler to reactivate one of the
+        /// possibly idling OS threads (all of them if stealing is disabled)
+        void do_some_work(std::size_t num_thread);
+
+        /// Reactivate all possibly idling OS threads
+        void wake_all_idle_threads();
+
+        /// Return the overall time the given OS thread (all OS threads if
+        /// num_thread == -1) has been parked while idling [ns]
+        std::int64_t get_idle_parked_time(std::size_t num_thread, bool reset);
 
         virtual void suspend(std::size_t num_thread);
         virtual void resume(std::size_t num_thread);
@@ -275,15 +287,33 @@ namespace hpx { namespace threads { namespace policies {
         util::cache_line_data<std::atomic<scheduler_mode>> mode_;
 
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        // support for suspension on idle queues
-        pu_mutex_type mtx_;
-        std::condition_variable cond_;
+        // support for parking OS threads on idle queues
         struct idle_backoff_data
         {
             std::uint32_t wait_count_;
             double max_idle_backoff_time_;
+
+            // non-zero while the OS thread is parked, the thread waits for
+            // this to change (it is used as the futex word where available)
+            std::atomic<std::uint32_t> parked_;
+
+            // overall time the OS thread was parked [ns]
+            std::atomic<std::int64_t> parked_time_;
         };
+
+        bool has_idle_work(std::size_t num_thread) const;
+        void park(idle_backoff_data& data, std::chrono::milliseconds period);
+        bool unpark(std::size_t num_thread);
+
         std::vector<util::cache_line_data<idle_backoff_data>> wait_counts_;
+
+        // the number of currently parked OS threads, allows to skip waking
+        // up threads if none is parked
+        util::cache_line_data<std::atomic<std::int64_t>> parked_count_;
+
+        // used for parking threads on platforms without futexes
+        pu_mutex_type mtx_;
+        std::condition_variable cond_;
 #endif
 
         // support for suspension of pus
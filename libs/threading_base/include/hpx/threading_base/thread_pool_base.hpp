@@ -486,6 +486,14 @@ namespace hpx { namespace threads {
         virtual std::int64_t get_busy_loop_count(
             std::size_t num, bool reset) = 0;
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        virtual std::int64_t get_idle_parked_time(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+#endif
+
         ///////////////////////////////////////////////////////////////////////
         virtual bool enumerate_threads(
             util::function_nonser<bool(thread_id_type)> const& /*f*/,
@@ -38,7 +38,9 @@ namespace hpx { namespace threads { namespace policies {
             std::ptrdiff_t small_stacksize = HPX_SMALL_STACK_SIZE,
             std::ptrdiff_t medium_stacksize = HPX_MEDIUM_STACK_SIZE,
             std::ptrdiff_t large_stacksize = HPX_LARGE_STACK_SIZE,
-            std::ptrdiff_t huge_stacksize = HPX_HUGE_STACK_SIZE)
+            std::ptrdiff_t huge_stacksize = HPX_HUGE_STACK_SIZE,
+            std::int64_t max_thread_heap_size = std::int64_t(
+                HPX_THREAD_QUEUE_MAX_THREAD_HEAP_SIZE))
           : max_thread_count_(max_thread_count)
           , min_tasks_to_steal_pending_(min_tasks_to_steal_pending)
           , min_tasks_to_steal_staged_(min_tasks_to_steal_staged)
@@ -53,6 +55,7 @@ namespace hpx { namespace threads { namespace policies {
           , large_stacksize_(large_stacksize)
           , huge_stacksize_(huge_stacksize)
           , nostack_stacksize_((std::numeric_limits<std::ptrdiff_t>::max)())
+          , max_thread_heap_size_(max_thread_heap_size)
         {
         }
 
@@ -70,6 +73,7 @@ namespace hpx { namespace threads { namespace policies {
         std::ptrdiff_t const large_stacksize_;
         std::ptrdiff_t const huge_stacksize_;
         std::ptrdiff_t const nostack_stacksize_;
+        std::int64_t const max_thread_heap_size_;
     };
 }}}    // namespace hpx::threads::policies
 
@@ -32,12 +32,52 @@
 #include <utility>
 #include <vector>
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF) && defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace threads { namespace policies {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF) && defined(__linux__)
+    namespace detail {
+        // Block while the given word holds the expected value, returns early
+        // on timeout, if woken up, or spuriously.
+        void futex_wait(std::atomic<std::uint32_t>& word,
+            std::uint32_t expected, std::chrono::nanoseconds timeout)
+        {
+            static_assert(sizeof(std::atomic<std::uint32_t>) ==
+                    sizeof(std::uint32_t),
+                "the futex word has to be a plain 32 bit integer");
+
+            timespec ts;
+            ts.tv_sec = static_cast<time_t>(timeout.count() / 1000000000);
+            ts.tv_nsec = static_cast<long>(timeout.count() % 1000000000);
+
+            syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+                FUTEX_WAIT_PRIVATE, expected, &ts, nullptr, 0);
+        }
+
+        void futex_wake(std::atomic<std::uint32_t>& word)
+        {
+            syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word),
+                FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+        }
+    }    // namespace detail
+#endif
+
     scheduler_base::scheduler_base(std::size_t num_threads,
         char const* description, thread_queue_init_parameters thread_queue_init,
         scheduler_mode mode)
-      : suspend_mtxs_(num_threads)
+      :
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        wait_counts_(num_threads)
+      , suspend_mtxs_(num_threads)
+#else
+        suspend_mtxs_(num_threads)
+#endif
       , suspend_conds_(num_threads)
       , pu_mtxs_(num_threads)
       , states_(num_threads)
@@ -51,7 +91,6 @@ namespace hpx { namespace threads { namespace policies {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
         double max_time = thread_queue_init.max_idle_backoff_time_;
 
-        wait_counts_.resize(num_threads);
         for (auto&& data : wait_counts_)
         {
             data.data_.wait_count_ = 0;
@@ -69,8 +108,8 @@ namespace hpx { namespace threads { namespace policies {
         if (mode_.data_.load(std::memory_order_relaxed) &
             policies::enable_idle_backoff)
         {
-            // Put this thread to sleep for some time, additionally it gets
-            // woken up on new work.
+            // Park this thread for some time, additionally it gets woken up
+            // on new work.
 
             idle_backoff_data& data = wait_counts_[num_thread].data_;
 
@@ -83,8 +122,25 @@ namespace hpx { namespace threads { namespace policies {
 
             ++data.wait_count_;
 
-            std::unique_lock<pu_mutex_type> l(mtx_);
-            if (cond_.wait_for(l, period) == std::cv_status::no_timeout)
+            // Announce that this thread is about to be parked before checking
+            // for new work for the last time. This pairs with do_some_work,
+            // which adds the work before looking for parked threads.
+            data.parked_.store(1, std::memory_order_seq_cst);
+            parked_count_.data_.fetch_add(1, std::memory_order_seq_cst);
+
+            if (states_[num_thread].load() == state_running &&
+                !has_idle_work(num_thread))
+            {
+                park(data, period);
+            }
+
+            // withdraw the announcement if nobody has woken this thread
+            std::uint32_t expected = 1;
+            if (data.parked_.compare_exchange_strong(expected, 0))
+            {
+                parked_count_.data_.fetch_sub(1, std::memory_order_relaxed);
+            }
+            else
             {
                 // reset counter if thread was woken up
                 data.wait_count_ = 0;
@@ -95,13 +151,151 @@ namespace hpx { namespace threads { namespace policies {
 #endif
     }
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    bool scheduler_base::has_idle_work(std::size_t num_thread) const
+    {
+        // threads which are allowed to steal work have to look at all queues
+        if (mode_.data_.load(std::memory_order_relaxed) &
+            policies::enable_stealing)
+        {
+            return get_queue_length(std::size_t(-1)) != 0;
+        }
+        return get_queue_length(num_thread) != 0;
+    }
+
+    // Block the calling thread until it is woken up or the given time has
+    // passed.
+    void scheduler_base::park(
+        idle_backoff_data& data, std::chrono::milliseconds period)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        auto const deadline = start + period;
+
+#if defined(__linux__)
+        auto now = start;
+        while (data.parked_.load(std::memory_order_acquire) == 1 &&
+            now < deadline)
+        {
+            detail::futex_wait(data.parked_, 1, deadline - now);
+            now = std::chrono::steady_clock::now();
+        }
+#else
+        {
+            std::unique_lock<pu_mutex_type> l(mtx_);
+            cond_.wait_until(l, deadline, [&data]() {
+                return data.parked_.load(std::memory_order_acquire) != 1;
+            });
+        }
+        auto const now = std::chrono::steady_clock::now();
+#endif
+
+        data.parked_time_.fetch_add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(now - start)
+                .count(),
+            std::memory_order_relaxed);
+    }
+
+    // Wake up the given thread if it is parked, returns whether the thread
+    // was parked.
+    bool scheduler_base::unpark(std::size_t num_thread)
+    {
+        idle_backoff_data& data = wait_counts_[num_thread].data_;
+
+        std::uint32_t expected = 1;
+        if (data.parked_.load(std::memory_order_relaxed) != 1 ||
+            !data.parked_.compare_exchange_strong(expected, 0))
+        {
+            return false;
+        }
+
+        parked_count_.data_.fetch_sub(1, std::memory_order_relaxed);
+
+#if defined(__linux__)
+        detail::futex_wake(data.parked_);
+#else
+        {
+            // make sure the parked thread is either waiting already or will
+            // see the changed flag before waiting
+            std::lock_guard<pu_mutex_type> l(mtx_);
+        }
+        cond_.notify_all();
+#endif
+        return true;
+    }
+#endif
+
     /// This function gets called by the thread-manager whenever new work
     /// has been added, allowing the scheduler to reactivate one or more of
     /// possibly idling OS threads
-    void scheduler_base::do_some_work(std::size_t)
+    void scheduler_base::do_some_work(std::size_t num_thread)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        cond_.notify_all();
+        // The new work has been added already, this pairs with the
+        // announcement of parked threads in idle_callback.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (parked_count_.data_.load(std::memory_order_relaxed) == 0)
+            return;
+
+        bool const stealing = mode_.data_.load(std::memory_order_relaxed) &
+            policies::enable_stealing;
+
+        // The thread the work was scheduled for will take care of the work
+        // once woken up. If it is running already it may be busy for a
+        // while, in which case another thread should steal the work.
+        std::size_t const num_threads = wait_counts_.size();
+        if (num_thread < num_threads &&
+            (unpark(num_thread) || !stealing))
+        {
+            return;
+        }
+
+        // Otherwise wake up one thread which will steal the work, or all of
+        // them if stealing is disabled.
+        bool const wake_all = !stealing;
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            if (unpark(i) && !wake_all)
+                break;
+        }
+#else
+        (void) num_thread;
+#endif
+    }
+
+    void scheduler_base::wake_all_idle_threads()
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for (std::size_t i = 0; i != wait_counts_.size(); ++i)
+        {
+            unpark(i);
+        }
+#endif
+    }
+
+    std::int64_t scheduler_base::get_idle_parked_time(
+        std::size_t num_thread, bool reset)
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        auto get_value = [reset](std::atomic<std::int64_t>& value) {
+            return reset ? value.exchange(0, std::memory_order_relaxed) :
+                           value.load(std::memory_order_relaxed);
+        };
+
+        if (num_thread == std::size_t(-1))
+        {
+            std::int64_t result = 0;
+            for (auto& data : wait_counts_)
+                result += get_value(data.data_.parked_time_);
+            return result;
+        }
+
+        HPX_ASSERT(num_thread < wait_counts_.size());
+        return get_value(wait_counts_[num_thread].data_.parked_time_);
+#else
+        (void) num_thread;
+        (void) reset;
+        return 0;
 #endif
     }
 
@@ -309,7 +503,7 @@ namespace hpx { namespace threads { namespace policies {
     {
         // distribute the same value across all cores
         mode_.data_.store(mode, std::memory_order_release);
-        do_some_work(std::size_t(-1));
+        wake_all_idle_threads();
     }
 
     void scheduler_base::add_scheduler_mode(scheduler_mode mode)
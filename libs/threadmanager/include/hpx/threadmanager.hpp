@@ -344,6 +344,10 @@ namespace hpx { namespace threads {
 
         std::int64_t get_cumulative_duration(bool reset);
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        std::int64_t get_idle_parked_time(bool reset);
+#endif
+
         std::int64_t get_thread_count_unknown(bool reset)
         {
             return get_thread_count(
@@ -282,6 +282,10 @@ namespace hpx { namespace threads {
             hpx::util::from_string<std::int64_t>(
                 hpx::get_config_entry("hpx.thread_queue.max_terminated_threads",
                     std::to_string(HPX_THREAD_QUEUE_MAX_TERMINATED_THREADS)));
+        std::int64_t const max_thread_heap_size =
+            hpx::util::from_string<std::int64_t>(
+                hpx::get_config_entry("hpx.thread_queue.max_thread_heap_size",
+                    std::to_string(HPX_THREAD_QUEUE_MAX_THREAD_HEAP_SIZE)));
         double const max_idle_backoff_time = hpx::util::from_string<double>(
             hpx::get_config_entry("hpx.max_idle_backoff_time",
                 std::to_string(HPX_IDLE_BACKOFF_TIME_MAX)));
@@ -297,7 +301,7 @@ namespace hpx { namespace threads {
             min_tasks_to_steal_staged, min_add_new_count, max_add_new_count,
             min_delete_count, max_delete_count, max_terminated_threads,
             max_idle_backoff_time, small_stacksize, medium_stacksize,
-            large_stacksize, huge_stacksize);
+            large_stacksize, huge_stacksize, max_thread_heap_size);
 
         if (!hpx::is_networking_enabled())
         {
@@ -911,6 +915,16 @@ namespace hpx { namespace threads {
         return result;
     }
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    std::int64_t threadmanager::get_idle_parked_time(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_idle_parked_time(all_threads, reset);
+        return result;
+    }
+#endif
+
 #if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
     defined(HPX_HAVE_THREAD_IDLE_RATES)
     std::int64_t threadmanager::get_background_work_duration(bool reset)
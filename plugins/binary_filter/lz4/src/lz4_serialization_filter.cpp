@@ -0,0 +1,269 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/actions/action_support.hpp>
+#include <hpx/runtime/config_entry.hpp>
+
+#include <hpx/plugins/plugin_registry.hpp>
+#include <hpx/plugins/binary_filter_factory.hpp>
+#include <hpx/plugins/binary_filter/compression_frame.hpp>
+#include <hpx/plugins/binary_filter/lz4_serialization_filter.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <lz4.h>
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::lz4_serialization_filter,
+    lz4_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace plugins { namespace compression
+{
+    namespace
+    {
+        // the configuration is read once, the filter objects are created
+        // for each message
+        struct lz4_settings
+        {
+            lz4_settings()
+              : threshold_("lz4_serialization_filter")
+              , acceleration_(std::stoi(get_config_entry(
+                    "hpx.plugins.lz4_serialization_filter.acceleration",
+                    "1")))
+              , dictionary_(load_dictionary("lz4_serialization_filter"))
+            {
+                // LZ4 uses at most the last 64kB of a dictionary
+                std::size_t const max_dictionary_size = 64 * 1024;
+                if (dictionary_.size() > max_dictionary_size)
+                {
+                    dictionary_.erase(dictionary_.begin(),
+                        dictionary_.end() - max_dictionary_size);
+                }
+                dictionary_hash_ = get_dictionary_hash(dictionary_);
+            }
+
+            compression_threshold threshold_;
+            int acceleration_;
+            std::vector<char> dictionary_;
+            std::uint64_t dictionary_hash_;
+        };
+
+        lz4_settings const& get_lz4_settings()
+        {
+            static lz4_settings const settings;
+            return settings;
+        }
+    }
+
+    void lz4_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The frame header records the uncompressed size of the data, the size
+    // estimate passed by the archive is not needed.
+    std::size_t lz4_serialization_filter::init_data(
+        char const* buffer, std::size_t size, std::size_t)
+    {
+        frame_header const header = read_frame_header(buffer, size);
+        char const* src_begin = buffer + get_frame_header_size(header.method_);
+
+        // don't allocate more memory than the frame can expand to, LZ4 does
+        // not compress the data by more than a factor of 255
+        if (header.method_ != frame_method::stored &&
+            (header.size_ > std::uint64_t(LZ4_MAX_INPUT_SIZE) ||
+                header.size_ > 255 * header.compressed_size_))
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "lz4_serialization_filter::init_data",
+                "archive data bstream is corrupted");
+            return 0;
+        }
+
+        buffer_.resize(header.size_);
+        current_ = 0;
+
+        switch (header.method_)
+        {
+        case frame_method::stored:
+            std::memcpy(buffer_.data(), src_begin, header.size_);
+            break;
+
+        case frame_method::compressed:
+            if (LZ4_decompress_safe(src_begin, buffer_.data(),
+                    static_cast<int>(header.compressed_size_),
+                    static_cast<int>(header.size_)) !=
+                static_cast<int>(header.size_))
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "lz4_serialization_filter::init_data",
+                    "decompression failure, archive data is corrupted");
+                return 0;
+            }
+            break;
+
+        case frame_method::compressed_with_dictionary:
+            {
+                lz4_settings const& settings = get_lz4_settings();
+                std::vector<char> const& dictionary = settings.dictionary_;
+                if (dictionary.empty())
+                {
+                    HPX_THROW_EXCEPTION(serialization_error,
+                        "lz4_serialization_filter::init_data",
+                        "the data was compressed using a dictionary but no "
+                        "dictionary was configured for this locality");
+                    return 0;
+                }
+                if (header.dictionary_hash_ != settings.dictionary_hash_)
+                {
+                    HPX_THROW_EXCEPTION(serialization_error,
+                        "lz4_serialization_filter::init_data",
+                        "the data was compressed using a different "
+                        "dictionary than the one configured for this "
+                        "locality");
+                    return 0;
+                }
+
+                if (LZ4_decompress_safe_usingDict(src_begin, buffer_.data(),
+                        static_cast<int>(header.compressed_size_),
+                        static_cast<int>(header.size_), dictionary.data(),
+                        static_cast<int>(dictionary.size())) !=
+                    static_cast<int>(header.size_))
+                {
+                    HPX_THROW_EXCEPTION(serialization_error,
+                        "lz4_serialization_filter::init_data",
+                        "decompression failure, archive data is corrupted");
+                    return 0;
+                }
+            }
+            break;
+        }
+
+        return buffer_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void lz4_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_+dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                    "lz4_serialization_filter::load",
+                    "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void lz4_serialization_filter::save(void const* src,
+        std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(src_begin, src_begin+src_count, std::back_inserter(buffer_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool lz4_serialization_filter::flush(void* dst, std::size_t dst_count,
+        std::size_t& written)
+    {
+        lz4_settings const& settings = get_lz4_settings();
+
+        char* dst_begin = static_cast<char*>(dst);
+        std::size_t const size = buffer_.size();
+
+        if (size <= std::size_t(LZ4_MAX_INPUT_SIZE) &&
+            settings.threshold_.should_compress(buffer_.data(), size))
+        {
+            frame_method const method = settings.dictionary_.empty() ?
+                frame_method::compressed :
+                frame_method::compressed_with_dictionary;
+            std::size_t const header_size = get_frame_header_size(method);
+
+            // make sure we have enough memory
+            int const bound = LZ4_compressBound(static_cast<int>(size));
+            if (header_size + std::size_t(bound) > dst_count)
+            {
+                written = 0;
+                return false;
+            }
+
+            // compress everything in one go
+            char* compressed_begin = dst_begin + header_size;
+            int compressed_length = 0;
+
+            if (method == frame_method::compressed)
+            {
+                compressed_length = LZ4_compress_fast(buffer_.data(),
+                    compressed_begin, static_cast<int>(size), bound,
+                    settings.acceleration_);
+            }
+            else
+            {
+                std::unique_ptr<LZ4_stream_t, int (*)(LZ4_stream_t*)> stream(
+                    LZ4_createStream(), &LZ4_freeStream);
+                if (!stream)
+                {
+                    HPX_THROW_EXCEPTION(out_of_memory,
+                        "lz4_serialization_filter::flush",
+                        "could not allocate the compression stream");
+                    return false;
+                }
+
+                LZ4_loadDict(stream.get(), settings.dictionary_.data(),
+                    static_cast<int>(settings.dictionary_.size()));
+
+                compressed_length = LZ4_compress_fast_continue(stream.get(),
+                    buffer_.data(), compressed_begin, static_cast<int>(size),
+                    bound, settings.acceleration_);
+            }
+
+            if (compressed_length <= 0)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "lz4_serialization_filter::flush",
+                    "compression failure, flushing did not reach end of data");
+                return false;
+            }
+
+            // use the compressed data only if it saves space
+            if (std::size_t(compressed_length) < size)
+            {
+                write_frame_header(dst_begin, method, size, compressed_length,
+                    settings.dictionary_hash_);
+                written = header_size + compressed_length;
+                return true;
+            }
+        }
+
+        // store the data uncompressed
+        if (frame_header_size + size > dst_count)
+        {
+            written = 0;
+            return false;
+        }
+
+        write_frame_header(dst_begin, frame_method::stored, size, size);
+        std::memcpy(dst_begin + frame_header_size, buffer_.data(), size);
+
+        written = frame_header_size + size;
+        return true;
+    }
+}}}
@@ -0,0 +1,75 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_ACTION_ZSTD_SERIALIZATION_FILTER_HPP)
+#define HPX_ACTION_ZSTD_SERIALIZATION_FILTER_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/plugins/binary_filter/zstd_serialization_filter_registration.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+
+#include <hpx/serialization/binary_filter.hpp>
+
+#include <cstddef>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace plugins { namespace compression
+{
+    // The Zstandard filter writes self-describing frames (see
+    // compression_frame.hpp), small or incompressible data is stored
+    // uncompressed. The filter is configured using the following entries:
+    //
+    //   hpx.plugins.zstd_serialization_filter.min_size
+    //   hpx.plugins.zstd_serialization_filter.max_entropy
+    //   hpx.plugins.zstd_serialization_filter.level
+    //   hpx.plugins.zstd_serialization_filter.dictionary
+    //
+    // The dictionary (if given) has to be the same on all localities.
+    struct HPX_LIBRARY_EXPORT zstd_serialization_filter
+      : public serialization::binary_filter
+    {
+        zstd_serialization_filter(bool compress = false,
+                serialization::binary_filter* next_filter = nullptr)
+          : current_(0), compress_(compress)
+        {}
+
+        void load(void* dst, std::size_t dst_count);
+        void save(void const* src, std::size_t src_count);
+        bool flush(void* dst, std::size_t dst_count, std::size_t& written);
+
+        void set_max_length(std::size_t size);
+        std::size_t init_data(char const* buffer,
+            std::size_t size, std::size_t buffer_size);
+
+        // the frame header records the size of the uncompressed data
+        bool records_data_size() const
+        {
+            return true;
+        }
+
+    private:
+        // serialization support
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        HPX_FORCEINLINE void serialize(Archive& ar, const unsigned int) {}
+
+        HPX_SERIALIZATION_POLYMORPHIC(zstd_serialization_filter);
+
+        std::vector<char> buffer_;
+        std::size_t current_;
+        bool compress_;
+    };
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
+#endif
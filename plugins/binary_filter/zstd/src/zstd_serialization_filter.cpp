@@ -0,0 +1,280 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime/actions/action_support.hpp>
+#include <hpx/runtime/config_entry.hpp>
+
+#include <hpx/plugins/plugin_registry.hpp>
+#include <hpx/plugins/binary_filter_factory.hpp>
+#include <hpx/plugins/binary_filter/compression_frame.hpp>
+#include <hpx/plugins/binary_filter/zstd_serialization_filter.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <zstd.h>
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::zstd_serialization_filter,
+    zstd_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace plugins { namespace compression
+{
+    namespace
+    {
+        // the configuration is read once, the filter objects are created
+        // for each message
+        struct zstd_settings
+        {
+            zstd_settings()
+              : threshold_("zstd_serialization_filter")
+              , level_(std::stoi(get_config_entry(
+                    "hpx.plugins.zstd_serialization_filter.level", "3")))
+              , dictionary_(load_dictionary("zstd_serialization_filter"))
+              , dictionary_hash_(get_dictionary_hash(dictionary_))
+              , cdict_(nullptr)
+              , ddict_(nullptr)
+            {
+                // digest the dictionary once, this is what makes using it
+                // for small messages worthwhile
+                if (!dictionary_.empty())
+                {
+                    cdict_ = ZSTD_createCDict(
+                        dictionary_.data(), dictionary_.size(), level_);
+                    ddict_ = ZSTD_createDDict(
+                        dictionary_.data(), dictionary_.size());
+                }
+            }
+
+            ~zstd_settings()
+            {
+                ZSTD_freeCDict(cdict_);
+                ZSTD_freeDDict(ddict_);
+            }
+
+            compression_threshold threshold_;
+            int level_;
+            std::vector<char> dictionary_;
+            std::uint64_t dictionary_hash_;
+            ZSTD_CDict* cdict_;
+            ZSTD_DDict* ddict_;
+        };
+
+        zstd_settings const& get_zstd_settings()
+        {
+            static zstd_settings const settings;
+            return settings;
+        }
+
+        // the (de-)compression contexts are reused by all filters running
+        // on the same OS-thread, (de-)compressing does not suspend
+        ZSTD_CCtx* get_compression_context()
+        {
+            static thread_local std::unique_ptr<ZSTD_CCtx,
+                std::size_t (*)(ZSTD_CCtx*)>
+                context(ZSTD_createCCtx(), &ZSTD_freeCCtx);
+            return context.get();
+        }
+
+        ZSTD_DCtx* get_decompression_context()
+        {
+            static thread_local std::unique_ptr<ZSTD_DCtx,
+                std::size_t (*)(ZSTD_DCtx*)>
+                context(ZSTD_createDCtx(), &ZSTD_freeDCtx);
+            return context.get();
+        }
+    }
+
+    void zstd_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The frame header records the uncompressed size of the data, the size
+    // estimate passed by the archive is not needed.
+    std::size_t zstd_serialization_filter::init_data(
+        char const* buffer, std::size_t size, std::size_t)
+    {
+        frame_header const header = read_frame_header(buffer, size);
+        char const* src_begin = buffer + get_frame_header_size(header.method_);
+
+        // don't allocate more memory than the frame can expand to, the
+        // compressed frames record the size of their content
+        if (header.method_ != frame_method::stored &&
+            ZSTD_getFrameContentSize(src_begin, header.compressed_size_) !=
+                header.size_)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "zstd_serialization_filter::init_data",
+                "archive data bstream is corrupted");
+            return 0;
+        }
+
+        buffer_.resize(header.size_);
+        current_ = 0;
+
+        std::size_t result = 0;
+        switch (header.method_)
+        {
+        case frame_method::stored:
+            std::memcpy(buffer_.data(), src_begin, header.size_);
+            return buffer_.size();
+
+        case frame_method::compressed:
+            result = ZSTD_decompressDCtx(get_decompression_context(),
+                buffer_.data(), buffer_.size(), src_begin,
+                header.compressed_size_);
+            break;
+
+        case frame_method::compressed_with_dictionary:
+            {
+                zstd_settings const& settings = get_zstd_settings();
+                ZSTD_DDict const* ddict = settings.ddict_;
+                if (ddict == nullptr)
+                {
+                    HPX_THROW_EXCEPTION(serialization_error,
+                        "zstd_serialization_filter::init_data",
+                        "the data was compressed using a dictionary but no "
+                        "dictionary was configured for this locality");
+                    return 0;
+                }
+                if (header.dictionary_hash_ != settings.dictionary_hash_)
+                {
+                    HPX_THROW_EXCEPTION(serialization_error,
+                        "zstd_serialization_filter::init_data",
+                        "the data was compressed using a different "
+                        "dictionary than the one configured for this "
+                        "locality");
+                    return 0;
+                }
+
+                result = ZSTD_decompress_usingDDict(
+                    get_decompression_context(), buffer_.data(),
+                    buffer_.size(), src_begin, header.compressed_size_,
+                    ddict);
+            }
+            break;
+        }
+
+        if (ZSTD_isError(result) || result != header.size_)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "zstd_serialization_filter::init_data",
+                "decompression failure, archive data is corrupted");
+            return 0;
+        }
+
+        return buffer_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void zstd_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_+dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                    "zstd_serialization_filter::load",
+                    "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void zstd_serialization_filter::save(void const* src,
+        std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(src_begin, src_begin+src_count, std::back_inserter(buffer_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool zstd_serialization_filter::flush(void* dst, std::size_t dst_count,
+        std::size_t& written)
+    {
+        zstd_settings const& settings = get_zstd_settings();
+
+        char* dst_begin = static_cast<char*>(dst);
+        std::size_t const size = buffer_.size();
+
+        if (settings.threshold_.should_compress(buffer_.data(), size))
+        {
+            frame_method const method = settings.cdict_ == nullptr ?
+                frame_method::compressed :
+                frame_method::compressed_with_dictionary;
+            std::size_t const header_size = get_frame_header_size(method);
+
+            // make sure we have enough memory
+            std::size_t const bound = ZSTD_compressBound(size);
+            if (header_size + bound > dst_count)
+            {
+                written = 0;
+                return false;
+            }
+
+            // compress everything in one go
+            char* compressed_begin = dst_begin + header_size;
+            std::size_t compressed_length = 0;
+
+            if (method == frame_method::compressed)
+            {
+                compressed_length = ZSTD_compressCCtx(
+                    get_compression_context(), compressed_begin, bound,
+                    buffer_.data(), size, settings.level_);
+            }
+            else
+            {
+                compressed_length = ZSTD_compress_usingCDict(
+                    get_compression_context(), compressed_begin, bound,
+                    buffer_.data(), size, settings.cdict_);
+            }
+
+            if (ZSTD_isError(compressed_length))
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "zstd_serialization_filter::flush",
+                    std::string("compression failure: ") +
+                        ZSTD_getErrorName(compressed_length));
+                return false;
+            }
+
+            // use the compressed data only if it saves space
+            if (compressed_length < size)
+            {
+                write_frame_header(dst_begin, method, size, compressed_length,
+                    settings.dictionary_hash_);
+                written = header_size + compressed_length;
+                return true;
+            }
+        }
+
+        // store the data uncompressed
+        if (frame_header_size + size > dst_count)
+        {
+            written = 0;
+            return false;
+        }
+
+        write_frame_header(dst_begin, frame_method::stored, size, size);
+        std::memcpy(dst_begin + frame_header_size, buffer_.data(), size);
+
+        written = frame_header_size + size;
+        return true;
+    }
+}}}
@@ -36,6 +36,8 @@ namespace hpx { namespace plugins { namespace parcel
         get_counter_type num_parcels, get_counter_type num_messages,
         get_counter_type num_parcels_per_message,
         get_counter_type average_time_between_parcels,
+        get_counter_type batch_size, get_counter_type flush_interval,
+        get_counter_type send_latency,
         get_counter_values_creator_type time_between_parcels_histogram_creator)
     {
         if (name.empty())
@@ -54,6 +56,7 @@ namespace hpx { namespace plugins { namespace parcel
             {
                 num_parcels, num_messages,
                 num_parcels_per_message, average_time_between_parcels,
+                batch_size, flush_interval, send_latency,
                 time_between_parcels_histogram_creator,
                 0, 0, 1
             };
@@ -68,6 +71,9 @@ namespace hpx { namespace plugins { namespace parcel
             (*it).second.num_parcels_per_message = num_parcels_per_message;
             (*it).second.average_time_between_parcels =
                 average_time_between_parcels;
+            (*it).second.batch_size = batch_size;
+            (*it).second.flush_interval = flush_interval;
+            (*it).second.send_latency = send_latency;
             (*it).second.time_between_parcels_histogram_creator =
                 time_between_parcels_histogram_creator;
 
@@ -174,6 +180,60 @@ namespace hpx { namespace plugins { namespace parcel
         return (*it).second.average_time_between_parcels;
     }
 
+    coalescing_counter_registry::get_counter_type
+        coalescing_counter_registry::get_batch_size_counter(
+            std::string const& name) const
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+
+        map_type::const_iterator it = map_.find(name);
+        if (it == map_.end())
+        {
+            l.unlock();
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "coalescing_counter_registry::get_batch_size_counter",
+                "unknown action type");
+            return get_counter_type();
+        }
+        return (*it).second.batch_size;
+    }
+
+    coalescing_counter_registry::get_counter_type
+        coalescing_counter_registry::get_flush_interval_counter(
+            std::string const& name) const
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+
+        map_type::const_iterator it = map_.find(name);
+        if (it == map_.end())
+        {
+            l.unlock();
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "coalescing_counter_registry::get_flush_interval_counter",
+                "unknown action type");
+            return get_counter_type();
+        }
+        return (*it).second.flush_interval;
+    }
+
+    coalescing_counter_registry::get_counter_type
+        coalescing_counter_registry::get_send_latency_counter(
+            std::string const& name) const
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+
+        map_type::const_iterator it = map_.find(name);
+        if (it == map_.end())
+        {
+            l.unlock();
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "coalescing_counter_registry::get_send_latency_counter",
+                "unknown action type");
+            return get_counter_type();
+        }
+        return (*it).second.send_latency;
+    }
+
     coalescing_counter_registry::get_counter_values_type
         coalescing_counter_registry::get_time_between_parcels_histogram_counter(
             std::string const& name, std::int64_t min_boundary,
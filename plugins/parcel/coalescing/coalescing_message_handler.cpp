@@ -24,7 +24,9 @@
 #include <hpx/plugins/parcel/coalescing_counter_registry.hpp>
 
 #include <boost/accumulators/accumulators.hpp>
+#include <boost/system/error_code.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -43,6 +45,7 @@ namespace hpx { namespace traits
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      adaptive = 0
     //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
@@ -51,7 +54,8 @@ namespace hpx { namespace traits
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0";
         }
     };
 }}
@@ -87,6 +91,13 @@ namespace hpx { namespace plugins { namespace parcel
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive()
+        {
+            std::string value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive", "0");
+            return !value.empty() && value[0] != '0';
+        }
     }
 
     void coalescing_message_handler::update_num_messages()
@@ -102,6 +113,12 @@ namespace hpx { namespace plugins { namespace parcel
         interval_ = detail::get_interval(interval_);
     }
 
+    void coalescing_message_handler::update_adaptive()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        adaptive_ = detail::get_adaptive();
+    }
+
     coalescing_message_handler::coalescing_message_handler(
             char const* action_name, parcelset::parcelport* pp, std::size_t num,
             std::size_t interval)
@@ -116,6 +133,11 @@ namespace hpx { namespace plugins { namespace parcel
         stopped_(false),
         allow_background_flush_(detail::get_background_flush()),
         action_name_(action_name),
+        adaptive_(detail::get_adaptive()),
+        average_arrival_time_(double(interval_) * 1000.0),
+        average_send_latency_(0.0),
+        batch_size_(1),
+        flush_interval_(0),
         num_parcels_(0), reset_num_parcels_(0),
             reset_num_parcels_per_message_parcels_(0),
         num_messages_(0), reset_num_messages_(0),
@@ -135,6 +157,10 @@ namespace hpx { namespace plugins { namespace parcel
                 get_parcels_per_message_count, this),
             util::bind_front(&coalescing_message_handler::
                 get_average_time_between_parcels, this),
+            util::bind_front(&coalescing_message_handler::get_batch_size, this),
+            util::bind_front(
+                &coalescing_message_handler::get_flush_interval, this),
+            util::bind_front(&coalescing_message_handler::get_send_latency, this),
             util::bind_front(&coalescing_message_handler::
                 get_time_between_parcels_histogram_creator, this));
 
@@ -145,6 +171,9 @@ namespace hpx { namespace plugins { namespace parcel
         set_config_entry_callback(
             "hpx.plugins.coalescing_message_handler.interval",
             util::bind(&coalescing_message_handler::update_interval, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.adaptive",
+            util::bind(&coalescing_message_handler::update_adaptive, this));
     }
 
     void coalescing_message_handler::put_parcel(
@@ -163,18 +192,30 @@ namespace hpx { namespace plugins { namespace parcel
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
-        std::chrono::microseconds interval(interval_);
+        bool const adaptive = adaptive_;
+        std::size_t num_coalesced_parcels = num_coalesced_parcels_;
+        std::chrono::nanoseconds interval = std::chrono::microseconds(interval_);
+
+        if (adaptive)
+        {
+            update_adaptive_parameters(time_since_last_parcel);
+            num_coalesced_parcels = batch_size_;
+            interval = std::chrono::nanoseconds(flush_interval_);
+        }
 
         // just send parcel if the coalescing was stopped or the buffer is
         // empty and time since last parcel is larger than coalescing interval.
         if (stopped_ ||
             (buffer_.empty() &&
-                std::chrono::nanoseconds(time_since_last_parcel) > interval
-           ))
+                (std::chrono::nanoseconds(time_since_last_parcel) > interval ||
+                    (adaptive && num_coalesced_parcels <= 1))))
         {
             ++num_messages_;
             l.unlock();
 
+            if (adaptive)
+                f = measure_send_latency(std::move(f));
+
             // this instance should not buffer parcels anymore
             pp_->put_parcel(dest, std::move(p), std::move(f));
             return;
@@ -183,6 +224,13 @@ namespace hpx { namespace plugins { namespace parcel
         detail::message_buffer::message_buffer_append_state s =
             buffer_.append(dest, std::move(p), std::move(f));
 
+        // the adaptive batch size may be smaller than the buffer
+        if (adaptive && s != detail::message_buffer::buffer_now_full &&
+            buffer_.size() >= num_coalesced_parcels)
+        {
+            s = detail::message_buffer::buffer_now_full;
+        }
+
         switch(s) {
         case detail::message_buffer::first_message:
             HPX_FALLTHROUGH;
@@ -271,15 +319,82 @@ namespace hpx { namespace plugins { namespace parcel
         detail::message_buffer buff (num_coalesced_parcels_);
         std::swap(buff, buffer_);
 
+        bool const adaptive = adaptive_;
+
         ++num_messages_;
         l.unlock();
 
+        if (adaptive)
+        {
+            buff.wrap_first_handler([this](write_handler_type&& f) {
+                return measure_send_latency(std::move(f));
+            });
+        }
+
         HPX_ASSERT(nullptr != pp_);
         buff(pp_);                   // 'invoke' the buffer
 
         return true;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Derive the number of parcels per message and the flush interval from
+    // the observed time between parcels and the observed time it takes to
+    // send a message. This is called while holding mtx_.
+    void coalescing_message_handler::update_adaptive_parameters(
+        std::int64_t time_since_last_parcel)
+    {
+        // a single long pause should not dominate the average
+        double const max_interval = double(interval_) * 1000.0;
+        double const sample =
+            (std::min)(double(time_since_last_parcel), max_interval);
+
+        average_arrival_time_ += (sample - average_arrival_time_) / 8.0;
+
+        // The number of parcels expected to arrive while one message is being
+        // sent. If that is less than one parcel, traffic is sparse and
+        // buffering would only add latency.
+        double const expected_parcels =
+            average_send_latency_ / (std::max)(average_arrival_time_, 1.0);
+
+        if (expected_parcels < 1.0 || num_coalesced_parcels_ <= 1)
+        {
+            batch_size_ = 1;
+            flush_interval_ = 0;
+            return;
+        }
+
+        batch_size_ = (std::min)(
+            (std::max)(std::size_t(expected_parcels) + 1, std::size_t(2)),
+            num_coalesced_parcels_);
+
+        // do not wait longer than it takes to fill the batch
+        flush_interval_ = std::int64_t((std::min)(
+            average_arrival_time_ * double(batch_size_), max_interval));
+    }
+
+    coalescing_message_handler::write_handler_type
+    coalescing_message_handler::measure_send_latency(write_handler_type&& f)
+    {
+        std::int64_t const started_at = util::high_resolution_clock::now();
+        return [this, started_at, f = std::move(f)](
+                   boost::system::error_code const& ec,
+                   parcelset::parcel const& p) {
+            record_send_latency(
+                util::high_resolution_clock::now() - started_at);
+            if (f)
+                f(ec, p);
+        };
+    }
+
+    void coalescing_message_handler::record_send_latency(
+        std::int64_t send_latency)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        average_send_latency_ +=
+            (double(send_latency) - average_send_latency_) / 8.0;
+    }
+
     // performance counter values
     std::int64_t
     coalescing_message_handler::get_average_time_between_parcels(bool reset)
@@ -361,6 +476,29 @@ namespace hpx { namespace plugins { namespace parcel
         return num_messages;
     }
 
+    std::int64_t coalescing_message_handler::get_batch_size(bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        if (!adaptive_)
+            return std::int64_t(num_coalesced_parcels_);
+        return std::int64_t(batch_size_);
+    }
+
+    std::int64_t coalescing_message_handler::get_flush_interval(
+        bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        if (!adaptive_)
+            return std::int64_t(interval_) * 1000;
+        return flush_interval_;
+    }
+
+    std::int64_t coalescing_message_handler::get_send_latency(bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return std::int64_t(average_send_latency_);
+    }
+
     std::vector<std::int64_t>
     coalescing_message_handler::get_time_between_parcels_histogram(bool reset)
     {
@@ -346,6 +346,12 @@ namespace hpx
     defined(__FreeBSD__)
             threads::coroutines::detail::posix::use_guard_pages =
                 cms.rtcfg_.use_stack_guard_pages();
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+            threads::coroutines::detail::posix::stack_cache_size =
+                cms.rtcfg_.get_stack_cache_size();
+            threads::coroutines::detail::posix::stack_cache_high_watermark =
+                cms.rtcfg_.get_stack_cache_high_watermark();
+#endif
 #endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
             if (cms.rtcfg_.enable_lock_detection())
@@ -21,6 +21,8 @@
 #include <hpx/threading_base/annotated_function.hpp>
 #include <hpx/basic_execution/this_thread.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <exception>
 #include <functional>
@@ -78,7 +80,9 @@ namespace hpx { namespace lcos { namespace detail
     ///////////////////////////////////////////////////////////////////////////
     future_data_base<traits::detail::future_data_void>::
         ~future_data_base()
-    {}
+    {
+        reset_on_completed();
+    }
 
     static util::unused_type unused_;
 
@@ -215,6 +219,96 @@ namespace hpx { namespace lcos { namespace detail
         handle_on_completed<completed_callback_vector_type>(
             completed_callback_vector_type&&);
 
+    // The list of continuations is replaced by this marker once the shared
+    // state has become ready.
+    future_data_base<traits::detail::future_data_void>::
+        completed_callback_node*
+    future_data_base<traits::detail::future_data_void>::on_completed_marker()
+    {
+        static completed_callback_node marker;
+        return &marker;
+    }
+
+    void future_data_base<traits::detail::future_data_void>::
+        reset_on_completed()
+    {
+        completed_callback_node* head =
+            on_completed_.exchange(nullptr, std::memory_order_acquire);
+
+        while (head != nullptr && head != on_completed_marker())
+        {
+            completed_callback_node* next = head->next_;
+            if (head != &inline_on_completed_)
+                delete head;
+            head = next;
+        }
+
+        inline_on_completed_.f_.reset();
+        inline_on_completed_.next_ = nullptr;
+        inline_on_completed_used_.store(false, std::memory_order_release);
+    }
+
+    void future_data_base<traits::detail::future_data_void>::handle_ready()
+    {
+        // Waiting threads announce themselves before re-checking the state
+        // (see wait() below), so either they will see the new state or we see
+        // them here.
+        if (waiting_.load(std::memory_order_seq_cst) != 0)
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+
+            // Note: we use notify_one repeatedly instead of notify_all as we
+            //       know: a) that most of the time we have at most one thread
+            //       waiting on the future (most futures are not shared), and
+            //       b) our implementation of condition_variable::notify_one
+            //       relinquishes the lock before resuming the waiting thread
+            //       which avoids suspension of this thread when it tries to
+            //       re-lock the mutex while exiting from condition_variable::wait
+            while (
+                cond_.notify_one(std::move(l), threads::thread_priority_boost))
+            {
+                l = std::unique_lock<mutex_type>(mtx_);
+            }
+
+            // Note: cv.notify_one() above 'consumes' the lock 'l' and leaves
+            //       it unlocked when returning.
+        }
+
+        // close the list of continuations, from now on set_on_completed
+        // invokes the continuations directly
+        completed_callback_node* head = on_completed_.exchange(
+            on_completed_marker(), std::memory_order_acq_rel);
+        if (head == nullptr || head == on_completed_marker())
+            return;
+
+        if (head->next_ == nullptr)
+        {
+            // common case: exactly one continuation was attached
+            completed_callback_type f = std::move(head->f_);
+            if (head != &inline_on_completed_)
+                delete head;
+
+            // invoke the callback (continuation) function
+            handle_on_completed(std::move(f));
+            return;
+        }
+
+        // the list has been built in reverse order
+        completed_callback_vector_type on_completed;
+        while (head != nullptr)
+        {
+            completed_callback_node* next = head->next_;
+            on_completed.push_back(std::move(head->f_));
+            if (head != &inline_on_completed_)
+                delete head;
+            head = next;
+        }
+        std::reverse(on_completed.begin(), on_completed.end());
+
+        // invoke the callback (continuation) functions
+        handle_on_completed(std::move(on_completed));
+    }
+
     /// Set the callback which needs to be invoked when the future becomes
     /// ready. If the future is ready the function will be invoked
     /// immediately.
@@ -223,26 +317,57 @@ namespace hpx { namespace lcos { namespace detail
     {
         if (!data_sink) return;
 
-        if (is_ready())
+        completed_callback_node* head =
+            on_completed_.load(std::memory_order_acquire);
+        if (head == on_completed_marker() || is_ready())
         {
             // invoke the callback (continuation) function right away
             handle_on_completed(std::move(data_sink));
+            return;
         }
-        else
+
+        // the first continuation is stored in the shared state itself
+        completed_callback_node* node = &inline_on_completed_;
+        if (inline_on_completed_used_.exchange(true, std::memory_order_relaxed))
         {
-            std::unique_lock<mutex_type> l(mtx_);
-            if (is_ready())
+            node = new completed_callback_node;
+        }
+        node->f_ = std::move(data_sink);
+
+        do
+        {
+            if (head == on_completed_marker())
             {
-                l.unlock();
+                // the shared state has become ready in the meantime
+                completed_callback_type f = std::move(node->f_);
+                if (node != &inline_on_completed_)
+                    delete node;
 
                 // invoke the callback (continuation) function
-                handle_on_completed(std::move(data_sink));
+                handle_on_completed(std::move(f));
+                return;
             }
-            else
+            node->next_ = head;
+        } while (!on_completed_.compare_exchange_weak(head, node,
+            std::memory_order_release, std::memory_order_acquire));
+    }
+
+    namespace {
+        // announces a thread waiting for the shared state to become ready
+        struct register_waiting
+        {
+            explicit register_waiting(std::atomic<std::size_t>& waiting)
+              : waiting_(waiting)
             {
-                on_completed_.push_back(std::move(data_sink));
+                waiting_.fetch_add(1, std::memory_order_seq_cst);
             }
-        }
+            ~register_waiting()
+            {
+                waiting_.fetch_sub(1, std::memory_order_release);
+            }
+
+            std::atomic<std::size_t>& waiting_;
+        };
     }
 
     future_data_base<traits::detail::future_data_void>::state
@@ -253,7 +378,8 @@ namespace hpx { namespace lcos { namespace detail
         if (s == empty)
         {
             std::unique_lock<mutex_type> l(mtx_);
-            s = state_.load(std::memory_order_relaxed);
+            register_waiting w(waiting_);
+            s = state_.load(std::memory_order_seq_cst);
             if (s == empty)
             {
                 cond_.wait(l, "future_data_base::wait", ec);
@@ -273,7 +399,8 @@ namespace hpx { namespace lcos { namespace detail
         if (state_.load(std::memory_order_acquire) == empty)
         {
             std::unique_lock<mutex_type> l(mtx_);
-            if (state_.load(std::memory_order_relaxed) == empty)
+            register_waiting w(waiting_);
+            if (state_.load(std::memory_order_seq_cst) == empty)
             {
                 threads::thread_state_ex_enum const reason =
                     cond_.wait_until(l, abs_time,
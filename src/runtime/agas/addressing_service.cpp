@@ -92,6 +92,11 @@ namespace hpx { namespace agas
             return key_.first;
         }
 
+        naming::gid_type get_last_gid() const
+        {
+            return key_.second;
+        }
+
         std::uint64_t get_count() const
         {
             naming::gid_type const size = key_.second - key_.first;
@@ -132,11 +137,45 @@ namespace hpx { namespace agas
         }
     }; // }}}
 
+    // Consecutive blocks of ids are assigned to consecutive shards of the
+    // cache. Ranges spanning several blocks are stored in all corresponding
+    // shards, which allows to look up any id of the range in its own shard.
+    struct addressing_service::gva_cache_shard_selector
+    {    // {{{ gva_cache_shard_selector implementation
+        // number of ids per block (as a power of two)
+        static constexpr std::uint64_t block_bits = 4;
+
+        std::pair<std::size_t, std::size_t> operator()(
+            gva_cache_key const& key, std::size_t num_shards) const
+        {
+            naming::gid_type const first = key.get_gid();
+            naming::gid_type const last = key.get_last_gid();
+
+            std::uint64_t const first_block = first.get_lsb() >> block_bits;
+            std::uint64_t const last_block = last.get_lsb() >> block_bits;
+
+            if (first.get_msb() != last.get_msb() ||
+                last_block - first_block >= num_shards)
+            {
+                return std::make_pair(std::size_t(0), num_shards);
+            }
+
+            // spread the ids of different localities over all shards
+            std::uint64_t const msb = first.get_msb();
+            std::uint64_t const offset =
+                ((msb ^ (msb >> 32)) * 0x9e3779b97f4a7c15ull) >> 32;
+
+            return std::make_pair(
+                std::size_t((first_block + offset) % num_shards),
+                std::size_t(last_block - first_block + 1));
+        }
+    }; // }}}
+
 addressing_service::addressing_service(
     util::runtime_configuration const& ini_
   , runtime_mode runtime_type_
     )
-  : gva_cache_(new gva_cache_type)
+  : gva_cache_(new gva_cache_type(ini_.get_agas_local_cache_shards()))
   , console_cache_(naming::invalid_locality_id)
   , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
   , refcnt_requests_count_(0)
@@ -1951,26 +1990,17 @@ void addressing_service::update_cache_entry(
 
         const gva_cache_key key(gid, count);
 
+        if (!gva_cache_->update_if(key, g, check_for_collisions))
         {
-            std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-            if (!gva_cache_->update_if(key, g, check_for_collisions))
+            if (LAGAS_ENABLED(warning))
             {
-                if (LAGAS_ENABLED(warning))
-                {
-                    // Figure out who we collided with.
-                    addressing_service::gva_cache_key idbase;
-                    addressing_service::gva_cache_type::entry_type e;
-
-                    if (!gva_cache_->get_entry(key, idbase, e))
-                    {
-                        // This is impossible under sane conditions.
-                        lock.unlock();
-                        HPX_THROWS_IF(ec, invalid_data
-                          , "addressing_service::update_cache_entry"
-                          , "data corruption or lock error occurred in cache");
-                        return;
-                    }
+                // Figure out who we collided with. The colliding entry may
+                // have been evicted concurrently in the meantime.
+                addressing_service::gva_cache_key idbase;
+                addressing_service::gva_cache_type::entry_type e;
 
+                if (gva_cache_->get_entry(key, idbase, e))
+                {
                     LAGAS_(warning) << hpx::util::format(
                         "addressing_service::update_cache_entry, "
                         "aborting update due to key collision in cache, "
@@ -2003,7 +2033,6 @@ bool addressing_service::get_cache_entry(
     gva_cache_key k(gid);
     gva_cache_key idbase_key;
 
-    std::unique_lock<mutex_type> lock(gva_cache_mtx_);
     if(gva_cache_->get_entry(k, idbase_key, gva))
     {
         const std::uint64_t id_msb =
@@ -2011,7 +2040,6 @@ bool addressing_service::get_cache_entry(
 
         if (HPX_UNLIKELY(id_msb != idbase_key.get_gid().get_msb()))
         {
-            lock.unlock();
             HPX_THROWS_IF(ec, internal_server_error
               , "addressing_service::get_cache_entry"
               , "bad entry in cache, MSBs of GID base and GID do not match");
@@ -2040,8 +2068,6 @@ void addressing_service::clear_cache(
     try {
         LAGAS_(warning) << "addressing_service::clear_cache, clearing cache";
 
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
         gva_cache_->clear();
 
         if (&ec != &throws)
@@ -2087,8 +2113,6 @@ void addressing_service::remove_cache_entry(
     try {
         LAGAS_(warning) << "addressing_service::remove_cache_entry";
 
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
         gva_cache_->erase(
             [&gid](std::pair<gva_cache_key, gva> const& p)
             {
@@ -2238,86 +2262,112 @@ namespace detail
 // Helper functions to access the current cache statistics
 std::uint64_t addressing_service::get_cache_entries(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
     return gva_cache_->size();
 }
 
 std::uint64_t addressing_service::get_cache_hits(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().hits(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.hits(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_misses(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().misses(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.misses(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_evictions(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().evictions(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.evictions(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_insertions(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().insertions(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.insertions(reset);
+        });
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 std::uint64_t addressing_service::get_cache_get_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_get_entry_count(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.get_get_entry_count(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_insertion_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_insert_entry_count(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.get_insert_entry_count(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_update_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_update_entry_count(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.get_update_entry_count(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_erase_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_erase_entry_count(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.get_erase_entry_count(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_get_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_get_entry_time(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.get_get_entry_time(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_insertion_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_insert_entry_time(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.get_insert_entry_time(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_update_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_update_entry_time(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.get_update_entry_time(reset);
+        });
 }
 
 std::uint64_t addressing_service::get_cache_erase_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_erase_entry_time(reset);
+    return gva_cache_->accumulate_statistics(
+        [reset](gva_cache_type::statistics_type& s) {
+            return s.get_erase_entry_time(reset);
+        });
 }
 
 /// Install performance counter types exposing properties from the local cache.
 void addressing_service::register_counter_types()
 { // {{{
+    using util::placeholders::_1;
+    using util::placeholders::_2;
+
     // install
     util::function_nonser<std::int64_t(bool)> cache_entries(
         util::bind_front(&addressing_service::get_cache_entries, this));
@@ -331,6 +331,7 @@ namespace hpx { namespace agas {
     {
         server::primary_namespace::register_counter_types();
         server::primary_namespace::register_global_counter_types();
+        server_->register_table_counter_types();
     }
 
     void primary_namespace::register_server_instance(std::uint32_t locality_id)
@@ -14,8 +14,10 @@
 #include <hpx/basic_execution/register_locks.hpp>
 #include <hpx/errors.hpp>
 #include <hpx/format.hpp>
+#include <hpx/functional/bind.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/bind_front.hpp>
+#include <hpx/functional/function.hpp>
 #include <hpx/lcos/wait_all.hpp>
 #include <hpx/logging.hpp>
 #include <hpx/performance_counters/counter_creators.hpp>
@@ -36,7 +38,6 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
-#include <list>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -162,6 +163,101 @@ void primary_namespace::register_global_counter_types(
     }
 }
 
+void primary_namespace::register_table_counter_types(
+    error_code& ec
+    )
+{
+    using util::placeholders::_1;
+    using util::placeholders::_2;
+
+    util::function_nonser<std::int64_t(bool)> gva_acquisitions(
+        util::bind_front(
+            &primary_namespace::get_gva_table_acquisitions, this));
+    util::function_nonser<std::int64_t(bool)> gva_contentions(
+        util::bind_front(
+            &primary_namespace::get_gva_table_contentions, this));
+    util::function_nonser<std::int64_t(bool)> gva_wait_time(
+        util::bind_front(
+            &primary_namespace::get_gva_table_wait_time, this));
+    util::function_nonser<std::int64_t(bool)> refcnt_acquisitions(
+        util::bind_front(
+            &primary_namespace::get_refcnt_table_acquisitions, this));
+    util::function_nonser<std::int64_t(bool)> refcnt_contentions(
+        util::bind_front(
+            &primary_namespace::get_refcnt_table_contentions, this));
+    util::function_nonser<std::int64_t(bool)> refcnt_wait_time(
+        util::bind_front(
+            &primary_namespace::get_refcnt_table_wait_time, this));
+
+    performance_counters::generic_counter_type_data const counter_types[] =
+    {
+        { "/agas/primary/gva_table/count/acquisitions",
+          performance_counters::counter_monotonically_increasing,
+          "returns the number of times a lock protecting the GVA table of "
+              "the primary namespace was acquired",
+          HPX_PERFORMANCE_COUNTER_V1,
+          util::bind(&performance_counters::locality_raw_counter_creator,
+              _1, gva_acquisitions, _2),
+          &performance_counters::locality_counter_discoverer,
+          ""
+        },
+        { "/agas/primary/gva_table/count/contentions",
+          performance_counters::counter_monotonically_increasing,
+          "returns the number of times a lock protecting the GVA table of "
+              "the primary namespace was found to be held by another thread",
+          HPX_PERFORMANCE_COUNTER_V1,
+          util::bind(&performance_counters::locality_raw_counter_creator,
+              _1, gva_contentions, _2),
+          &performance_counters::locality_counter_discoverer,
+          ""
+        },
+        { "/agas/primary/gva_table/time/lock_wait",
+          performance_counters::counter_elapsed_time,
+          "returns the overall time spent waiting for the locks protecting "
+              "the GVA table of the primary namespace",
+          HPX_PERFORMANCE_COUNTER_V1,
+          util::bind(&performance_counters::locality_raw_counter_creator,
+              _1, gva_wait_time, _2),
+          &performance_counters::locality_counter_discoverer,
+          "ns"
+        },
+        { "/agas/primary/refcnt_table/count/acquisitions",
+          performance_counters::counter_monotonically_increasing,
+          "returns the number of times a lock protecting the reference count "
+              "table of the primary namespace was acquired",
+          HPX_PERFORMANCE_COUNTER_V1,
+          util::bind(&performance_counters::locality_raw_counter_creator,
+              _1, refcnt_acquisitions, _2),
+          &performance_counters::locality_counter_discoverer,
+          ""
+        },
+        { "/agas/primary/refcnt_table/count/contentions",
+          performance_counters::counter_monotonically_increasing,
+          "returns the number of times a lock protecting the reference count "
+              "table of the primary namespace was found to be held by "
+              "another thread",
+          HPX_PERFORMANCE_COUNTER_V1,
+          util::bind(&performance_counters::locality_raw_counter_creator,
+              _1, refcnt_contentions, _2),
+          &performance_counters::locality_counter_discoverer,
+          ""
+        },
+        { "/agas/primary/refcnt_table/time/lock_wait",
+          performance_counters::counter_elapsed_time,
+          "returns the overall time spent waiting for the locks protecting "
+              "the reference count table of the primary namespace",
+          HPX_PERFORMANCE_COUNTER_V1,
+          util::bind(&performance_counters::locality_raw_counter_creator,
+              _1, refcnt_wait_time, _2),
+          &performance_counters::locality_counter_discoverer,
+          "ns"
+        }
+    };
+
+    performance_counters::install_counter_types(
+        counter_types, sizeof(counter_types)/sizeof(counter_types[0]), ec);
+}
+
 void primary_namespace::register_server_instance(
     char const* servicename
   , std::uint32_t locality_id
@@ -345,6 +441,92 @@ void primary_namespace::wait_for_migration_locked(
     }
 }
 
+namespace
+{
+    // Update an existing binding (e.g. move semantics), returns the error to
+    // report if the binding can't be updated.
+    std::pair<error, std::string> rebind_gid(
+        primary_namespace::gva_table_data_type& data
+      , gva const& g
+      , naming::gid_type const& gid
+      , naming::gid_type const& id
+      , naming::gid_type const& locality
+        )
+    {
+        // non-migratable gids can't be rebound
+        if (naming::refers_to_local_lva(gid) &&
+            !naming::refers_to_virtual_memory(gid))
+        {
+            return std::make_pair(bad_parameter,
+                std::string("cannot rebind gids for non-migratable objects"));
+        }
+
+        gva& gaddr = data.first;
+        naming::gid_type& loc = data.second;
+
+        // Check for count mismatch (we can't change block sizes of
+        // existing bindings).
+        if (HPX_UNLIKELY(gaddr.count != g.count))
+        {
+            // REVIEW: Is this the right error code to use?
+            return std::make_pair(bad_parameter,
+                std::string("cannot change block size of existing binding"));
+        }
+
+        if (HPX_UNLIKELY(components::component_invalid == g.type))
+        {
+            return std::make_pair(bad_parameter, hpx::util::format(
+                "attempt to update a GVA with an invalid type, "
+                "gid({1}), gva({2}), locality({3})",
+                id, g, locality));
+        }
+
+        if (HPX_UNLIKELY(!locality))
+        {
+            return std::make_pair(bad_parameter, hpx::util::format(
+                "attempt to update a GVA with an invalid locality id, "
+                "gid({1}), gva({2}), locality({3})",
+                id, g, locality));
+        }
+
+        // Store the new endpoint and offset
+        gaddr.prefix = g.prefix;
+        gaddr.type   = g.type;
+        gaddr.lva(g.lva());
+        gaddr.offset = g.offset;
+        loc = locality;
+
+        return std::make_pair(success, std::string());
+    }
+
+    // Verify that a new binding can be inserted, returns the error to report
+    // otherwise.
+    std::pair<error, std::string> validate_new_binding(
+        gva const& g
+      , naming::gid_type const& id
+      , naming::gid_type const& locality
+        )
+    {
+        naming::gid_type upper_bound(id + (g.count - 1));
+
+        if (HPX_UNLIKELY(id.get_msb() != upper_bound.get_msb()))
+        {
+            return std::make_pair(internal_server_error,
+                std::string("MSBs of lower and upper range bound do not match"));
+        }
+
+        if (HPX_UNLIKELY(components::component_invalid == g.type))
+        {
+            return std::make_pair(bad_parameter, hpx::util::format(
+                "attempt to insert a GVA with an invalid type, "
+                "gid({1}), gva({2}), locality({3})",
+                id, g, locality));
+        }
+
+        return std::make_pair(success, std::string());
+    }
+}
+
 bool primary_namespace::bind_gid(
     gva const& g
   , naming::gid_type id
@@ -361,77 +543,95 @@ bool primary_namespace::bind_gid(
     naming::gid_type gid = id;
     naming::detail::strip_internal_bits_from_gid(id);
 
-    std::unique_lock<mutex_type> l(mutex_);
-
-    gva_table_type::iterator it = gvas_.lower_bound(id)
-                           , begin = gvas_.begin()
-                           , end = gvas_.end();
-
-    if (it != end)
+    bool const is_range = g.count > 1;
+    std::pair<error, std::string> result(success, std::string());
+
+    // The range table has to be consulted first: the request could update an
+    // existing range binding or the new id could be covered by an existing
+    // range. The lock is held while inserting a new range.
+    //
+    // Note that a concurrently inserted range covering a new single object
+    // binding is not detected, ids are never handed out twice by allocate().
+    std::unique_lock<mutex_type> rl(gva_ranges_mtx_, std::defer_lock);
+    if (is_range || num_gva_ranges_.load(std::memory_order_acquire) != 0)
     {
-        // If we got an exact match, this is a request to update an existing
-        // binding (e.g. move semantics).
-        if (it->first == id)
+        rl = gva_ranges_statistics_.lock(gva_ranges_mtx_);
+
+        gva_range_table_type::iterator it = gva_ranges_.upper_bound(id);
+        if (it != gva_ranges_.begin())
         {
-            // non-migratable gids can't be rebound
-            if (naming::refers_to_local_lva(gid) &&
-                !naming::refers_to_virtual_memory(gid))
+            --it;
+
+            // If we got an exact match, this is a request to update an
+            // existing binding (e.g. move semantics).
+            if (it->first == id)
             {
-                l.unlock();
+                result = rebind_gid(it->second, g, gid, id, locality);
+                rl.unlock();
 
-                HPX_THROW_EXCEPTION(bad_parameter, "primary_namespace::bind_gid",
-                    "cannot rebind gids for non-migratable objects");
+                if (result.first != success)
+                {
+                    HPX_THROW_EXCEPTION(result.first
+                      , "primary_namespace::bind_gid"
+                      , result.second);
+                }
+
+                LAGAS_(info) << hpx::util::format(
+                    "primary_namespace::bind_gid, gid({1}), gva({2}), "
+                    "locality({3}), response(repeated_request)",
+                    id, g, locality);
 
                 return false;
             }
 
-            gva& gaddr = it->second.first;
-            naming::gid_type& loc = it->second.second;
-
-            // Check for count mismatch (we can't change block sizes of
-            // existing bindings).
-            if (HPX_UNLIKELY(gaddr.count != g.count))
+            // Check that a previous range doesn't cover the new id.
+            if (HPX_UNLIKELY((it->first + it->second.first.count) > id))
             {
                 // REVIEW: Is this the right error code to use?
-                l.unlock();
+                rl.unlock();
 
                 HPX_THROW_EXCEPTION(bad_parameter
                   , "primary_namespace::bind_gid"
-                  , "cannot change block size of existing binding");
+                  , "the new GID is contained in an existing range");
             }
+        }
 
-            if (HPX_UNLIKELY(components::component_invalid == g.type))
-            {
-                l.unlock();
+        if (!is_range)
+            rl.unlock();
+    }
 
-                HPX_THROW_EXCEPTION(bad_parameter
-                  , "primary_namespace::bind_gid"
-                  , hpx::util::format(
-                        "attempt to update a GVA with an invalid type, "
-                        "gid({1}), gva({2}), locality({3})",
-                        id, g, locality));
-            }
+    // non-migratable gids don't need to be bound
+    if (naming::refers_to_local_lva(gid) &&
+        !naming::refers_to_virtual_memory(gid))
+    {
+        if (rl.owns_lock())
+            rl.unlock();
 
-            if (HPX_UNLIKELY(!locality))
-            {
-                l.unlock();
+        LAGAS_(info) << hpx::util::format(
+            "primary_namespace::bind_gid, gid({1}), gva({2}), locality({3})",
+            gid, g, locality);
 
-                HPX_THROW_EXCEPTION(bad_parameter
-                  , "primary_namespace::bind_gid"
-                  , hpx::util::format(
-                        "attempt to update a GVA with an invalid locality id, "
-                        "gid({1}), gva({2}), locality({3})",
-                        id, g, locality));
-            }
+        return true;
+    }
 
-            // Store the new endpoint and offset
-            gaddr.prefix = g.prefix;
-            gaddr.type   = g.type;
-            gaddr.lva(g.lva());
-            gaddr.offset = g.offset;
-            loc = locality;
+    {
+        gva_table_type::shard& s = gvas_.get_shard(id);
+        std::unique_lock<mutex_type> l = gvas_.lock(s);
 
+        auto it = s.map_.find(id);
+        if (it != s.map_.end())
+        {
+            result = rebind_gid(it->second, g, gid, id, locality);
             l.unlock();
+            if (rl.owns_lock())
+                rl.unlock();
+
+            if (result.first != success)
+            {
+                HPX_THROW_EXCEPTION(result.first
+                  , "primary_namespace::bind_gid"
+                  , result.second);
+            }
 
             LAGAS_(info) << hpx::util::format(
                 "primary_namespace::bind_gid, gid({1}), gva({2}), "
@@ -441,91 +641,56 @@ bool primary_namespace::bind_gid(
             return false;
         }
 
-        // We're about to decrement the iterator it - first, we
-        // check that it's safe to do this.
-        else if (it != begin)
+        if (!is_range)
         {
-            --it;
+            result = validate_new_binding(g, id, locality);
 
-            // Check that a previous range doesn't cover the new id.
-            if (HPX_UNLIKELY((it->first + it->second.first.count) > id))
+            // Insert a GID -> GVA entry into the GVA table.
+            if (result.first == success &&
+                HPX_UNLIKELY(!util::insert_checked(s.map_.insert(
+                    std::make_pair(id, std::make_pair(g, locality))))))
             {
-                // REVIEW: Is this the right error code to use?
-                l.unlock();
-
-                HPX_THROW_EXCEPTION(bad_parameter
-                  , "primary_namespace::bind_gid"
-                  , "the new GID is contained in an existing range");
+                result = std::make_pair(lock_error, hpx::util::format(
+                    "GVA table insertion failed due to a locking error or "
+                    "memory corruption, gid({1}), gva({2}), locality({3})",
+                    id, g, locality));
             }
         }
     }
 
-    else if (HPX_LIKELY(!gvas_.empty()))
+    if (is_range)
     {
-        --it;
+        HPX_ASSERT(rl.owns_lock());
 
-        // Check that a previous range doesn't cover the new id.
-        if ((it->first + it->second.first.count) > id)
-        {
-            // REVIEW: Is this the right error code to use?
-            l.unlock();
+        result = validate_new_binding(g, id, locality);
 
-            HPX_THROW_EXCEPTION(bad_parameter
-              , "primary_namespace::bind_gid"
-              , "the new GID is contained in an existing range");
+        // Insert a GID -> GVA entry into the GVA range table.
+        if (result.first == success)
+        {
+            if (HPX_UNLIKELY(!util::insert_checked(gva_ranges_.insert(
+                    std::make_pair(id, std::make_pair(g, locality))))))
+            {
+                result = std::make_pair(lock_error, hpx::util::format(
+                    "GVA table insertion failed due to a locking error or "
+                    "memory corruption, gid({1}), gva({2}), locality({3})",
+                    id, g, locality));
+            }
+            else
+            {
+                num_gva_ranges_.fetch_add(1, std::memory_order_release);
+            }
         }
-    }
-
-    // non-migratable gids don't need to be bound
-    if (naming::refers_to_local_lva(gid) &&
-        !naming::refers_to_virtual_memory(gid))
-    {
-        LAGAS_(info) << hpx::util::format(
-            "primary_namespace::bind_gid, gid({1}), gva({2}), locality({3})",
-            gid, g, locality);
-
-        return true;
-    }
-
-    naming::gid_type upper_bound(id + (g.count - 1));
-
-    if (HPX_UNLIKELY(id.get_msb() != upper_bound.get_msb()))
-    {
-        l.unlock();
 
-        HPX_THROW_EXCEPTION(internal_server_error
-          , "primary_namespace::bind_gid"
-          , "MSBs of lower and upper range bound do not match");
-    }
-
-    if (HPX_UNLIKELY(components::component_invalid == g.type))
-    {
-        l.unlock();
-
-        HPX_THROW_EXCEPTION(bad_parameter
-          , "primary_namespace::bind_gid"
-          , hpx::util::format(
-                "attempt to insert a GVA with an invalid type, "
-                "gid({1}), gva({2}), locality({3})",
-                id, g, locality));
+        rl.unlock();
     }
 
-    // Insert a GID -> GVA entry into the GVA table.
-    if (HPX_UNLIKELY(!util::insert_checked(gvas_.insert(
-            std::make_pair(id, std::make_pair(g, locality))))))
+    if (result.first != success)
     {
-        l.unlock();
-
-        HPX_THROW_EXCEPTION(lock_error
+        HPX_THROW_EXCEPTION(result.first
           , "primary_namespace::bind_gid"
-          , hpx::util::format(
-                "GVA table insertion failed due to a locking error or "
-                "memory corruption, gid({1}), gva({2}), locality({3})",
-                id, g, locality));
+          , result.second);
     }
 
-    l.unlock();
-
     LAGAS_(info) << hpx::util::format(
         "primary_namespace::bind_gid, gid({1}), gva({2}), locality({3})",
         id, g, locality);
@@ -546,11 +711,13 @@ primary_namespace::resolved_type primary_namespace::resolve_gid(
     resolved_type r;
 
     {
-        std::unique_lock<mutex_type> l(mutex_);
+        // the lock protects the migration table only
+        std::unique_lock<mutex_type> l(mutex_, std::defer_lock);
 
         // wait for any migration to be completed
         if (naming::detail::is_migratable(id))
         {
+            l.lock();
             wait_for_migration_locked(l, id, hpx::throws);
         }
 
@@ -592,27 +759,55 @@ naming::address primary_namespace::unbind_gid(
 
     naming::detail::strip_internal_bits_from_gid(id);
 
-    std::unique_lock<mutex_type> l(mutex_);
+    bool found = false;
+    bool count_mismatch = false;
+    gva_table_data_type data;
 
-    gva_table_type::iterator it = gvas_.find(id)
-                           , end = gvas_.end();
+    {
+        gva_table_type::shard& s = gvas_.get_shard(id);
+        std::unique_lock<mutex_type> l = gvas_.lock(s);
 
-    if (it != end)
+        auto it = s.map_.find(id);
+        if (it != s.map_.end())
+        {
+            found = true;
+            count_mismatch = it->second.first.count != count;
+            if (!count_mismatch)
+            {
+                data = it->second;
+                s.map_.erase(it);
+            }
+        }
+    }
+
+    if (!found && num_gva_ranges_.load(std::memory_order_acquire) != 0)
     {
-        if (HPX_UNLIKELY(it->second.first.count != count))
+        std::unique_lock<mutex_type> rl =
+            gva_ranges_statistics_.lock(gva_ranges_mtx_);
+
+        gva_range_table_type::iterator it = gva_ranges_.find(id);
+        if (it != gva_ranges_.end())
         {
-            l.unlock();
+            found = true;
+            count_mismatch = it->second.first.count != count;
+            if (!count_mismatch)
+            {
+                data = it->second;
+                gva_ranges_.erase(it);
+                num_gva_ranges_.fetch_sub(1, std::memory_order_release);
+            }
+        }
+    }
 
+    if (found)
+    {
+        if (HPX_UNLIKELY(count_mismatch))
+        {
             HPX_THROW_EXCEPTION(bad_parameter
               , "primary_namespace::unbind_gid"
               , "block sizes must match");
         }
 
-        gva_table_data_type data = it->second;
-
-        gvas_.erase(it);
-
-        l.unlock();
         LAGAS_(info) << hpx::util::format(
             "primary_namespace::unbind_gid, gid({1}), count({2}), gva({3}), "
             "locality_id({4})",
@@ -639,8 +834,6 @@ naming::address primary_namespace::unbind_gid(
         return naming::address(g.prefix, g.type, g.lva());
     }
 
-    l.unlock();
-
     LAGAS_(info) << hpx::util::format(
         "primary_namespace::unbind_gid, gid({1}), count({2}), "
         "response(no_success)",
@@ -795,37 +988,42 @@ std::pair<naming::gid_type, naming::gid_type> primary_namespace::allocate(
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     void primary_namespace::dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it
-      , refcnt_table_type::iterator upper_it
-      , naming::gid_type const& lower
+        naming::gid_type const& lower
       , naming::gid_type const& upper
-      , std::unique_lock<mutex_type>& l
       , const char* func_name
         )
     { // dump_refcnt_matches implementation
-        HPX_ASSERT(l.owns_lock());
-
-        if (lower_it == refcnts_.end() && upper_it == refcnts_.end())
-            // We got nothing, bail - our caller is probably about to throw.
-            return;
-
         std::stringstream ss;
         hpx::util::format_to(ss,
             "{1}, dumping server-side refcnt table matches, lower({2}), "
             "upper({3}):",
             func_name, lower, upper);
 
-        for (/**/; lower_it != upper_it; ++lower_it)
+        bool found = false;
+        naming::gid_type raw = lower;
+        do
         {
-            // The [server] tag is in there to make it easier to filter
-            // through the logs.
-            hpx::util::format_to(ss,
-                "\n  [server] lower({1}), credits({2})",
-                lower_it->first,
-                lower_it->second);
-        }
+            refcnt_table_type::shard& s = refcnts_.get_shard(raw);
+            std::unique_lock<mutex_type> l = refcnts_.lock(s);
 
-        LAGAS_(debug) << ss.str();
+            auto it = s.map_.find(raw);
+            if (it != s.map_.end())
+            {
+                // The [server] tag is in there to make it easier to filter
+                // through the logs.
+                hpx::util::format_to(ss,
+                    "\n  [server] lower({1}), credits({2})",
+                    it->first,
+                    it->second);
+                found = true;
+            }
+        } while (++raw < upper);
+
+        // We got nothing, bail - our caller is probably about to throw.
+        if (found)
+        {
+            LAGAS_(debug) << ss.str();
+        }
     } // dump_refcnt_matches implementation
 #endif
 
@@ -837,28 +1035,11 @@ void primary_namespace::increment(
   , error_code& ec
     )
 { // {{{ increment implementation
-    std::unique_lock<mutex_type> l(mutex_);
-
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     if (LAGAS_ENABLED(debug))
     {
-        typedef refcnt_table_type::iterator iterator;
-
-        // Find the mappings that we're about to touch.
-        refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-        refcnt_table_type::iterator upper_it;
-        if (lower != upper)
-        {
-            upper_it = refcnts_.find(upper);
-        }
-        else
-        {
-            upper_it = lower_it;
-            ++upper_it;
-        }
-
-        dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-            "primary_namespace::increment");
+        // Dump the mappings that we're about to touch.
+        dump_refcnt_matches(lower, upper, "primary_namespace::increment");
     }
 #endif
 
@@ -867,44 +1048,26 @@ void primary_namespace::increment(
     // reference count is 2^64 - 2. The maximum number of credits a single GID
     // can hold, however, is limited to 2^32 - 1.
 
-    // The third parameter we pass here is the default data to use in case the
-    // key is not mapped. We don't insert GIDs into the refcnt table when we
-    // allocate/bind them, so if a GID is not in the refcnt table, we know that
-    // it's global reference count is the initial global reference count.
+    // We don't insert GIDs into the refcnt table when we allocate/bind them,
+    // so if a GID is not in the refcnt table, we know that it's global
+    // reference count is the initial global reference count.
 
+    // Each entry is updated while holding the lock of its shard only.
     for (naming::gid_type raw = lower; raw != upper; ++raw)
     {
-        refcnt_table_type::iterator it = refcnts_.find(raw);
-        if (it == refcnts_.end())
-        {
-            std::int64_t count =
-                std::int64_t(HPX_GLOBALCREDIT_INITIAL) + credits;
+        refcnt_table_type::shard& s = refcnts_.get_shard(raw);
+        std::unique_lock<mutex_type> l = refcnts_.lock(s);
 
-            std::pair<refcnt_table_type::iterator, bool> p =
-                refcnts_.insert(refcnt_table_type::value_type(raw, count));
-            if (!p.second)
-            {
-                l.unlock();
+        std::int64_t& count = s.map_.emplace(
+            raw, std::int64_t(HPX_GLOBALCREDIT_INITIAL)).first->second;
+        count += credits;
 
-                HPX_THROWS_IF(ec, invalid_data
-                    , "primary_namespace::increment"
-                    , hpx::util::format(
-                        "couldn't create entry in reference count table, "
-                        "raw({1}), ref-count({2})",
-                        raw, count));
-                return;
-            }
-
-            it = p.first;
-        }
-        else
-        {
-            it->second += credits;
-        }
+        std::int64_t const refcnt = count;
+        l.unlock();
 
         LAGAS_(info) << hpx::util::format(
             "primary_namespace::increment, raw({1}), refcnt({2})",
-            lower, it->second);
+            lower, refcnt);
     }
 
     if (&ec != &throws)
@@ -913,30 +1076,24 @@ void primary_namespace::increment(
 
 ///////////////////////////////////////////////////////////////////////////////
 void primary_namespace::resolve_free_list(
-    std::unique_lock<mutex_type>& l
-  , std::list<refcnt_table_type::iterator> const& free_list
+    std::vector<naming::gid_type> const& free_list
   , free_entry_list_type& free_entry_list
   , naming::gid_type const& lower
   , naming::gid_type const& upper
   , error_code& ec
     )
 {
-    HPX_ASSERT_OWNS_LOCK(l);
-
     using hpx::util::get;
 
-    typedef refcnt_table_type::iterator iterator;
-
-    for (iterator const& it : free_list)
+    for (naming::gid_type const& gid : free_list)
     {
-        typedef refcnt_table_type::key_type key_type;
-
-        // The mapping's key space.
-        key_type gid = it->first;
+        // the lock protects the migration table only
+        std::unique_lock<mutex_type> l(mutex_, std::defer_lock);
 
         if (naming::detail::is_migratable(gid))
         {
             // wait for any migration to be completed
+            l.lock();
             wait_for_migration_locked(l, gid, ec);
         }
 
@@ -944,11 +1101,12 @@ void primary_namespace::resolve_free_list(
         resolved_type r = resolve_gid_locked(l, gid, ec);
         if (ec) return;
 
+        if (l.owns_lock())
+            l.unlock();
+
         naming::gid_type& raw = get<0>(r);
         if (raw == naming::invalid_gid)
         {
-            l.unlock();
-
             HPX_THROWS_IF(ec, internal_server_error
                 , "primary_namespace::resolve_free_list"
                 , hpx::util::format(
@@ -964,8 +1122,6 @@ void primary_namespace::resolve_free_list(
         // REVIEW: Should we do more to make sure the GVA is valid?
         if (HPX_UNLIKELY(components::component_invalid == g.type))
         {
-            l.unlock();
-
             HPX_THROWS_IF(ec, internal_server_error
                 , "primary_namespace::resolve_free_list"
                 , hpx::util::format(
@@ -976,8 +1132,6 @@ void primary_namespace::resolve_free_list(
         }
         else if (HPX_UNLIKELY(0 == g.count))
         {
-            l.unlock();
-
             HPX_THROWS_IF(ec, internal_server_error
                 , "primary_namespace::resolve_free_list"
                 , hpx::util::format(
@@ -1000,7 +1154,12 @@ void primary_namespace::resolve_free_list(
         free_entry_list.push_back(free_entry(resolved, gid, get<2>(r)));
 
         // remove this entry from the refcnt table
-        refcnts_.erase(it);
+        refcnt_table_type::shard& s = refcnts_.get_shard(gid);
+        std::unique_lock<mutex_type> rl = refcnts_.lock(s);
+
+        auto it = s.map_.find(gid);
+        if (it != s.map_.end() && it->second == 0)
+            s.map_.erase(it);
     }
 }
 
@@ -1020,88 +1179,34 @@ void primary_namespace::decrement_sweep(
 
     free_entry_list.clear();
 
-    {
-        std::unique_lock<mutex_type> l(mutex_);
-
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-        if (LAGAS_ENABLED(debug))
-        {
-            typedef refcnt_table_type::iterator iterator;
-
-            // Find the mappings that we just added or modified.
-            refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-            refcnt_table_type::iterator upper_it;
-            if (lower != upper)
-            {
-                upper_it = refcnts_.find(upper);
-            }
-            else
-            {
-                upper_it = lower_it;
-                ++upper_it;
-            }
-
-            dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                "primary_namespace::decrement_sweep");
-        }
+    if (LAGAS_ENABLED(debug))
+    {
+        // Dump the mappings that we're about to modify.
+        dump_refcnt_matches(lower, upper, "primary_namespace::decrement_sweep");
+    }
 #endif
 
-        ///////////////////////////////////////////////////////////////////////
-        // Apply the decrement across the entire key space (e.g. [lower, upper]).
-
-        // The third parameter we pass here is the default data to use in case
-        // the key is not mapped. We don't insert GIDs into the refcnt table
-        // when we allocate/bind them, so if a GID is not in the refcnt table,
-        // we know that it's global reference count is the initial global
-        // reference count.
-
-        std::list<refcnt_table_type::iterator> free_list;
-        for (naming::gid_type raw = lower; raw != upper; ++raw)
-        {
-            refcnt_table_type::iterator it = refcnts_.find(raw);
-            if (it == refcnts_.end())
-            {
-                if (credits > std::int64_t(HPX_GLOBALCREDIT_INITIAL))
-                {
-                    l.unlock();
-
-                    HPX_THROWS_IF(ec, invalid_data
-                      , "primary_namespace::decrement_sweep"
-                      , hpx::util::format(
-                            "negative entry in reference count table, raw({1}), "
-                            "refcount({2})",
-                            raw,
-                            std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits));
-                    return;
-                }
-
-                std::int64_t count =
-                    std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits;
+    ///////////////////////////////////////////////////////////////////////////
+    // Apply the decrement across the entire key space (e.g. [lower, upper]).
 
-                std::pair<refcnt_table_type::iterator, bool> p =
-                    refcnts_.insert(refcnt_table_type::value_type(raw, count));
-                if (!p.second)
-                {
-                    l.unlock();
-
-                    HPX_THROWS_IF(ec, invalid_data
-                      , "primary_namespace::decrement_sweep"
-                      , hpx::util::format(
-                            "couldn't create entry in reference count table, "
-                            "raw({1}), ref-count({2})",
-                            raw, count));
-                    return;
-                }
+    // We don't insert GIDs into the refcnt table when we allocate/bind them,
+    // so if a GID is not in the refcnt table, we know that it's global
+    // reference count is the initial global reference count.
 
-                it = p.first;
-            }
-            else
-            {
-                it->second -= credits;
-            }
+    // Each entry is updated while holding the lock of its shard only. Entries
+    // dropping to zero are removed by resolve_free_list once the object was
+    // resolved, they are kept if that fails.
+    std::vector<naming::gid_type> free_list;
+    for (naming::gid_type raw = lower; raw != upper; ++raw)
+    {
+        refcnt_table_type::shard& s = refcnts_.get_shard(raw);
+        std::unique_lock<mutex_type> l = refcnts_.lock(s);
 
-            // Sanity check.
-            if (it->second < 0)
+        auto it = s.map_.find(raw);
+        if (it == s.map_.end())
+        {
+            if (credits > std::int64_t(HPX_GLOBALCREDIT_INITIAL))
             {
                 l.unlock();
 
@@ -1110,19 +1215,42 @@ void primary_namespace::decrement_sweep(
                   , hpx::util::format(
                         "negative entry in reference count table, raw({1}), "
                         "refcount({2})",
-                        raw, it->second));
+                        raw,
+                        std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits));
                 return;
             }
 
-            // this objects needs to be deleted
-            if (it->second == 0)
-                free_list.push_back(it);
+            it = s.map_.emplace(
+                raw, std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits).first;
+        }
+        else
+        {
+            it->second -= credits;
+        }
+
+        // Sanity check.
+        if (it->second < 0)
+        {
+            std::int64_t const refcnt = it->second;
+            l.unlock();
+
+            HPX_THROWS_IF(ec, invalid_data
+              , "primary_namespace::decrement_sweep"
+              , hpx::util::format(
+                    "negative entry in reference count table, raw({1}), "
+                    "refcount({2})",
+                    raw, refcnt));
+            return;
         }
 
-        // Resolve the objects which have to be deleted.
-        resolve_free_list(l, free_list, free_entry_list, lower, upper, ec);
+        // this objects needs to be deleted
+        if (it->second == 0)
+            free_list.push_back(raw);
+    }
 
-    } // Unlock the mutex.
+    // Resolve the objects which have to be deleted.
+    resolve_free_list(free_list, free_entry_list, lower, upper, ec);
+    if (ec) return;
 
     if (&ec != &throws)
         ec = make_success_code();
@@ -1195,8 +1323,6 @@ primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
   , error_code& ec
     )
 { // {{{ resolve_gid_locked implementation
-    HPX_ASSERT_OWNS_LOCK(l);
-
     // handle (non-migratable) components located on this locality first
     if (naming::refers_to_local_lva(gid) &&
         !naming::refers_to_virtual_memory(gid))
@@ -1212,14 +1338,13 @@ primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
     naming::gid_type id = gid;
     naming::detail::strip_internal_bits_from_gid(id);
 
-    gva_table_type::const_iterator it = gvas_.lower_bound(id)
-                                 , begin = gvas_.begin()
-                                 , end = gvas_.end();
-
-    if (it != end)
+    // Check for exact match, this finds all bindings of single objects
     {
-        // Check for exact match
-        if (it->first == id)
+        gva_table_type::shard& s = gvas_.get_shard(id);
+        std::unique_lock<mutex_type> sl = gvas_.lock(s);
+
+        auto it = s.map_.find(id);
+        if (it != s.map_.end())
         {
             if (&ec != &throws)
                 ec = make_success_code();
@@ -1227,10 +1352,16 @@ primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
             gva_table_data_type const& data = it->second;
             return resolved_type(it->first, data.first, data.second);
         }
+    }
 
-        // We need to decrement the iterator, first we check that it's safe
-        // to do this.
-        else if (it != begin)
+    // Look for a range containing the GID
+    if (num_gva_ranges_.load(std::memory_order_acquire) != 0)
+    {
+        std::unique_lock<mutex_type> rl =
+            gva_ranges_statistics_.lock(gva_ranges_mtx_);
+
+        gva_range_table_type::const_iterator it = gva_ranges_.upper_bound(id);
+        if (it != gva_ranges_.begin())
         {
             --it;
 
@@ -1240,7 +1371,9 @@ primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
             {
                 if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
                 {
-                    l.unlock();
+                    rl.unlock();
+                    if (l.owns_lock())
+                        l.unlock();
 
                     HPX_THROWS_IF(ec, internal_server_error
                       , "primary_namespace::resolve_gid_locked"
@@ -1257,32 +1390,6 @@ primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
         }
     }
 
-    else if (HPX_LIKELY(!gvas_.empty()))
-    {
-        --it;
-
-        // Found the GID in a range
-        gva_table_data_type const& data = it->second;
-        if ((it->first + data.first.count) > id)
-        {
-            if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
-            {
-                l.unlock();
-
-                HPX_THROWS_IF(ec, internal_server_error
-                  , "primary_namespace::resolve_gid_locked"
-                  , "MSBs of lower and upper range bound do not match");
-                return resolved_type(naming::invalid_gid, gva(),
-                    naming::invalid_gid);
-            }
-
-            if (&ec != &throws)
-                ec = make_success_code();
-
-            return resolved_type(it->first, data.first, data.second);
-        }
-    }
-
     if (&ec != &throws)
         ec = make_success_code();
 
@@ -1464,6 +1571,44 @@ naming::gid_type primary_namespace::statistics_counter(std::string const& name)
 }
 
 // access current counter values
+///////////////////////////////////////////////////////////////////////////////
+// access lock statistics of the GVA and reference count tables
+std::int64_t primary_namespace::get_gva_table_acquisitions(bool reset)
+{
+    return gvas_.get_acquisitions(reset) +
+        detail::table_lock_statistics::get_value(
+            gva_ranges_statistics_.acquisitions_, reset);
+}
+
+std::int64_t primary_namespace::get_gva_table_contentions(bool reset)
+{
+    return gvas_.get_contentions(reset) +
+        detail::table_lock_statistics::get_value(
+            gva_ranges_statistics_.contentions_, reset);
+}
+
+std::int64_t primary_namespace::get_gva_table_wait_time(bool reset)
+{
+    return gvas_.get_wait_time(reset) +
+        detail::table_lock_statistics::get_value(
+            gva_ranges_statistics_.wait_time_, reset);
+}
+
+std::int64_t primary_namespace::get_refcnt_table_acquisitions(bool reset)
+{
+    return refcnts_.get_acquisitions(reset);
+}
+
+std::int64_t primary_namespace::get_refcnt_table_contentions(bool reset)
+{
+    return refcnts_.get_contentions(reset);
+}
+
+std::int64_t primary_namespace::get_refcnt_table_wait_time(bool reset)
+{
+    return refcnts_.get_wait_time(reset);
+}
+
 std::int64_t primary_namespace::counter_data::get_route_count(bool reset)
 {
     return util::get_and_reset_value(route_.count_, reset);
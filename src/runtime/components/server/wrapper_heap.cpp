@@ -130,6 +130,12 @@ namespace hpx { namespace components { namespace detail
         return free_size_;
     }
 
+    void const* wrapper_heap::pool_address() const
+    {
+        util::itt::heap_internal_access hia; HPX_UNUSED(hia);
+        return pool_;
+    }
+
     bool wrapper_heap::is_empty() const
     {
         util::itt::heap_internal_access hia; HPX_UNUSED(hia);
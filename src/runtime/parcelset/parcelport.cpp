@@ -12,6 +12,8 @@
 #include <hpx/state.hpp>
 #include <hpx/runtime_fwd.hpp>
 #include <hpx/runtime/applier/applier.hpp>
+#include <hpx/runtime/get_os_thread_count.hpp>
+#include <hpx/runtime/get_worker_thread_num.hpp>
 #include <hpx/runtime/parcelset/parcelport.hpp>
 #include <hpx/threading.hpp>
 #include <hpx/util/get_entry_as.hpp>
@@ -23,9 +25,12 @@
 #endif
 #include <hpx/assertion.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 
@@ -35,6 +40,8 @@ namespace hpx { namespace parcelset
     parcelport::parcelport(util::runtime_configuration const& ini,
             locality const & here, std::string const& type)
       : applier_(nullptr),
+        pending_parcels_head_(nullptr),
+        num_pending_parcels_caches_(0),
         num_parcel_destinations_(0),
         here_(here),
         max_inbound_message_size_(ini.get_max_inbound_message_size()),
@@ -42,6 +49,10 @@ namespace hpx { namespace parcelset
         allow_array_optimizations_(true),
         allow_zero_copy_optimizations_(true),
         async_serialization_(false),
+        compression_threshold_(hpx::util::get_entry_as<std::size_t>(ini,
+            "hpx.parcel." + type + ".compression_threshold",
+            hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.parcel.compression_threshold", 0))),
         priority_(hpx::util::get_entry_as<int>(ini,
             "hpx.parcel." + type + ".priority", 0)),
         type_(type)
@@ -188,18 +199,92 @@ namespace hpx { namespace parcelset
 
     std::int64_t parcelport::get_pending_parcels_count(bool /*reset*/)
     {
-        std::lock_guard<lcos::local::spinlock> l(mtx_);
         std::int64_t count = 0;
-        for (auto && p : pending_parcels_)
+        for (pending_parcels_queue* q =
+                 pending_parcels_head_.load(std::memory_order_acquire);
+             q != nullptr; q = q->next_)
         {
-            count += hpx::util::get<0>(p.second).size();
-            HPX_ASSERT(
-                hpx::util::get<0>(p.second).size() ==
-                hpx::util::get<1>(p.second).size());
+            std::int64_t const size =
+                q->size_.load(std::memory_order_relaxed);
+            if (size > 0)
+                count += size;
         }
         return count;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    parcelport::pending_parcels_cache* parcelport::get_pending_parcels_cache()
+    {
+        if (num_pending_parcels_caches_.load(std::memory_order_acquire) == 0 &&
+            hpx::get_worker_thread_num() != std::size_t(-1))
+        {
+            std::lock_guard<lcos::local::spinlock> l(mtx_);
+
+            if (num_pending_parcels_caches_.load(std::memory_order_relaxed) ==
+                0)
+            {
+                std::size_t const num_caches = hpx::get_os_thread_count();
+                if (num_caches != 0)
+                {
+                    pending_parcels_caches_.reset(
+                        new util::cache_line_data<
+                            pending_parcels_cache>[num_caches]);
+                    num_pending_parcels_caches_.store(
+                        num_caches, std::memory_order_release);
+                }
+            }
+        }
+
+        // acquiring the lock above may have moved this thread to a different
+        // worker thread
+        std::size_t const num_thread = hpx::get_worker_thread_num();
+        if (num_thread <
+            num_pending_parcels_caches_.load(std::memory_order_acquire))
+        {
+            return &pending_parcels_caches_[num_thread].data_;
+        }
+        return nullptr;
+    }
+
+    parcelport::pending_parcels_queue& parcelport::get_pending_parcels_queue(
+        locality const& dest)
+    {
+        // worker threads look up the queue in their own cache first
+        pending_parcels_cache* cache = get_pending_parcels_cache();
+        if (cache != nullptr)
+        {
+            auto it = cache->find(dest);
+            if (it != cache->end())
+                return *it->second;
+        }
+
+        pending_parcels_queue* q = nullptr;
+
+        {
+            std::lock_guard<lcos::local::spinlock> l(mtx_);
+
+            std::unique_ptr<pending_parcels_queue>& e = pending_parcels_[dest];
+            if (!e)
+            {
+                e.reset(new pending_parcels_queue(dest));
+
+                // only new queues are linked, the list is never shortened
+                e->next_ = pending_parcels_head_.load(std::memory_order_relaxed);
+                pending_parcels_head_.store(
+                    e.get(), std::memory_order_release);
+            }
+            q = e.get();
+        }
+
+        // the lock may have suspended this thread, which may have been
+        // resumed on a different worker thread
+        cache = get_pending_parcels_cache();
+        if (cache != nullptr)
+            cache->emplace(dest, q);
+
+        return *q;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
     // same as above, just separated data for each action
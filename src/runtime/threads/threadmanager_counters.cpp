@@ -10,7 +10,9 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assertion.hpp>
+#include <hpx/coroutines/detail/posix_utility.hpp>
 #include <hpx/errors.hpp>
+#include <hpx/functional/bind.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/performance_counters/counter_creators.hpp>
@@ -419,6 +421,9 @@ namespace hpx { namespace threads {
     ///////////////////////////////////////////////////////////////////////////
     void register_counter_types(threadmanager& tm)
     {
+        using util::placeholders::_1;
+        using util::placeholders::_2;
+
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
         performance_counters::create_counter_func counts_creator(
             util::bind_front(&detail::thread_counts_counter_creator));
@@ -644,6 +649,18 @@ namespace hpx { namespace threads {
                     &thread_pool_base::get_cumulative_duration),
                 &performance_counters::locality_pool_thread_counter_discoverer,
                 "ns"},
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            {   "/threads/time/idle-parked",
+                performance_counters::counter_elapsed_time,
+                "returns the overall time the OS threads of the scheduler "
+                "were parked because no work was available",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threadmanager::get_idle_parked_time,
+                    &thread_pool_base::get_idle_parked_time),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                "ns"},
+#endif
             {   "/threads/count/instantaneous/all",
                 performance_counters::counter_raw,
                 "returns the overall current number of HPX-threads "
@@ -824,7 +841,50 @@ namespace hpx { namespace threads {
                     &thread_pool_base::get_busy_loop_count),
                 &performance_counters::
                     locality_pool_thread_no_total_counter_discoverer,
-                ""}
+                ""},
+#if (defined(__linux) || defined(linux) || defined(__linux__) ||               \
+    defined(__FreeBSD__) || defined(__APPLE__)) &&                             \
+    defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+            // per-worker stack cache
+            {   "/threads/count/stack-cache-hits",
+                performance_counters::counter_monotonically_increasing,
+                "returns the number of HPX-thread stacks which were taken from "
+                "the stack cache of a worker thread for the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(&performance_counters::locality_raw_counter_creator,
+                    _1, &coroutines::detail::posix::get_stack_cache_hits, _2),
+                &performance_counters::locality_counter_discoverer, ""},
+            {   "/threads/count/stack-cache-misses",
+                performance_counters::counter_monotonically_increasing,
+                "returns the number of HPX-thread stacks which had to be "
+                "mapped because the stack cache of a worker thread was empty "
+                "for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(&performance_counters::locality_raw_counter_creator,
+                    _1, &coroutines::detail::posix::get_stack_cache_misses, _2),
+                &performance_counters::locality_counter_discoverer, ""},
+            {   "/threads/count/stack-cache-resident",
+                performance_counters::counter_raw,
+                "returns the estimated number of resident bytes held by the "
+                "stack caches of all worker threads for the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(&performance_counters::locality_raw_counter_creator,
+                    _1, &coroutines::detail::posix::get_stack_cache_resident_bytes,
+                    _2),
+                &performance_counters::locality_counter_discoverer, "bytes"},
+            {   "/threads/count/stack-cache-trimmed",
+                performance_counters::counter_monotonically_increasing,
+                "returns the number of bytes released by trimming the stack "
+                "caches of all worker threads for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(&performance_counters::locality_raw_counter_creator,
+                    _1, &coroutines::detail::posix::get_stack_cache_trimmed_bytes,
+                    _2),
+                &performance_counters::locality_counter_discoverer, "bytes"},
+#endif
         };
         performance_counters::install_counter_types(
             counter_types, sizeof(counter_types) / sizeof(counter_types[0]));
@@ -15,16 +15,21 @@
 #if defined(HPX_DEBUG)
 #include <hpx/logging.hpp>
 #endif
+#include <hpx/runtime/get_os_thread_count.hpp>
 #include <hpx/threading_base/register_thread.hpp>
-#include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/runtime/threads/thread_data.hpp>
 #include <hpx/util/wrapper_heap_base.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <initializer_list>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 
 namespace hpx { namespace util
 {
@@ -35,10 +40,10 @@ namespace hpx { namespace util
             "{1}::~{1}: size({2}), max_count({3}), alloc_count({4}), "
             "free_count({5})",
             name(),
-            heap_count_,
-            max_alloc_count_,
-            alloc_count_,
-            free_count_);
+            heap_count_.load(),
+            max_alloc_count_.load(),
+            alloc_count_.load(),
+            free_count_.load());
 
         if (alloc_count_ > free_count_)
         {
@@ -50,109 +55,299 @@ namespace hpx { namespace util
 #endif
     }
 
-    void* one_size_heap_list::alloc(std::size_t count)
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t one_size_heap_list::get_index_shift(
+        heap_parameters const& parameters)
     {
-        unique_lock_type guard(mtx_);
+        // the slots of a heap may start one alignment unit into its memory
+        std::size_t const heap_size =
+            parameters.capacity * parameters.element_size +
+            parameters.element_alignment;
+
+        std::size_t shift = 0;
+        while ((std::size_t(1) << shift) < heap_size)
+            ++shift;
+        return shift;
+    }
 
-        if (HPX_UNLIKELY(0 == count))
-        {
-            guard.unlock();
-            HPX_THROW_EXCEPTION(bad_parameter,
-                name() + "::alloc",
-                "cannot allocate 0 objects");
-        }
+    std::size_t one_size_heap_list::get_magazine_size(
+        heap_parameters const& parameters)
+    {
+        // reserve a small fraction of a heap at a time only, this limits
+        // the number of slots kept back by idle worker threads
+        std::size_t const size =
+            (std::min)(parameters.capacity / 64, std::size_t(64));
+        return size < 2 ? 0 : size;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void one_size_heap_list::add_heap(
+        std::shared_ptr<util::wrapper_heap_base> const& heap, void const* pool)
+    {
+        std::uintptr_t const first = reinterpret_cast<std::uintptr_t>(pool);
+        std::uintptr_t const last =
+            first + parameters_.capacity * parameters_.element_size;
+        heap_index_entry const entry = {first, last, heap};
+
+        std::lock_guard<mutex_type> l(index_mtx_);
+
+        heap_index_.emplace(first >> index_shift_, entry);
+        if (((last - 1) >> index_shift_) != (first >> index_shift_))
+            heap_index_.emplace((last - 1) >> index_shift_, entry);
+    }
+
+    // Remove a heap whose memory was released, it can't allocate anymore.
+    void one_size_heap_list::remove_heap(
+        util::wrapper_heap_base const* heap, void const* pool)
+    {
+        std::uintptr_t const first = reinterpret_cast<std::uintptr_t>(pool);
+        std::uintptr_t const last =
+            first + parameters_.capacity * parameters_.element_size;
+
+        std::shared_ptr<util::wrapper_heap_base> removed;
 
-        //std::size_t size = 0;
-        void* p = nullptr;
         {
-            if (!heap_list_.empty())
+            std::lock_guard<mutex_type> l(index_mtx_);
+
+            for (std::uintptr_t block :
+                {first >> index_shift_, (last - 1) >> index_shift_})
             {
-                //size = heap_list_.size();
-                for (auto & heap : heap_list_)
+                auto range = heap_index_.equal_range(block);
+                for (auto it = range.first; it != range.second; ++it)
                 {
-                    bool allocated = false;
-
+                    if (it->second.heap_.get() == heap)
                     {
-                        util::unlock_guard<unique_lock_type> ul(guard);
-                        allocated = heap->alloc(&p, count);
+                        removed = std::move(it->second.heap_);
+                        heap_index_.erase(it);
+                        break;
                     }
-
-                    if (allocated)
-                    {
-#if defined(HPX_DEBUG)
-                        // Allocation succeeded, update statistics.
-                        alloc_count_ += count;
-                        if (alloc_count_ - free_count_ > max_alloc_count_)
-                            max_alloc_count_ = alloc_count_- free_count_;
-#endif
-                        return p;
-                    }
-
-#if defined(HPX_DEBUG)
-                    LOSH_(info) << hpx::util::format(
-                        "{1}::alloc: failed to allocate from heap[{2}] "
-                        "(heap[{2}] has allocated {3} objects and has "
-                        "space for {4} more objects)",
-                        name(),
-                        heap->heap_count(),
-                        heap->size(),
-                        heap->free_size());
-#endif
                 }
             }
         }
 
-        // Create new heap.
-        bool did_create = false;
+        // only the thread which removed the heap from the index removes it
+        // from the list as well
+        if (!removed)
+            return;
+
         {
-#if defined(HPX_DEBUG)
-            heap_list_.push_front(create_heap_(
-                class_name_.c_str(), heap_count_ + 1, parameters_));
-#else
-            heap_list_.push_front(create_heap_(
-                class_name_.c_str(), 0, parameters_));
-#endif
+            std::lock_guard<mutex_type> l(mtx_);
 
-            iterator itnew = heap_list_.begin();
-            typename list_type::value_type heap = *itnew;
-            bool result = false;
+            auto it = std::find(heap_list_.begin(), heap_list_.end(), removed);
+            if (it != heap_list_.end())
+                heap_list_.erase(it);
+        }
 
+        // the heap is destroyed here, without holding any of the locks
+    }
+
+    std::shared_ptr<util::wrapper_heap_base> one_size_heap_list::find_heap(
+        void* p) const
+    {
+        std::uintptr_t const addr = reinterpret_cast<std::uintptr_t>(p);
+
+        std::shared_ptr<util::wrapper_heap_base> heap;
+        {
+            std::lock_guard<mutex_type> l(index_mtx_);
+
+            auto range = heap_index_.equal_range(addr >> index_shift_);
+            for (auto it = range.first; it != range.second; ++it)
             {
-                util::unlock_guard<unique_lock_type> ul(guard);
-                result = heap->alloc((void**)&p, count);
+                if (addr >= it->second.first_ && addr < it->second.last_)
+                {
+                    heap = it->second.heap_;
+                    break;
+                }
             }
+        }
+
+        // the heap might have released its memory in the meantime
+        if (heap && !heap->did_alloc(p))
+            heap.reset();
+        return heap;
+    }
 
-            if (HPX_UNLIKELY(!result || nullptr == p))
+    ///////////////////////////////////////////////////////////////////////////
+    one_size_heap_list::magazine* one_size_heap_list::get_magazine()
+    {
+        if (magazine_size_ == 0)
+            return nullptr;
+
+        std::size_t const num_thread = hpx::get_worker_thread_num();
+        if (num_thread == std::size_t(-1))
+            return nullptr;
+
+        std::size_t num_magazines =
+            num_magazines_.load(std::memory_order_acquire);
+        if (num_magazines == 0)
+        {
+            unique_lock_type l(mtx_);
+
+            num_magazines = num_magazines_.load(std::memory_order_relaxed);
+            if (num_magazines == 0)
             {
-                // out of memory
-                guard.unlock();
-                HPX_THROW_EXCEPTION(out_of_memory,
-                    name() + "::alloc",
-                    hpx::util::format(
-                        "new heap failed to allocate {1} objects",
-                        count));
+                num_magazines = hpx::get_os_thread_count();
+                if (num_magazines == 0)
+                    return nullptr;
+
+                magazines_.reset(
+                    new util::cache_line_data<magazine>[num_magazines]);
+                num_magazines_.store(num_magazines, std::memory_order_release);
             }
+        }
 
-#if defined(HPX_DEBUG)
-            alloc_count_ += count;
-            ++heap_count_;
+        // worker threads added later on use the shared heaps directly
+        if (num_thread >= num_magazines)
+            return nullptr;
+
+        return &magazines_[num_thread].data_;
+    }
+
+    bool one_size_heap_list::alloc_from_magazine(void** result)
+    {
+        magazine* m = get_magazine();
+        if (m == nullptr)
+            return false;
 
+        if (m->count_ == 0)
+        {
+            // refilling may suspend this thread, which might resume on a
+            // different worker thread afterwards
+            if (!refill_magazine())
+                return false;
+
+            m = get_magazine();
+            if (m == nullptr || m->count_ == 0)
+                return false;
+        }
+
+        *result = m->next_;
+        m->next_ += parameters_.element_size;
+        if (--m->count_ == 0)
+            m->heap_.reset();
+
+        return true;
+    }
+
+    bool one_size_heap_list::refill_magazine()
+    {
+        std::shared_ptr<util::wrapper_heap_base> heap;
+        {
+            unique_lock_type l(mtx_);
+            if (heap_list_.empty())
+                return false;
+            heap = heap_list_.front();
+        }
+
+        void* p = nullptr;
+        if (!heap->alloc(&p, magazine_size_))
+            return false;
+
+        magazine* m = get_magazine();
+        if (m == nullptr || m->count_ != 0)
+        {
+            // this thread has moved to another worker thread meanwhile, give
+            // back the reserved slots
+            void const* pool = heap->pool_address();
+            heap->free(p, magazine_size_);
+            if (heap->pool_address() == nullptr)
+                remove_heap(heap.get(), pool);
+            return true;
+        }
+
+        m->heap_ = std::move(heap);
+        m->next_ = static_cast<char*>(p);
+        m->count_ = magazine_size_;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Allocate from the most recently created heap, heaps hand out their
+    // slots in order and never reuse freed slots.
+    void* one_size_heap_list::alloc_shared(std::size_t count)
+    {
+        std::shared_ptr<util::wrapper_heap_base> heap;
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (!heap_list_.empty())
+                heap = heap_list_.front();
+        }
+
+        void* p = nullptr;
+        if (heap && heap->alloc(&p, count))
+            return p;
+
+#if defined(HPX_DEBUG)
+        if (heap)
+        {
             LOSH_(info) << hpx::util::format(
-                "{1}::alloc: creating new heap[{2}], size is now {3}",
+                "{1}::alloc: failed to allocate from heap[{2}] "
+                "(heap[{2}] has allocated {3} objects and has "
+                "space for {4} more objects)",
                 name(),
-                heap_count_,
-                heap_list_.size());
+                heap->heap_count(),
+                heap->size(),
+                heap->free_size());
+        }
+#endif
+
+        // Create new heap, it is made visible to other threads only after
+        // the requested objects were allocated from it.
+#if defined(HPX_DEBUG)
+        heap = create_heap_(class_name_.c_str(), ++heap_count_, parameters_);
+#else
+        heap = create_heap_(class_name_.c_str(), 0, parameters_);
 #endif
-            did_create = true;
+
+        if (HPX_UNLIKELY(!heap->alloc(&p, count) || nullptr == p))
+        {
+            // out of memory
+            HPX_THROW_EXCEPTION(out_of_memory,
+                name() + "::alloc",
+                hpx::util::format(
+                    "new heap failed to allocate {1} objects",
+                    count));
         }
 
-        if (did_create)
-            return p;
+        // the heap has to be found before anything allocated from it can
+        // be freed
+        add_heap(heap, heap->pool_address());
+
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            heap_list_.push_front(std::move(heap));
+        }
+
+#if defined(HPX_DEBUG)
+        LOSH_(info) << hpx::util::format(
+            "{1}::alloc: creating new heap[{2}]",
+            name(),
+            heap_count_.load());
+#endif
+        return p;
+    }
 
-        guard.unlock();
+    void* one_size_heap_list::alloc(std::size_t count)
+    {
+        if (HPX_UNLIKELY(0 == count))
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                name() + "::alloc",
+                "cannot allocate 0 objects");
+        }
 
-        // Try again, we just got a new heap, so we should be good.
-        return alloc(count);
+        void* p = nullptr;
+        if (count != 1 || !alloc_from_magazine(&p))
+            p = alloc_shared(count);
+
+#if defined(HPX_DEBUG)
+        // Allocation succeeded, update statistics.
+        std::size_t const allocated = alloc_count_ += count;
+        std::size_t const in_use = allocated - free_count_;
+        if (in_use > max_alloc_count_)
+            max_alloc_count_ = in_use;
+#endif
+        return p;
     }
 
     bool one_size_heap_list::reschedule(void* p, std::size_t count)
@@ -169,8 +364,6 @@ namespace hpx { namespace util
 
     void one_size_heap_list::free(void* p, std::size_t count)
     {
-        unique_lock_type ul(mtx_);
-
         if (nullptr == p || !threads::threadmanager_is(state_running))
             return;
 
@@ -180,51 +373,31 @@ namespace hpx { namespace util
             return;
 
         // Find the heap which allocated this pointer.
-        for (auto & heap : heap_list_)
+        std::shared_ptr<util::wrapper_heap_base> heap = find_heap(p);
+        if (!heap)
         {
-            bool did_allocate = false;
+            HPX_THROW_EXCEPTION(bad_parameter,
+                name() + "::free",
+                hpx::util::format(
+                    "pointer {1} was not allocated by this {2}",
+                    p, name()));
+        }
 
-            {
-                util::unlock_guard<unique_lock_type> ull(ul);
-                did_allocate = heap->did_alloc(p);
-                if (did_allocate)
-                    heap->free(p, count);
-            }
+        void const* pool = heap->pool_address();
+        heap->free(p, count);
 
-            if (did_allocate)
-            {
 #if defined(HPX_DEBUG)
-                free_count_ += count;
+        free_count_ += count;
 #endif
-                return;
-            }
-        }
 
-        ul.unlock();
-
-        HPX_THROW_EXCEPTION(bad_parameter,
-            name() + "::free",
-            hpx::util::format(
-                "pointer {1} was not allocated by this {2}",
-                p, name()));
+        // the heap releases its memory once all of its slots were freed
+        if (heap->pool_address() == nullptr)
+            remove_heap(heap.get(), pool);
     }
 
     bool one_size_heap_list::did_alloc(void* p) const
     {
-        unique_lock_type ul(mtx_);
-        for (typename list_type::value_type const& heap : heap_list_)
-        {
-            bool did_allocate = false;
-
-            {
-                util::unlock_guard<unique_lock_type> ull(ul);
-                did_allocate = heap->did_alloc(p);
-            }
-
-            if (did_allocate)
-                return true;
-        }
-        return false;
+        return find_heap(p) != nullptr;
     }
 
     std::string one_size_heap_list::name() const
@@ -12,8 +12,10 @@
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
 
+#include <hpx/cache/clock_cache.hpp>
 #include <hpx/cache/entries/lfu_entry.hpp>
 #include <hpx/cache/local_cache.hpp>
+#include <hpx/cache/sharded_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/preprocessor/stringize.hpp>
 #include <hpx/statistics/histogram.hpp>
@@ -27,6 +29,7 @@
 #include <cstdint>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -122,6 +125,28 @@ typedef hpx::util::cache::local_cache<
     hpx::util::cache::statistics::local_full_statistics
 > gva_cache_type;
 
+///////////////////////////////////////////////////////////////////////////////
+// The sharded cache as used by AGAS (all keys used here have a count of one)
+struct gva_cache_shard_selector
+{
+    std::pair<std::size_t, std::size_t> operator()(
+        gva_cache_key const& key, std::size_t num_shards) const
+    {
+        if (key.get_count() != 0)
+            return std::make_pair(std::size_t(0), num_shards);
+
+        return std::make_pair(
+            std::size_t((key.get_gid().get_lsb() >> 4) % num_shards),
+            std::size_t(1));
+    }
+};
+
+typedef hpx::util::cache::sharded_cache<
+    hpx::util::cache::clock_cache<gva_cache_key, hpx::agas::gva,
+        hpx::util::cache::statistics::local_full_statistics>,
+    hpx::lcos::local::spinlock, gva_cache_shard_selector>
+    sharded_gva_cache_type;
+
 ///////////////////////////////////////////////////////////////////////////////
 void calculate_histogram(std::string const& prefix,
     std::vector<std::uint64_t> const& timings)
@@ -228,6 +253,86 @@ void test_update(gva_cache_type& cache, hpx::naming::gid_type first_key)
     calculate_histogram("update", timings);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Run the given lookup function concurrently on all worker threads, returns
+// the number of lookups per second
+template <typename F>
+double run_concurrent(std::size_t num_lookups, F const& f)
+{
+    std::size_t num_tasks = hpx::get_os_thread_count();
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+
+    hpx::util::high_resolution_timer t;
+
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async([&f, i, num_lookups]() {
+            for (std::size_t j = 0; j != num_lookups; ++j)
+                f(i, j);
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    return double(num_tasks * num_lookups) / t.elapsed();
+}
+
+void test_concurrent_get(std::size_t cache_size, std::size_t num_entries,
+    std::size_t num_lookups, std::size_t num_shards)
+{
+    hpx::naming::gid_type locality = hpx::get_locality();
+    std::uint32_t ct = hpx::components::component_invalid;
+
+    hpx::lcos::local::spinlock mtx;
+    gva_cache_type single_lock_cache;
+    single_lock_cache.reserve(cache_size);
+
+    sharded_gva_cache_type sharded_cache(num_shards, cache_size);
+
+    std::vector<gva_cache_key> keys;
+    keys.reserve(num_entries);
+
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        gva_cache_key key(hpx::detail::get_next_id(), 1);
+        hpx::agas::gva value(locality, ct, 1, std::uint64_t(0), 0);
+
+        single_lock_cache.insert(key, value);
+        sharded_cache.insert(key, value);
+
+        keys.push_back(key);
+    }
+
+    // all tasks look up the same entries in different order
+    auto next_key = [&keys](std::size_t task, std::size_t lookup)
+        -> gva_cache_key const& {
+        return keys[(lookup * 7919 + task * 104729) % keys.size()];
+    };
+
+    double single_lock_rate = run_concurrent(
+        num_lookups, [&](std::size_t task, std::size_t lookup) {
+            gva_cache_key idbase;
+            gva_cache_type::entry_type e;
+
+            std::lock_guard<hpx::lcos::local::spinlock> l(mtx);
+            single_lock_cache.get_entry(next_key(task, lookup), idbase, e);
+        });
+
+    double sharded_rate = run_concurrent(
+        num_lookups, [&](std::size_t task, std::size_t lookup) {
+            gva_cache_key idbase;
+            hpx::agas::gva e;
+
+            sharded_cache.get_entry(next_key(task, lookup), idbase, e);
+        });
+
+    std::cout << "concurrent get (" << hpx::get_os_thread_count()
+              << " threads): single lock: " << single_lock_rate
+              << " lookups/s, sharded (" << num_shards
+              << " shards): " << sharded_rate << " lookups/s" << std::endl;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -250,6 +355,14 @@ int hpx_main(hpx::program_options::variables_map& vm)
     test_get(cache, first_key);
     test_update(cache, first_key);
 
+    if (vm.count("concurrent"))
+    {
+        std::size_t num_lookups = vm["num_lookups"].as<std::size_t>();
+        std::size_t num_shards = vm["num_shards"].as<std::size_t>();
+
+        test_concurrent_get(cache_size, num_entries, num_lookups, num_shards);
+    }
+
     double elapsed = t1.elapsed();
     hpx::util::print_cdash_timing("AGASCache", elapsed);
 
@@ -268,6 +381,16 @@ int main(int argc, char* argv[])
          HPX_PP_STRINGIZE(HPX_AGAS_LOCAL_CACHE_SIZE_PER_THREAD) ")")
         ("num_entries,n", value<std::size_t>(),
          "number of items to insert into cache (default: 1000)")
+        ("concurrent",
+         "additionally measure concurrent lookups from all worker threads "
+         "comparing a single lock cache with the sharded cache")
+        ("num_lookups", value<std::size_t>()->default_value(100000),
+         "number of lookups performed by each worker thread in concurrent "
+         "mode (default: 100000)")
+        ("num_shards", value<std::size_t>()->default_value(
+             HPX_AGAS_LOCAL_CACHE_SHARDS),
+         "number of shards of the sharded cache in concurrent mode "
+         "(default: " HPX_PP_STRINGIZE(HPX_AGAS_LOCAL_CACHE_SHARDS) ")")
         ;
 
     // Initialize and run HPX
@@ -0,0 +1,138 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the overheads of creating and destroying large
+// numbers of small components concurrently. It exercises the heaps managing
+// the memory of managed components directly and through hpx::local_new.
+
+#include <hpx/format.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/iostreams.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/program_options.hpp>
+#include <hpx/testing.hpp>
+#include <hpx/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct churn_server
+  : hpx::components::managed_component_base<churn_server>
+{
+    churn_server() = default;
+
+    std::uint64_t payload_ = 0;
+};
+
+typedef hpx::components::managed_component<churn_server> churn_server_type;
+HPX_REGISTER_COMPONENT(churn_server_type, churn_server);
+
+///////////////////////////////////////////////////////////////////////////////
+// allocate and free the memory for the given number of objects at a time
+void churn_heap(std::size_t iterations, std::size_t num_objects)
+{
+    auto& heap = hpx::components::component_heap<churn_server_type>();
+
+    std::vector<void*> objects(num_objects);
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        for (void*& p : objects)
+            p = heap.alloc();
+        for (void* p : objects)
+            heap.free(p);
+    }
+}
+
+// create and destroy the given number of components at a time
+void churn_components(std::size_t iterations, std::size_t num_objects)
+{
+    std::vector<hpx::future<hpx::id_type>> objects;
+    objects.reserve(num_objects);
+
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        for (std::size_t j = 0; j != num_objects; ++j)
+            objects.push_back(hpx::local_new<churn_server>());
+
+        hpx::wait_all(objects);
+        objects.clear();
+    }
+}
+
+template <typename F>
+double measure(std::size_t num_tasks, F f)
+{
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+
+    hpx::util::high_resolution_timer t;
+    for (std::size_t i = 0; i != num_tasks; ++i)
+        tasks.push_back(hpx::async(f));
+    hpx::wait_all(tasks);
+    return t.elapsed();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const num_tasks = vm["tasks"].as<std::size_t>();
+    std::size_t const iterations = vm["iterations"].as<std::size_t>();
+    std::size_t const num_objects = vm["objects"].as<std::size_t>();
+
+    double const elapsed_heap = measure(num_tasks,
+        [=]() { churn_heap(iterations, num_objects); });
+    double const elapsed_components = measure(num_tasks,
+        [=]() { churn_components(iterations, num_objects); });
+
+    std::size_t const total = num_tasks * iterations * num_objects;
+
+    if (!vm.count("no-header"))
+    {
+        hpx::cout << "OS-threads,Tasks,Objects,Heap[s],Heap per object[s],"
+                     "Components[s],Component per object[s]"
+                  << hpx::endl;
+    }
+
+    hpx::util::format_to(hpx::cout,
+        "{},{},{},{:.6},{:.12},{:.6},{:.12}\n", hpx::get_os_thread_count(),
+        num_tasks, total, elapsed_heap, elapsed_heap / total,
+        elapsed_components, elapsed_components / total)
+        << hpx::flush;
+
+    hpx::util::print_cdash_timing("ComponentHeapChurn", elapsed_heap / total);
+    hpx::util::print_cdash_timing(
+        "ComponentChurn", elapsed_components / total);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    namespace po = hpx::program_options;
+
+    // Configure application-specific options.
+    po::options_description opts("usage: " HPX_APPLICATION_STRING " [options]");
+    // clang-format off
+    opts.add_options()
+        ("tasks", po::value<std::size_t>()->default_value(64),
+         "number of concurrent tasks creating objects (default: 64)")
+        ("iterations", po::value<std::size_t>()->default_value(100),
+         "number of times each task creates its objects (default: 100)")
+        ("objects", po::value<std::size_t>()->default_value(1000),
+         "number of objects alive per task at a time (default: 1000)")
+        ("no-header", "do not print out the csv header row")
+        ;
+    // clang-format on
+
+    // Initialize and run HPX.
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+    return hpx::init(opts, argc, argv, cfg);
+}
@@ -14,6 +14,7 @@
 #include <hpx/include/parallel_for_loop.hpp>
 #include <hpx/include/threads.hpp>
 #include <hpx/lcos/wait_each.hpp>
+#include <hpx/lcos/when_all.hpp>
 #include <hpx/runtime/actions/continuation.hpp>
 #include <hpx/runtime/actions/plain_action.hpp>
 #include <hpx/testing.hpp>
@@ -213,6 +214,51 @@ void measure_function_futures_wait_all(
     print_stats("async", "WaitAll", exec_name(exec), count, duration, csv);
 }
 
+// Time attaching a chain of continuations to a future which is made ready
+// only afterwards, every continuation is invoked directly by its predecessor
+void measure_function_futures_then_chain(std::uint64_t count, bool csv)
+{
+    hpx::lcos::local::promise<double> p;
+
+    // start the clock
+    high_resolution_timer walltime;
+    future<double> f = p.get_future();
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        f = f.then(hpx::launch::sync,
+            [](future<double>&& r) { return r.get() + null_function(); });
+    }
+    p.set_value(0.0);
+    global_scratch += f.get();
+
+    // stop the clock
+    const double duration = walltime.elapsed();
+    print_stats("then", "Chain", "sync", count, duration, csv);
+}
+
+// Time when_all attaching one continuation to each of the given futures which
+// are made ready only afterwards
+void measure_function_futures_when_all(std::uint64_t count, bool csv)
+{
+    std::vector<hpx::lcos::local::promise<double>> promises(count);
+    std::vector<future<double>> futures;
+    futures.reserve(count);
+
+    // start the clock
+    high_resolution_timer walltime;
+    for (std::uint64_t i = 0; i < count; ++i)
+        futures.push_back(promises[i].get_future());
+
+    auto all = hpx::when_all(futures);
+    for (std::uint64_t i = 0; i < count; ++i)
+        promises[i].set_value(null_function());
+    all.get();
+
+    // stop the clock
+    const double duration = walltime.elapsed();
+    print_stats("when_all", "FanIn", "none", count, duration, csv);
+}
+
 template <typename Executor>
 void measure_function_futures_thread_count(
     std::uint64_t count, bool csv, Executor& exec)
@@ -574,6 +620,8 @@ int hpx_main(variables_map& vm)
                 measure_function_futures_wait_each(count, csv, tpe);
                 measure_function_futures_wait_all(count, csv, par);
                 measure_function_futures_wait_all(count, csv, tpe);
+                measure_function_futures_then_chain(count, csv);
+                measure_function_futures_when_all(count, csv);
                 measure_function_futures_thread_count(count, csv, par);
                 measure_function_futures_thread_count(count, csv, tpe);
                 measure_function_futures_sliding_semaphore(count, csv, par);
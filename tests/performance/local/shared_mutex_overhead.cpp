@@ -0,0 +1,137 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure how well shared (read) locking scales with the number of worker
+// threads. Every task repeatedly acquires a shared lock to read a value;
+// every writer-interval-th iteration takes the exclusive lock instead.
+
+#include <hpx/config.hpp>
+
+#include <hpx/format.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/iostreams.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/synchronization/reader_biased_shared_mutex.hpp>
+#include <hpx/synchronization/shared_mutex.hpp>
+#include <hpx/testing.hpp>
+#include <hpx/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using hpx::program_options::options_description;
+using hpx::program_options::value;
+using hpx::program_options::variables_map;
+
+using hpx::util::high_resolution_timer;
+
+///////////////////////////////////////////////////////////////////////////////
+// we use globals here to prevent the reads from being optimized away
+std::uint64_t global_value = 0;
+std::uint64_t num_iterations = 0;
+std::uint64_t writer_interval = 0;
+
+template <typename SharedMutex>
+std::uint64_t read_mostly(SharedMutex& mtx)
+{
+    std::uint64_t sum = 0;
+    for (std::uint64_t i = 0; i != num_iterations; ++i)
+    {
+        if (writer_interval != 0 && i % writer_interval == 0)
+        {
+            std::lock_guard<SharedMutex> l(mtx);
+            ++global_value;
+        }
+        else
+        {
+            mtx.lock_shared();
+            sum += global_value;
+            mtx.unlock_shared();
+        }
+    }
+    return sum;
+}
+
+template <typename SharedMutex>
+void measure(variables_map& vm, std::string const& name)
+{
+    std::uint64_t const count = vm["tasks"].as<std::uint64_t>();
+
+    SharedMutex mtx;
+
+    std::vector<hpx::future<std::uint64_t>> futures;
+    futures.reserve(count);
+
+    // start the clock
+    high_resolution_timer walltime;
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        futures.push_back(hpx::async(&read_mostly<SharedMutex>, std::ref(mtx)));
+    }
+    hpx::wait_all(futures);
+
+    // stop the clock
+    double const duration = walltime.elapsed();
+
+    if (vm.count("csv"))
+    {
+        hpx::util::format_to(hpx::cout, "{1},{2},{3},{4},{5}\n", name,
+            hpx::get_os_thread_count(), count, num_iterations, duration)
+            << hpx::flush;
+    }
+    else
+    {
+        hpx::util::format_to(hpx::cout,
+            "{1}: {2} tasks with {3} iterations each on {4} threads "
+            "in {5} seconds\n",
+            name, count, num_iterations, hpx::get_os_thread_count(), duration)
+            << hpx::flush;
+    }
+    hpx::util::print_cdash_timing(name.c_str(), duration);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    num_iterations = vm["iterations"].as<std::uint64_t>();
+    writer_interval = vm["writer-interval"].as<std::uint64_t>();
+
+    if (HPX_UNLIKELY(0 == vm["tasks"].as<std::uint64_t>()))
+        throw std::logic_error("error: count of 0 tasks specified\n");
+
+    measure<hpx::lcos::local::shared_mutex>(vm, "SharedMutex");
+    measure<hpx::lcos::local::reader_biased_shared_mutex>(
+        vm, "ReaderBiasedSharedMutex");
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("tasks", value<std::uint64_t>()->default_value(1000),
+         "number of tasks to invoke")
+        ("iterations", value<std::uint64_t>()->default_value(10000),
+         "number of lock acquisitions per task")
+        ("writer-interval", value<std::uint64_t>()->default_value(0),
+         "take the exclusive lock every n-th iteration (0: never)")
+        ("csv", "output results as csv "
+         "(format: mutex,threads,tasks,iterations,duration)");
+    // clang-format on
+
+    // Initialize and run HPX.
+    return hpx::init(cmdline, argc, argv);
+}
@@ -0,0 +1,178 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies the sharded tables of the primary AGAS namespace and
+// the counters reporting the contention of their locks.
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/runtime/agas/detail/sharded_table.hpp>
+#include <hpx/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+typedef hpx::agas::detail::sharded_table<std::size_t, std::int64_t,
+    hpx::lcos::local::spinlock>
+    table_type;
+
+void increment_all(table_type& table, std::size_t num_keys)
+{
+    for (std::size_t key = 0; key != num_keys; ++key)
+    {
+        table_type::shard& s = table.get_shard(key);
+        std::unique_lock<table_type::mutex_type> l = table.lock(s);
+        ++s.map_[key];
+    }
+}
+
+void test_sharded_table()
+{
+    HPX_TEST_EQ(table_type(0).num_shards(), std::size_t(1));
+
+    table_type table(8);
+    HPX_TEST_EQ(table.num_shards(), std::size_t(8));
+
+    // every key is always mapped to the same shard
+    for (std::size_t key = 0; key != 100; ++key)
+    {
+        HPX_TEST_EQ(&table.get_shard(key), &table.get_shard(key));
+    }
+
+    std::size_t const num_tasks = 4 * hpx::get_os_thread_count();
+    std::size_t const num_keys = 1000;
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async(
+            &increment_all, std::ref(table), num_keys));
+    }
+    hpx::wait_all(tasks);
+
+    // all increments were applied to the shard owning the key
+    std::size_t num_entries = 0;
+    for (std::size_t key = 0; key != num_keys; ++key)
+    {
+        table_type::shard& s = table.get_shard(key);
+        auto it = s.map_.find(key);
+        HPX_TEST(it != s.map_.end());
+        if (it != s.map_.end())
+        {
+            HPX_TEST_EQ(it->second, std::int64_t(num_tasks));
+            ++num_entries;
+        }
+    }
+    HPX_TEST_EQ(num_entries, num_keys);
+
+    // the statistics are accumulated over all shards
+    std::int64_t const acquisitions = table.get_acquisitions(false);
+    HPX_TEST_EQ(acquisitions, std::int64_t(num_tasks * num_keys));
+    HPX_TEST_LTE(table.get_contentions(false), acquisitions);
+    HPX_TEST_LTE(std::int64_t(0), table.get_wait_time(false));
+
+    // and can be reset
+    HPX_TEST_EQ(table.get_acquisitions(true), acquisitions);
+    HPX_TEST_EQ(table.get_acquisitions(false), std::int64_t(0));
+    table.get_contentions(true);
+    HPX_TEST_EQ(table.get_contentions(false), std::int64_t(0));
+    table.get_wait_time(true);
+    HPX_TEST_EQ(table.get_wait_time(false), std::int64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::int64_t> alive(0);
+
+struct test_server : hpx::components::component_base<test_server>
+{
+    test_server()
+    {
+        ++alive;
+    }
+    ~test_server()
+    {
+        --alive;
+    }
+};
+
+typedef hpx::components::component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server);
+
+// create components and release them again, this binds the components in
+// the GVA table and returns their credits through the reference count table
+void create_components(std::size_t num_objects)
+{
+    std::vector<hpx::id_type> ids;
+    ids.reserve(num_objects);
+    for (std::size_t i = 0; i != num_objects; ++i)
+        ids.push_back(hpx::new_<test_server>(hpx::find_here()).get());
+}
+
+std::int64_t query_counter(std::string const& name)
+{
+    hpx::performance_counters::performance_counter counter(
+        "/agas{locality#0/total}/primary/" + name);
+    return counter.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+void test_tables_and_counters()
+{
+    std::int64_t const gva_acquisitions =
+        query_counter("gva_table/count/acquisitions");
+    std::int64_t const refcnt_acquisitions =
+        query_counter("refcnt_table/count/acquisitions");
+
+    std::size_t const num_tasks = 4 * hpx::get_os_thread_count();
+    std::size_t const num_objects = 100;
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+        tasks.push_back(hpx::async(&create_components, num_objects));
+    hpx::wait_all(tasks);
+
+    // all components are destroyed once the pending reference count
+    // decrements were sent
+    while (alive.load() != 0)
+    {
+        hpx::agas::garbage_collect();
+        hpx::this_thread::yield();
+    }
+
+    // binding, resolving and releasing the components went through the
+    // tables
+    HPX_TEST_LT(gva_acquisitions,
+        query_counter("gva_table/count/acquisitions"));
+    HPX_TEST_LT(refcnt_acquisitions,
+        query_counter("refcnt_table/count/acquisitions"));
+
+    for (std::string const table : {"gva_table", "refcnt_table"})
+    {
+        HPX_TEST_LTE(query_counter(table + "/count/contentions"),
+            query_counter(table + "/count/acquisitions"));
+        HPX_TEST_LTE(std::int64_t(0),
+            query_counter(table + "/time/lock_wait"));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_sharded_table();
+    test_tables_and_counters();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,151 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Allocate the memory of managed components from many threads at the same
+// time. This exercises the per-worker magazines of the component heaps and
+// the index used to find the heap owning a given pointer.
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server : hpx::components::managed_component_base<test_server>
+{
+    test_server() = default;
+
+    std::uint64_t payload_ = 0;
+};
+
+typedef hpx::components::managed_component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server);
+
+typedef server_type::heap_type heap_type;
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<void*> alloc_objects(std::size_t num_objects)
+{
+    heap_type& heap = hpx::components::component_heap<server_type>();
+
+    std::vector<void*> objects;
+    objects.reserve(num_objects);
+    for (std::size_t i = 0; i != num_objects; ++i)
+    {
+        objects.push_back(heap.alloc());
+
+        // give other threads the chance to run on this worker thread, this
+        // thread might continue on another one
+        if (i % 100 == 0)
+            hpx::this_thread::yield();
+    }
+    return objects;
+}
+
+void free_objects(std::vector<void*> const& objects)
+{
+    heap_type& heap = hpx::components::component_heap<server_type>();
+    for (void* p : objects)
+        heap.free(p);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_alloc()
+{
+    heap_type& heap = hpx::components::component_heap<server_type>();
+
+    // several tasks per worker thread, all of them allocating more objects
+    // than fit into a single heap
+    std::size_t const num_tasks = 4 * hpx::get_os_thread_count();
+    std::size_t const num_objects = 2 * heap.parameters_.capacity + 17;
+
+    std::vector<hpx::future<std::vector<void*>>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+        tasks.push_back(hpx::async(&alloc_objects, num_objects));
+    hpx::wait_all(tasks);
+
+    std::vector<void*> objects;
+    for (auto& f : tasks)
+    {
+        std::vector<void*> result = f.get();
+        objects.insert(objects.end(), result.begin(), result.end());
+    }
+    HPX_TEST_EQ(objects.size(), num_tasks * num_objects);
+
+    // every slot is handed out only once and is found in its heap
+    std::set<void*> unique_objects(objects.begin(), objects.end());
+    HPX_TEST_EQ(unique_objects.size(), objects.size());
+
+    std::set<hpx::naming::gid_type> gids;
+    for (void* p : objects)
+    {
+        HPX_TEST(heap.did_alloc(p));
+
+        hpx::naming::gid_type gid = heap.get_gid(p);
+        HPX_TEST(gid != hpx::naming::invalid_gid);
+        gids.insert(gid);
+    }
+    HPX_TEST_EQ(gids.size(), objects.size());
+
+    // memory not allocated from any of the heaps
+    std::uint64_t value = 0;
+    std::unique_ptr<test_server> other(new test_server);
+    HPX_TEST(!heap.did_alloc(&value));
+    HPX_TEST(!heap.did_alloc(other.get()));
+    HPX_TEST(!heap.did_alloc(nullptr));
+    HPX_TEST(heap.get_gid(&value) == hpx::naming::invalid_gid);
+
+    free_objects(objects);
+}
+
+// Heaps which were completely handed out and freed release their memory and
+// are not found anymore.
+void test_release_heaps()
+{
+    heap_type& heap = hpx::components::component_heap<server_type>();
+
+    // Heaps are kept alive by the slots reserved for a worker thread and by
+    // the most recently created heap only.
+    std::size_t const capacity = heap.parameters_.capacity;
+    std::size_t const num_heaps = 2 * hpx::get_os_thread_count() + 4;
+
+    std::vector<void*> objects = alloc_objects(num_heaps * capacity);
+    for (void* p : objects)
+        HPX_TEST(heap.did_alloc(p));
+
+    free_objects(objects);
+
+    std::size_t released = 0;
+    for (void* p : objects)
+    {
+        if (!heap.did_alloc(p))
+            ++released;
+    }
+    HPX_TEST_LTE(4 * capacity, released);
+
+    // the heap list stays usable after the heaps were removed
+    objects = alloc_objects(capacity);
+    for (void* p : objects)
+        HPX_TEST(heap.did_alloc(p));
+    free_objects(objects);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_concurrent_alloc();
+    test_release_heaps();
+
+    return hpx::util::report_errors();
+}
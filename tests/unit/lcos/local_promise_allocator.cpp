@@ -23,6 +23,7 @@ int main()
         hpx::future<int> f = p.get_future();
         HPX_TEST_EQ(test_alloc_base::count, 1);
         HPX_TEST(f.valid());
+        HPX_TEST(!f.is_ready());
     }
     HPX_TEST_EQ(test_alloc_base::count, 0);
     {
@@ -32,6 +33,7 @@ int main()
         hpx::future<int&> f = p.get_future();
         HPX_TEST_EQ(test_alloc_base::count, 1);
         HPX_TEST(f.valid());
+        HPX_TEST(!f.is_ready());
     }
     HPX_TEST_EQ(test_alloc_base::count, 0);
     {
@@ -41,6 +43,7 @@ int main()
         hpx::future<void> f = p.get_future();
         HPX_TEST_EQ(test_alloc_base::count, 1);
         HPX_TEST(f.valid());
+        HPX_TEST(!f.is_ready());
     }
     HPX_TEST_EQ(test_alloc_base::count, 0);
 
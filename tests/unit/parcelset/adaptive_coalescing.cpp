@@ -0,0 +1,123 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test sends parcels at a known rate through the coalescing message
+// handler running in adaptive mode. Sparse parcels have to be sent right
+// away (one parcel per message), while a burst of parcels has to make the
+// handler coalesce them into larger messages.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/apply.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/parcel_coalescing.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// the coalescing interval, this is the upper bound for the adaptive interval
+std::size_t const interval = 10000;    // [us]
+
+std::size_t const num_sparse_parcels = 20;
+std::size_t const num_burst_parcels = 2000;
+
+///////////////////////////////////////////////////////////////////////////////
+void ping() {}
+
+HPX_DECLARE_PLAIN_ACTION(ping, ping_action);
+HPX_ACTION_USES_MESSAGE_COALESCING(ping_action);
+HPX_PLAIN_ACTION(ping, ping_action);
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t get_counter_value(char const* name)
+{
+    std::string const counter_name =
+        std::string("/coalescing{locality#0/total}/") + name + "@ping_action";
+
+    hpx::performance_counters::performance_counter counter(counter_name);
+    return counter.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_remote_localities();
+    HPX_TEST(!localities.empty());
+    if (localities.empty())
+        return hpx::finalize();
+
+    hpx::id_type const dest = localities[0];
+
+    // Send one parcel every 20ms, which is less than one parcel per message
+    // sent. Those parcels don't have to wait for others.
+    for (std::size_t i = 0; i != num_sparse_parcels; ++i)
+    {
+        hpx::async<ping_action>(dest).get();
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+
+    HPX_TEST_EQ(get_counter_value("count/batch-size"), 1);
+    HPX_TEST_EQ(get_counter_value("time/flush-interval"), 0);
+    HPX_TEST_LT(0, get_counter_value("time/send-latency"));
+
+    std::int64_t const parcels = get_counter_value("count/parcels");
+    std::int64_t const messages = get_counter_value("count/messages");
+    HPX_TEST_EQ(parcels, std::int64_t(num_sparse_parcels));
+    HPX_TEST_EQ(messages, std::int64_t(num_sparse_parcels));
+
+    // Send a burst of parcels back to back, many parcels arrive while one
+    // message is being sent.
+    for (std::size_t i = 0; i != num_burst_parcels; ++i)
+    {
+        hpx::apply<ping_action>(dest);
+    }
+
+    // the parameters were adapted while the parcels of the burst were put
+    std::int64_t const batch_size = get_counter_value("count/batch-size");
+    std::int64_t const flush_interval =
+        get_counter_value("time/flush-interval");
+
+    HPX_TEST_LT(1, batch_size);
+    HPX_TEST_LT(0, flush_interval);
+    HPX_TEST_LTE(flush_interval, std::int64_t(interval) * 1000);
+
+    // give the timer the chance to flush the last buffered parcels
+    hpx::this_thread::sleep_for(std::chrono::microseconds(2 * interval));
+
+    // the parcels of the burst were coalesced into fewer messages
+    HPX_TEST_EQ(get_counter_value("count/parcels") - parcels,
+        std::int64_t(num_burst_parcels));
+    HPX_TEST_LT(get_counter_value("count/messages") - messages,
+        std::int64_t(num_burst_parcels));
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // explicitly enable message handlers (parcel coalescing) in adaptive mode,
+    // the buffered parcels are not flushed by the background work as this
+    // would send them before the batch size or the flush interval is reached
+    std::vector<std::string> const cfg = {"hpx.parcel.message_handlers=1",
+        "hpx.plugins.coalescing_message_handler.adaptive!=1",
+        "hpx.plugins.coalescing_message_handler.allow_background_flush!=0",
+        "hpx.plugins.coalescing_message_handler.interval!=" +
+            std::to_string(interval)};
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
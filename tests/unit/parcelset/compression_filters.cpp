@@ -0,0 +1,198 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test sends data through the binary filters writing self-describing
+// frames (lz4 and zstd), both configured to use a dictionary. It verifies
+// that the data survives the round trip and that corrupted frames and frames
+// compressed using a different dictionary are rejected.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/errors.hpp>
+#include <hpx/filesystem.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/plugins/binary_filter/compression_frame.hpp>
+#include <hpx/serialization/binary_filter.hpp>
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using hpx::plugins::compression::frame_method;
+
+///////////////////////////////////////////////////////////////////////////////
+char const* const phrases[] = {"the quick brown fox ",
+    "jumps over the lazy dog ", "pack my box with ", "five dozen jugs "};
+
+std::vector<char> make_text(std::size_t size)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<std::size_t> dist(0, 3);
+
+    std::string text;
+    while (text.size() < size)
+        text += phrases[dist(gen)];
+    return std::vector<char>(text.begin(), text.begin() + size);
+}
+
+std::vector<char> make_noise(std::size_t size)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 255);
+
+    std::vector<char> noise(size);
+    for (char& c : noise)
+        c = char(dist(gen));
+    return noise;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<char> compress(
+    std::string const& filter, std::vector<char> const& data)
+{
+    std::unique_ptr<hpx::serialization::binary_filter> f(
+        hpx::create_binary_filter(filter.c_str(), true));
+
+    f->set_max_length(data.size());
+    f->save(data.data(), data.size());
+
+    std::vector<char> frame(2 * data.size() + 1024);
+    std::size_t written = 0;
+    HPX_TEST(f->flush(frame.data(), frame.size(), written));
+    frame.resize(written);
+    return frame;
+}
+
+std::vector<char> decompress(
+    std::string const& filter, std::vector<char> const& frame)
+{
+    std::unique_ptr<hpx::serialization::binary_filter> f(
+        hpx::create_binary_filter(filter.c_str(), false));
+
+    std::size_t const size = f->init_data(frame.data(), frame.size(), 0);
+    std::vector<char> data(size);
+    f->load(data.data(), size);
+    return data;
+}
+
+bool is_rejected(std::string const& filter, std::vector<char> const& frame)
+{
+    try
+    {
+        decompress(filter, frame);
+    }
+    catch (hpx::exception const& e)
+    {
+        return e.get_error() == hpx::serialization_error;
+    }
+    return false;
+}
+
+frame_method get_method(std::vector<char> const& frame)
+{
+    return static_cast<frame_method>(frame[0]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_round_trip(std::string const& filter)
+{
+    // repetitive data is compressed using the dictionary
+    std::vector<char> const text = make_text(100000);
+    std::vector<char> frame = compress(filter, text);
+    HPX_TEST(get_method(frame) == frame_method::compressed_with_dictionary);
+    HPX_TEST_LT(frame.size(), text.size() / 4);
+    HPX_TEST(decompress(filter, frame) == text);
+
+    // incompressible data and data below the threshold are stored as is
+    std::vector<char> const noise = make_noise(10000);
+    frame = compress(filter, noise);
+    HPX_TEST(get_method(frame) == frame_method::stored);
+    HPX_TEST(decompress(filter, frame) == noise);
+
+    std::vector<char> const small = make_text(100);
+    frame = compress(filter, small);
+    HPX_TEST(get_method(frame) == frame_method::stored);
+    HPX_TEST(decompress(filter, frame) == small);
+}
+
+void test_corrupted_frames(std::string const& filter)
+{
+    using hpx::plugins::compression::frame_header_size;
+    using hpx::plugins::compression::detail::write_uint64;
+
+    std::vector<char> const frame = compress(filter, make_text(100000));
+
+    // a frame compressed using a different dictionary
+    std::vector<char> other_dictionary = frame;
+    other_dictionary[frame_header_size] ^= 0x01;
+    HPX_TEST(is_rejected(filter, other_dictionary));
+
+    // the uncompressed size is not trusted
+    std::vector<char> huge = frame;
+    write_uint64(huge.data() + 1, std::uint64_t(1) << 50);
+    HPX_TEST(is_rejected(filter, huge));
+
+    std::vector<char> wrong_size = frame;
+    write_uint64(wrong_size.data() + 1, 100001);
+    HPX_TEST(is_rejected(filter, wrong_size));
+
+    // truncated frames
+    std::vector<char> truncated(frame.begin(), frame.end() - 1);
+    HPX_TEST(is_rejected(filter, truncated));
+
+    truncated.resize(frame_header_size);
+    HPX_TEST(is_rejected(filter, truncated));
+
+    // a stored frame has to hold exactly the uncompressed data
+    std::vector<char> stored = compress(filter, make_noise(10000));
+    write_uint64(stored.data() + 1, 10001);
+    HPX_TEST(is_rejected(filter, stored));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+    test_round_trip("lz4_serialization_filter");
+    test_corrupted_frames("lz4_serialization_filter");
+#endif
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+    test_round_trip("zstd_serialization_filter");
+    test_corrupted_frames("zstd_serialization_filter");
+#endif
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // the dictionary holds the phrases the compressed text is made of
+    hpx::filesystem::path const dictionary =
+        hpx::filesystem::temp_directory_path() /
+        "compression_filters_test.dict";
+    {
+        std::ofstream out(dictionary.string(), std::ios::binary);
+        for (char const* phrase : phrases)
+            out << phrase;
+    }
+
+    std::vector<std::string> const cfg = {
+        "hpx.plugins.lz4_serialization_filter.dictionary!=" +
+            dictionary.string(),
+        "hpx.plugins.zstd_serialization_filter.dictionary!=" +
+            dictionary.string()};
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    hpx::filesystem::remove(dictionary);
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,113 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Send parcels from many HPX threads to several destinations at the same
+// time. This exercises the per-destination pending parcel queues and the
+// per-worker lookup caches of the parcelport. Parcels left behind in one of
+// the queues make this test hang.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const numparcels_default = 100;
+
+std::size_t echo(std::size_t i)
+{
+    return i;
+}
+HPX_PLAIN_ACTION(echo, echo_action);
+
+///////////////////////////////////////////////////////////////////////////////
+void send_parcels(std::vector<hpx::id_type> const& destinations,
+    std::size_t task, std::size_t numparcels)
+{
+    std::vector<hpx::future<std::size_t>> results;
+    results.reserve(numparcels * destinations.size());
+
+    for (std::size_t i = 0; i != numparcels; ++i)
+    {
+        for (hpx::id_type const& id : destinations)
+        {
+            results.push_back(
+                hpx::async<echo_action>(id, task * numparcels + i));
+        }
+
+        // give other threads the chance to run on this worker thread, the
+        // sending thread might continue on another one
+        if (i % 10 == 0)
+            hpx::this_thread::yield();
+    }
+
+    hpx::wait_all(results);
+
+    std::size_t j = 0;
+    for (std::size_t i = 0; i != numparcels; ++i)
+    {
+        for (std::size_t k = 0; k != destinations.size(); ++k, ++j)
+        {
+            HPX_TEST_EQ(results[j].get(), task * numparcels + i);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const numparcels = vm["parcels"].as<std::size_t>();
+    std::vector<hpx::id_type> destinations = hpx::find_remote_localities();
+
+    // several tasks per worker thread, all of them sending to all remote
+    // localities
+    std::size_t const numtasks = 4 * hpx::get_os_thread_count();
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(numtasks);
+    for (std::size_t task = 0; task != numtasks; ++task)
+    {
+        tasks.push_back(hpx::async(
+            &send_parcels, std::cref(destinations), task, numparcels));
+    }
+    hpx::wait_all(tasks);
+
+    for (hpx::future<void>& f : tasks)
+    {
+        HPX_TEST(!f.has_exception());
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("parcels", value<std::size_t>()->default_value(numparcels_default),
+        "the number of parcels each task sends to every remote locality")
+        ;
+
+    // explicitly disable message handlers (parcel coalescing)
+    std::vector<std::string> const cfg = {
+#if defined(HPX_HAVE_NETWORKING)
+        "hpx.parcel.message_handlers=0"
+#endif
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -35,7 +35,7 @@ generate_parcel(hpx::id_type const& dest_id, hpx::id_type const& cont, T && data
         std::move(dest), std::move(addr),
         hpx::actions::typed_continuation<hpx::id_type>(cont),
         Action(), hpx::threads::thread_priority_normal,
-        std::forward<T>(data));
+        std::forward<T>(data)));
 
     p.set_source_id(hpx::find_here());
     p.size() = 4096;
@@ -69,6 +69,10 @@ HPX_ACTION_USES_BZIP2_COMPRESSION(test1_action)
 HPX_ACTION_USES_ZLIB_COMPRESSION(test1_action)
 #elif defined(HPX_HAVE_COMPRESSION_SNAPPY)
 HPX_ACTION_USES_SNAPPY_COMPRESSION(test1_action)
+#elif defined(HPX_HAVE_COMPRESSION_LZ4)
+HPX_ACTION_USES_LZ4_COMPRESSION(test1_action)
+#elif defined(HPX_HAVE_COMPRESSION_ZSTD)
+HPX_ACTION_USES_ZSTD_COMPRESSION(test1_action)
 #endif
 
 HPX_REGISTER_ACTION(test1_action);
@@ -124,6 +128,10 @@ HPX_ACTION_USES_BZIP2_COMPRESSION(test2_action)
 HPX_ACTION_USES_ZLIB_COMPRESSION(test2_action)
 #elif defined(HPX_HAVE_COMPRESSION_SNAPPY)
 HPX_ACTION_USES_SNAPPY_COMPRESSION(test2_action)
+#elif defined(HPX_HAVE_COMPRESSION_LZ4)
+HPX_ACTION_USES_LZ4_COMPRESSION(test2_action)
+#elif defined(HPX_HAVE_COMPRESSION_ZSTD)
+HPX_ACTION_USES_ZSTD_COMPRESSION(test2_action)
 #endif
 
 HPX_PLAIN_ACTION(test2, test2_action);
@@ -0,0 +1,157 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/chase_lev_deque.hpp>
+#include <hpx/program_options.hpp>
+#include <hpx/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+std::uint64_t threads = 4;
+std::uint64_t items = 500000;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_owner_only()
+{
+    // starting with a small capacity forces the deque to grow
+    hpx::util::chase_lev_deque<std::uint64_t> deque(2);
+    HPX_TEST(deque.empty());
+
+    for (std::uint64_t i = 0; i != 1000; ++i)
+        deque.push(i);
+
+    HPX_TEST_EQ(deque.size(), std::int64_t(1000));
+
+    // the owner pops in LIFO order
+    std::uint64_t val = 0;
+    for (std::uint64_t i = 1000; i != 500; --i)
+    {
+        HPX_TEST(deque.pop(val));
+        HPX_TEST_EQ(val, i - 1);
+    }
+
+    // thieves steal in FIFO order
+    for (std::uint64_t i = 0; i != 500; ++i)
+    {
+        HPX_TEST(deque.steal(val));
+        HPX_TEST_EQ(val, i);
+    }
+
+    HPX_TEST(deque.empty());
+    HPX_TEST(!deque.pop(val));
+    HPX_TEST(!deque.steal(val));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_steal()
+{
+    hpx::util::chase_lev_deque<std::uint64_t> deque(16);
+
+    std::vector<std::atomic<std::uint64_t>> seen(items);
+    for (auto& s : seen)
+        s.store(0);
+
+    std::atomic<std::uint64_t> taken(0);
+    std::atomic<bool> done(false);
+
+    std::vector<std::thread> thieves;
+    for (std::uint64_t t = 0; t != threads; ++t)
+    {
+        thieves.emplace_back([&]() {
+            std::uint64_t val = 0;
+            while (!done.load())
+            {
+                if (deque.steal(val))
+                {
+                    ++seen[val];
+                    ++taken;
+                }
+            }
+        });
+    }
+
+    // the owner interleaves pushes and pops while thieves are stealing
+    std::uint64_t val = 0;
+    for (std::uint64_t i = 0; i != items; ++i)
+    {
+        deque.push(i);
+        if (i % 3 == 0 && deque.pop(val))
+        {
+            ++seen[val];
+            ++taken;
+        }
+    }
+
+    while (deque.pop(val))
+    {
+        ++seen[val];
+        ++taken;
+    }
+
+    while (taken.load() != items)
+        std::this_thread::yield();
+
+    done.store(true);
+    for (std::thread& t : thieves)
+        t.join();
+
+    // every item has been taken exactly once
+    HPX_TEST_EQ(taken.load(), items);
+    for (std::uint64_t i = 0; i != items; ++i)
+        HPX_TEST_EQ(seen[i].load(), std::uint64_t(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char** argv)
+{
+    using hpx::program_options::command_line_parser;
+    using hpx::program_options::notify;
+    using hpx::program_options::options_description;
+    using hpx::program_options::store;
+    using hpx::program_options::value;
+    using hpx::program_options::variables_map;
+
+    variables_map vm;
+
+    options_description desc_cmdline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_cmdline.add_options()
+        ("help,h", "print out program usage (this message)")
+        ("threads,t", value<std::uint64_t>(&threads)->default_value(4),
+         "the number of threads stealing from the deque")
+        ("items,i", value<std::uint64_t>(&items)->default_value(500000),
+         "the number of items to push onto the deque")
+    ;
+    // clang-format on
+
+    store(command_line_parser(argc, argv)
+              .options(desc_cmdline)
+              .allow_unregistered()
+              .run(),
+        vm);
+
+    notify(vm);
+
+    // print help screen
+    if (vm.count("help"))
+    {
+        std::cout << desc_cmdline;
+        return hpx::util::report_errors();
+    }
+
+    test_owner_only();
+    test_concurrent_steal();
+
+    return hpx::util::report_errors();
+}
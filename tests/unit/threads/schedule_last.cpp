@@ -86,6 +86,13 @@ int main(int argc, char* argv[])
         test_scheduler<scheduler_type>(argc, argv);
     }
 
+    {
+        using scheduler_type =
+            hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+                hpx::threads::policies::lockfree_chase_lev>;
+        test_scheduler<scheduler_type>(argc, argv);
+    }
+
 #if defined(HPX_HAVE_ABP_SCHEDULER) && defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
     {
         using scheduler_type =
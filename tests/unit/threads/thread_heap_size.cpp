@@ -0,0 +1,93 @@
+//  Copyright (c) 2020 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The thread queues keep at most hpx.thread_queue.max_thread_heap_size
+// terminated thread objects for reuse. The stacks of all other terminated
+// threads are handed to the stack cache of the worker thread, which is where
+// new threads have to take their stacks from once the kept thread objects
+// are used up.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t const max_thread_heap_size = 4;
+std::size_t const num_threads = 50;
+
+// run a burst of threads which are all alive at the same time
+void run_threads()
+{
+    hpx::lcos::local::promise<void> p;
+    hpx::shared_future<void> sf = p.get_future();
+
+    std::vector<hpx::future<void>> threads;
+    threads.reserve(num_threads);
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        threads.push_back(hpx::async([sf]() { sf.get(); }));
+    }
+
+    // make sure all threads were started before releasing them
+    hpx::this_thread::yield();
+    p.set_value();
+
+    hpx::wait_all(threads);
+
+    // give the scheduler the chance to clean up the terminated threads
+    while (hpx::threads::get_thread_count(hpx::threads::terminated) != 0)
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+int hpx_main()
+{
+    run_threads();
+
+#if (defined(__linux) || defined(linux) || defined(__linux__) ||               \
+    defined(__FreeBSD__) || defined(__APPLE__)) &&                             \
+    defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+    hpx::performance_counters::performance_counter hits(
+        "/threads{locality#0/total}/count/stack-cache-hits");
+    hits.reset(hpx::launch::sync);
+
+    run_threads();
+
+    // Only max_thread_heap_size thread objects were kept, all other threads
+    // had to take their stacks from the stack cache. Keeping all terminated
+    // thread objects would have left the stack cache unused. Threads created
+    // by the runtime itself are counted as well.
+    HPX_TEST_LTE(std::int64_t(num_threads / 2),
+        hits.get_value<std::int64_t>(hpx::launch::sync));
+#endif
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // all threads run on the same worker thread and share its stack cache
+    std::vector<std::string> const cfg = {"hpx.os_threads=1",
+        "hpx.thread_queue.max_thread_heap_size=" +
+            std::to_string(max_thread_heap_size)};
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}